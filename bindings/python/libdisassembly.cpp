@@ -54,7 +54,7 @@ BOOST_PYTHON_MODULE(disassembler) {
 		.def("__str__", &ARMInstruction::toString);
 
 	class_<ARMDisassembler>("ARMDisassembler", init<ARMVariants>())
-		.def("disassemble", &ARMDisassembler::disassemble);
+		.def("disassemble", static_cast<ARMInstruction (ARMDisassembler::*)(uint32_t, ARMMode) const>(&ARMDisassembler::disassemble));
 
 	// This implements the translation from std::shared_ptr<ARMInstruction> to python.
 	register_ptr_to_python<shared_ptr<ARMInstruction>>();
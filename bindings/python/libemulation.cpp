@@ -25,7 +25,7 @@ BOOST_PYTHON_MODULE(emulator) {
         .def("read", &AbstractMemory::read)
         .def("write", &AbstractMemory::write);
 
-    class_<ConcreteMemory, bases<AbstractMemory>>("ConcreteMemory");
+    class_<ConcreteMemory, bases<AbstractMemory>, boost::noncopyable>("ConcreteMemory");
 
     class_<ZeroMemoryMap, bases<AbstractMemory>>("ZeroMemoryMap");
 
@@ -39,7 +39,7 @@ BOOST_PYTHON_MODULE(emulator) {
         .def("readMemory", &ARMContext::readMemory)
         .def("writeMemory", &ARMContext::writeMemory);
 
-	class_<ARMEmulator>("ARMEmulator", init<ARMContext *, AbstractMemory *, ARMMode, ARMVariants>())
+	class_<ARMEmulator, boost::noncopyable>("ARMEmulator", init<ARMContext *, AbstractMemory *, ARMMode, ARMVariants>())
 		.def("start", &ARMEmulator::start)
         .def("getContext", &ARMEmulator::getContext, return_internal_reference<>())
         .def("setMode", &ARMEmulator::setMode);
@@ -9,427 +9,441 @@
 
 using namespace std;
 
+const ARMInterpreter::Handler ARMInterpreter::m_handlers[] = {
+    &ARMInterpreter::interpret_adc_immediate,
+    &ARMInterpreter::interpret_adc_register,
+    &ARMInterpreter::interpret_adc_register_shifted_register,
+    &ARMInterpreter::interpret_add_immediate_arm,
+    &ARMInterpreter::interpret_add_immediate_thumb,
+    &ARMInterpreter::interpret_add_register_arm,
+    &ARMInterpreter::interpret_add_register_shifted_register,
+    &ARMInterpreter::interpret_add_register_thumb,
+    &ARMInterpreter::interpret_add_sp_plus_immediate,
+    &ARMInterpreter::interpret_add_sp_plus_register_arm,
+    &ARMInterpreter::interpret_add_sp_plus_register_thumb,
+    &ARMInterpreter::interpret_adr,
+    &ARMInterpreter::interpret_and_immediate,
+    &ARMInterpreter::interpret_and_register,
+    &ARMInterpreter::interpret_and_register_shifted_register,
+    &ARMInterpreter::interpret_asr_immediate,
+    &ARMInterpreter::interpret_asr_register,
+    &ARMInterpreter::interpret_b,
+    &ARMInterpreter::interpret_bfc,
+    &ARMInterpreter::interpret_bfi,
+    &ARMInterpreter::interpret_bic_immediate,
+    &ARMInterpreter::interpret_bic_register,
+    &ARMInterpreter::interpret_bic_register_shifted_register,
+    &ARMInterpreter::interpret_bkpt,
+    &ARMInterpreter::interpret_bl_blx_immediate,
+    &ARMInterpreter::interpret_blx_register,
+    &ARMInterpreter::interpret_bx,
+    &ARMInterpreter::interpret_bxj,
+    &ARMInterpreter::interpret_cbnz_cbz,
+    &ARMInterpreter::interpret_cdp_cdp2,
+    &ARMInterpreter::interpret_clrex,
+    &ARMInterpreter::interpret_clz,
+    &ARMInterpreter::interpret_cmn_immediate,
+    &ARMInterpreter::interpret_cmn_register,
+    &ARMInterpreter::interpret_cmn_register_shifted_register,
+    &ARMInterpreter::interpret_cmp_immediate,
+    &ARMInterpreter::interpret_cmp_register,
+    &ARMInterpreter::interpret_cmp_register_shifted_register,
+    &ARMInterpreter::interpret_cps_arm,
+    &ARMInterpreter::interpret_cps_thumb,
+    &ARMInterpreter::interpret_dbg,
+    &ARMInterpreter::interpret_dmb,
+    &ARMInterpreter::interpret_dsb,
+    &ARMInterpreter::interpret_eor_immediate,
+    &ARMInterpreter::interpret_eor_register,
+    &ARMInterpreter::interpret_eor_register_shifted_register,
+    &ARMInterpreter::interpret_eret,
+    &ARMInterpreter::interpret_hvc,
+    &ARMInterpreter::interpret_isb,
+    &ARMInterpreter::interpret_it,
+    &ARMInterpreter::interpret_ldc_ldc2_immediate,
+    &ARMInterpreter::interpret_ldc_ldc2_literal,
+    &ARMInterpreter::interpret_unknown,
+    &ARMInterpreter::interpret_ldm_ldmia_ldmfd_arm,
+    &ARMInterpreter::interpret_ldm_ldmia_ldmfd_thumb,
+    &ARMInterpreter::interpret_unknown,
+    &ARMInterpreter::interpret_ldmda_ldmfa,
+    &ARMInterpreter::interpret_ldmdb_ldmea,
+    &ARMInterpreter::interpret_ldmib_ldmed,
+    &ARMInterpreter::interpret_ldr_immediate_arm,
+    &ARMInterpreter::interpret_ldr_immediate_thumb,
+    &ARMInterpreter::interpret_ldr_literal,
+    &ARMInterpreter::interpret_ldr_register_arm,
+    &ARMInterpreter::interpret_ldr_register_thumb,
+    &ARMInterpreter::interpret_ldrb_immediate_arm,
+    &ARMInterpreter::interpret_ldrb_immediate_thumb,
+    &ARMInterpreter::interpret_ldrb_literal,
+    &ARMInterpreter::interpret_ldrb_register,
+    &ARMInterpreter::interpret_ldrbt,
+    &ARMInterpreter::interpret_ldrd_immediate,
+    &ARMInterpreter::interpret_ldrd_literal,
+    &ARMInterpreter::interpret_ldrd_register,
+    &ARMInterpreter::interpret_ldrex,
+    &ARMInterpreter::interpret_ldrexb,
+    &ARMInterpreter::interpret_ldrexd,
+    &ARMInterpreter::interpret_ldrexh,
+    &ARMInterpreter::interpret_ldrh_immediate_arm,
+    &ARMInterpreter::interpret_ldrh_immediate_thumb,
+    &ARMInterpreter::interpret_ldrh_literal,
+    &ARMInterpreter::interpret_ldrh_register,
+    &ARMInterpreter::interpret_ldrht,
+    &ARMInterpreter::interpret_ldrsb_immediate,
+    &ARMInterpreter::interpret_ldrsb_literal,
+    &ARMInterpreter::interpret_ldrsb_register,
+    &ARMInterpreter::interpret_ldrsbt,
+    &ARMInterpreter::interpret_ldrsh_immediate,
+    &ARMInterpreter::interpret_ldrsh_literal,
+    &ARMInterpreter::interpret_ldrsh_register,
+    &ARMInterpreter::interpret_ldrsht,
+    &ARMInterpreter::interpret_ldrt,
+    &ARMInterpreter::interpret_lsl_immediate,
+    &ARMInterpreter::interpret_lsl_register,
+    &ARMInterpreter::interpret_lsr_immediate,
+    &ARMInterpreter::interpret_lsr_register,
+    &ARMInterpreter::interpret_mcr_mcr2,
+    &ARMInterpreter::interpret_mcrr_mcrr2,
+    &ARMInterpreter::interpret_mla,
+    &ARMInterpreter::interpret_mls,
+    &ARMInterpreter::interpret_mov_immediate,
+    &ARMInterpreter::interpret_mov_register_arm,
+    &ARMInterpreter::interpret_mov_register_thumb,
+    &ARMInterpreter::interpret_movt,
+    &ARMInterpreter::interpret_mrc_mrc2,
+    &ARMInterpreter::interpret_mrrc_mrrc2,
+    &ARMInterpreter::interpret_mrs,
+    &ARMInterpreter::interpret_mrs_banked_register,
+    &ARMInterpreter::interpret_msr_immediate,
+    &ARMInterpreter::interpret_msr_register,
+    &ARMInterpreter::interpret_mul,
+    &ARMInterpreter::interpret_mvn_immediate,
+    &ARMInterpreter::interpret_mvn_register,
+    &ARMInterpreter::interpret_mvn_register_shifted_register,
+    &ARMInterpreter::interpret_nop,
+    &ARMInterpreter::interpret_orn_immediate,
+    &ARMInterpreter::interpret_orn_register,
+    &ARMInterpreter::interpret_orr_immediate,
+    &ARMInterpreter::interpret_orr_register,
+    &ARMInterpreter::interpret_orr_register_shifted_register,
+    &ARMInterpreter::interpret_pkh,
+    &ARMInterpreter::interpret_pld_literal,
+    &ARMInterpreter::interpret_pld_pldw_immediate,
+    &ARMInterpreter::interpret_pld_pldw_register,
+    &ARMInterpreter::interpret_pli_immediate_literal,
+    &ARMInterpreter::interpret_pli_register,
+    &ARMInterpreter::interpret_pop_arm,
+    &ARMInterpreter::interpret_pop_thumb,
+    &ARMInterpreter::interpret_push,
+    &ARMInterpreter::interpret_qadd,
+    &ARMInterpreter::interpret_qadd16,
+    &ARMInterpreter::interpret_qadd8,
+    &ARMInterpreter::interpret_qasx,
+    &ARMInterpreter::interpret_qdadd,
+    &ARMInterpreter::interpret_qdsub,
+    &ARMInterpreter::interpret_qsax,
+    &ARMInterpreter::interpret_qsub,
+    &ARMInterpreter::interpret_qsub16,
+    &ARMInterpreter::interpret_qsub8,
+    &ARMInterpreter::interpret_rbit,
+    &ARMInterpreter::interpret_rev,
+    &ARMInterpreter::interpret_rev16,
+    &ARMInterpreter::interpret_revsh,
+    &ARMInterpreter::interpret_rfe,
+    &ARMInterpreter::interpret_ror_immediate,
+    &ARMInterpreter::interpret_ror_register,
+    &ARMInterpreter::interpret_rrx,
+    &ARMInterpreter::interpret_rsb_immediate,
+    &ARMInterpreter::interpret_rsb_register,
+    &ARMInterpreter::interpret_rsb_register_shifted_register,
+    &ARMInterpreter::interpret_rsc_immediate,
+    &ARMInterpreter::interpret_rsc_register,
+    &ARMInterpreter::interpret_rsc_register_shifted_register,
+    &ARMInterpreter::interpret_sadd16,
+    &ARMInterpreter::interpret_sadd8,
+    &ARMInterpreter::interpret_sasx,
+    &ARMInterpreter::interpret_sbc_immediate,
+    &ARMInterpreter::interpret_sbc_register,
+    &ARMInterpreter::interpret_sbc_register_shifted_register,
+    &ARMInterpreter::interpret_sbfx,
+    &ARMInterpreter::interpret_sdiv,
+    &ARMInterpreter::interpret_sel,
+    &ARMInterpreter::interpret_setend,
+    &ARMInterpreter::interpret_sev,
+    &ARMInterpreter::interpret_shadd16,
+    &ARMInterpreter::interpret_shadd8,
+    &ARMInterpreter::interpret_shasx,
+    &ARMInterpreter::interpret_shsax,
+    &ARMInterpreter::interpret_shsub16,
+    &ARMInterpreter::interpret_shsub8,
+    &ARMInterpreter::interpret_smc_previously_smi,
+    &ARMInterpreter::interpret_smlabb_smlabt_smlatb_smlatt,
+    &ARMInterpreter::interpret_smlad,
+    &ARMInterpreter::interpret_smlal,
+    &ARMInterpreter::interpret_smlalbb_smlalbt_smlaltb_smlaltt,
+    &ARMInterpreter::interpret_smlald,
+    &ARMInterpreter::interpret_smlawb_smlawt,
+    &ARMInterpreter::interpret_smlsd,
+    &ARMInterpreter::interpret_smlsld,
+    &ARMInterpreter::interpret_smmla,
+    &ARMInterpreter::interpret_smmls,
+    &ARMInterpreter::interpret_smmul,
+    &ARMInterpreter::interpret_smuad,
+    &ARMInterpreter::interpret_smulbb_smulbt_smultb_smultt,
+    &ARMInterpreter::interpret_smull,
+    &ARMInterpreter::interpret_smulwb_smulwt,
+    &ARMInterpreter::interpret_smusd,
+    &ARMInterpreter::interpret_srs_arm,
+    &ARMInterpreter::interpret_srs_thumb,
+    &ARMInterpreter::interpret_ssat,
+    &ARMInterpreter::interpret_ssat16,
+    &ARMInterpreter::interpret_ssax,
+    &ARMInterpreter::interpret_ssub16,
+    &ARMInterpreter::interpret_ssub8,
+    &ARMInterpreter::interpret_stc_stc2,
+    &ARMInterpreter::interpret_stm_stmia_stmea,
+    &ARMInterpreter::interpret_unknown,
+    &ARMInterpreter::interpret_stmda_stmed,
+    &ARMInterpreter::interpret_stmdb_stmfd,
+    &ARMInterpreter::interpret_stmib_stmfa,
+    &ARMInterpreter::interpret_str_immediate_arm,
+    &ARMInterpreter::interpret_str_immediate_thumb,
+    &ARMInterpreter::interpret_str_register,
+    &ARMInterpreter::interpret_strb_immediate_arm,
+    &ARMInterpreter::interpret_strb_immediate_thumb,
+    &ARMInterpreter::interpret_strb_register,
+    &ARMInterpreter::interpret_strbt,
+    &ARMInterpreter::interpret_strd_immediate,
+    &ARMInterpreter::interpret_strd_register,
+    &ARMInterpreter::interpret_strex,
+    &ARMInterpreter::interpret_strexb,
+    &ARMInterpreter::interpret_strexd,
+    &ARMInterpreter::interpret_strexh,
+    &ARMInterpreter::interpret_strh_immediate_arm,
+    &ARMInterpreter::interpret_strh_immediate_thumb,
+    &ARMInterpreter::interpret_strh_register,
+    &ARMInterpreter::interpret_strht,
+    &ARMInterpreter::interpret_strt,
+    &ARMInterpreter::interpret_sub_immediate_arm,
+    &ARMInterpreter::interpret_sub_immediate_thumb,
+    &ARMInterpreter::interpret_sub_register,
+    &ARMInterpreter::interpret_sub_register_shifted_register,
+    &ARMInterpreter::interpret_sub_sp_minus_immediate,
+    &ARMInterpreter::interpret_sub_sp_minus_register,
+    &ARMInterpreter::interpret_subs_pc_lr_and_related_instructions_arm,
+    &ARMInterpreter::interpret_subs_pc_lr_thumb,
+    &ARMInterpreter::interpret_svc,
+    &ARMInterpreter::interpret_swp_swpb,
+    &ARMInterpreter::interpret_sxtab,
+    &ARMInterpreter::interpret_sxtab16,
+    &ARMInterpreter::interpret_sxtah,
+    &ARMInterpreter::interpret_sxtb,
+    &ARMInterpreter::interpret_sxtb16,
+    &ARMInterpreter::interpret_sxth,
+    &ARMInterpreter::interpret_tbb,
+    &ARMInterpreter::interpret_tbh,
+    &ARMInterpreter::interpret_teq_immediate,
+    &ARMInterpreter::interpret_teq_register,
+    &ARMInterpreter::interpret_teq_register_shifted_register,
+    &ARMInterpreter::interpret_tst_immediate,
+    &ARMInterpreter::interpret_tst_register,
+    &ARMInterpreter::interpret_tst_register_shifted_register,
+    &ARMInterpreter::interpret_uadd16,
+    &ARMInterpreter::interpret_uadd8,
+    &ARMInterpreter::interpret_uasx,
+    &ARMInterpreter::interpret_ubfx,
+    &ARMInterpreter::interpret_udf,
+    &ARMInterpreter::interpret_udiv,
+    &ARMInterpreter::interpret_uhadd16,
+    &ARMInterpreter::interpret_uhadd8,
+    &ARMInterpreter::interpret_uhasx,
+    &ARMInterpreter::interpret_uhsax,
+    &ARMInterpreter::interpret_uhsub16,
+    &ARMInterpreter::interpret_uhsub8,
+    &ARMInterpreter::interpret_umaal,
+    &ARMInterpreter::interpret_umlal,
+    &ARMInterpreter::interpret_umull,
+    &ARMInterpreter::interpret_uqadd16,
+    &ARMInterpreter::interpret_uqadd8,
+    &ARMInterpreter::interpret_uqasx,
+    &ARMInterpreter::interpret_uqsax,
+    &ARMInterpreter::interpret_uqsub16,
+    &ARMInterpreter::interpret_uqsub8,
+    &ARMInterpreter::interpret_usad8,
+    &ARMInterpreter::interpret_usada8,
+    &ARMInterpreter::interpret_usat,
+    &ARMInterpreter::interpret_usat16,
+    &ARMInterpreter::interpret_usax,
+    &ARMInterpreter::interpret_usub16,
+    &ARMInterpreter::interpret_usub8,
+    &ARMInterpreter::interpret_uxtab,
+    &ARMInterpreter::interpret_uxtab16,
+    &ARMInterpreter::interpret_uxtah,
+    &ARMInterpreter::interpret_uxtb,
+    &ARMInterpreter::interpret_uxtb16,
+    &ARMInterpreter::interpret_uxth,
+    &ARMInterpreter::interpret_vaba_vabal,
+    &ARMInterpreter::interpret_vabd_floating_point,
+    &ARMInterpreter::interpret_vabd_vabdl_integer,
+    &ARMInterpreter::interpret_vabs,
+    &ARMInterpreter::interpret_vacge_vacgt_vacle_vaclt,
+    &ARMInterpreter::interpret_vadd_floating_point,
+    &ARMInterpreter::interpret_vadd_integer,
+    &ARMInterpreter::interpret_vaddhn,
+    &ARMInterpreter::interpret_vaddl_vaddw,
+    &ARMInterpreter::interpret_vand_register,
+    &ARMInterpreter::interpret_vbic_immediate,
+    &ARMInterpreter::interpret_vbic_register,
+    &ARMInterpreter::interpret_vbif_vbit_vbsl,
+    &ARMInterpreter::interpret_vceq_immediate_0,
+    &ARMInterpreter::interpret_vceq_register,
+    &ARMInterpreter::interpret_vcge_immediate_0,
+    &ARMInterpreter::interpret_vcge_register,
+    &ARMInterpreter::interpret_vcgt_immediate_0,
+    &ARMInterpreter::interpret_vcgt_register,
+    &ARMInterpreter::interpret_vcle_immediate_0,
+    &ARMInterpreter::interpret_vcls,
+    &ARMInterpreter::interpret_vclt_immediate_0,
+    &ARMInterpreter::interpret_vclz,
+    &ARMInterpreter::interpret_vcmp_vcmpe,
+    &ARMInterpreter::interpret_vcnt,
+    &ARMInterpreter::interpret_vcvt_between_double_precision_and_single_precision,
+    &ARMInterpreter::interpret_vcvt_between_floating_point_and_fixed_point_advancedsimd,
+    &ARMInterpreter::interpret_vcvt_between_floating_point_and_fixed_point_floating_point,
+    &ARMInterpreter::interpret_vcvt_between_floating_point_and_integer_advancedsimd,
+    &ARMInterpreter::interpret_vcvt_between_half_precision_and_single_precision_advancedsimd,
+    &ARMInterpreter::interpret_vcvt_vcvtr_between_floating_point_and_integer_floating_point,
+    &ARMInterpreter::interpret_vcvtb_vcvtt,
+    &ARMInterpreter::interpret_vdiv,
+    &ARMInterpreter::interpret_vdup_arm_core_register,
+    &ARMInterpreter::interpret_vdup_scalar,
+    &ARMInterpreter::interpret_veor,
+    &ARMInterpreter::interpret_vext,
+    &ARMInterpreter::interpret_vfma_vfms,
+    &ARMInterpreter::interpret_vfnma_vfnms,
+    &ARMInterpreter::interpret_vhadd_vhsub,
+    &ARMInterpreter::interpret_vld1_multiple_single_elements,
+    &ARMInterpreter::interpret_vld1_single_element_to_all_lanes,
+    &ARMInterpreter::interpret_vld1_single_element_to_one_lane,
+    &ARMInterpreter::interpret_vld2_multiple_2_element_structures,
+    &ARMInterpreter::interpret_vld2_single_2_element_structure_to_all_lanes,
+    &ARMInterpreter::interpret_vld2_single_2_element_structure_to_one_lane,
+    &ARMInterpreter::interpret_vld3_multiple_3_element_structures,
+    &ARMInterpreter::interpret_vld3_single_3_element_structure_to_all_lanes,
+    &ARMInterpreter::interpret_vld3_single_3_element_structure_to_one_lane,
+    &ARMInterpreter::interpret_vld4_multiple_4_element_structures,
+    &ARMInterpreter::interpret_vld4_single_4_element_structure_to_all_lanes,
+    &ARMInterpreter::interpret_vld4_single_4_element_structure_to_one_lane,
+    &ARMInterpreter::interpret_vldm,
+    &ARMInterpreter::interpret_vldr,
+    &ARMInterpreter::interpret_vmax_vmin_floating_point,
+    &ARMInterpreter::interpret_vmax_vmin_integer,
+    &ARMInterpreter::interpret_vmla_vmlal_vmls_vmlsl_by_scalar,
+    &ARMInterpreter::interpret_vmla_vmlal_vmls_vmlsl_integer,
+    &ARMInterpreter::interpret_vmla_vmls_floating_point,
+    &ARMInterpreter::interpret_vmov_arm_core_register_to_scalar,
+    &ARMInterpreter::interpret_vmov_between_arm_core_register_and_single_precision_register,
+    &ARMInterpreter::interpret_vmov_between_two_arm_core_registers_and_a_doubleword_extension_register,
+    &ARMInterpreter::interpret_vmov_between_two_arm_core_registers_and_two_single_precision_registers,
+    &ARMInterpreter::interpret_vmov_immediate,
+    &ARMInterpreter::interpret_vmov_register,
+    &ARMInterpreter::interpret_vmov_scalar_to_arm_core_register,
+    &ARMInterpreter::interpret_vmovl,
+    &ARMInterpreter::interpret_vmovn,
+    &ARMInterpreter::interpret_vmrs,
+    &ARMInterpreter::interpret_vmsr,
+    &ARMInterpreter::interpret_vmul_floating_point,
+    &ARMInterpreter::interpret_vmul_vmull_by_scalar,
+    &ARMInterpreter::interpret_vmul_vmull_integer_and_polynomial,
+    &ARMInterpreter::interpret_vmvn_immediate,
+    &ARMInterpreter::interpret_vmvn_register,
+    &ARMInterpreter::interpret_vneg,
+    &ARMInterpreter::interpret_vnmla_vnmls_vnmul,
+    &ARMInterpreter::interpret_vorn_register,
+    &ARMInterpreter::interpret_vorr_immediate,
+    &ARMInterpreter::interpret_vorr_register,
+    &ARMInterpreter::interpret_vpadal,
+    &ARMInterpreter::interpret_vpadd_floating_point,
+    &ARMInterpreter::interpret_vpadd_integer,
+    &ARMInterpreter::interpret_vpaddl,
+    &ARMInterpreter::interpret_vpmax_vpmin_floating_point,
+    &ARMInterpreter::interpret_vpmax_vpmin_integer,
+    &ARMInterpreter::interpret_vpop,
+    &ARMInterpreter::interpret_vpush,
+    &ARMInterpreter::interpret_vqabs,
+    &ARMInterpreter::interpret_vqadd,
+    &ARMInterpreter::interpret_vqdmlal_vqdmlsl,
+    &ARMInterpreter::interpret_vqdmulh,
+    &ARMInterpreter::interpret_vqdmull,
+    &ARMInterpreter::interpret_vqmovn_vqmovun,
+    &ARMInterpreter::interpret_vqneg,
+    &ARMInterpreter::interpret_vqrdmulh,
+    &ARMInterpreter::interpret_vqrshl,
+    &ARMInterpreter::interpret_vqrshrn_vqrshrun,
+    &ARMInterpreter::interpret_vqshl_register,
+    &ARMInterpreter::interpret_vqshl_vqshlu_immediate,
+    &ARMInterpreter::interpret_vqshrn_vqshrun,
+    &ARMInterpreter::interpret_vqsub,
+    &ARMInterpreter::interpret_vraddhn,
+    &ARMInterpreter::interpret_vrecpe,
+    &ARMInterpreter::interpret_vrecps,
+    &ARMInterpreter::interpret_vrev16_vrev32_vrev64,
+    &ARMInterpreter::interpret_vrhadd,
+    &ARMInterpreter::interpret_vrshl,
+    &ARMInterpreter::interpret_vrshr,
+    &ARMInterpreter::interpret_vrshrn,
+    &ARMInterpreter::interpret_vrsqrte,
+    &ARMInterpreter::interpret_vrsqrts,
+    &ARMInterpreter::interpret_vrsra,
+    &ARMInterpreter::interpret_vrsubhn,
+    &ARMInterpreter::interpret_vshl_immediate,
+    &ARMInterpreter::interpret_vshl_register,
+    &ARMInterpreter::interpret_vshll,
+    &ARMInterpreter::interpret_vshr,
+    &ARMInterpreter::interpret_vshrn,
+    &ARMInterpreter::interpret_vsli,
+    &ARMInterpreter::interpret_vsqrt,
+    &ARMInterpreter::interpret_vsra,
+    &ARMInterpreter::interpret_vsri,
+    &ARMInterpreter::interpret_vst1_multiple_single_elements,
+    &ARMInterpreter::interpret_vst1_single_element_from_one_lane,
+    &ARMInterpreter::interpret_vst2_multiple_2_element_structures,
+    &ARMInterpreter::interpret_vst2_single_2_element_structure_from_one_lane,
+    &ARMInterpreter::interpret_vst3_multiple_3_element_structures,
+    &ARMInterpreter::interpret_vst3_single_3_element_structure_from_one_lane,
+    &ARMInterpreter::interpret_vst4_multiple_4_element_structures,
+    &ARMInterpreter::interpret_vst4_single_4_element_structure_from_one_lane,
+    &ARMInterpreter::interpret_vstm,
+    &ARMInterpreter::interpret_vstr,
+    &ARMInterpreter::interpret_vsub_floating_point,
+    &ARMInterpreter::interpret_vsub_integer,
+    &ARMInterpreter::interpret_vsubhn,
+    &ARMInterpreter::interpret_vsubl_vsubw,
+    &ARMInterpreter::interpret_vswp,
+    &ARMInterpreter::interpret_vtbl_vtbx,
+    &ARMInterpreter::interpret_vtrn,
+    &ARMInterpreter::interpret_vtst,
+    &ARMInterpreter::interpret_vuzp,
+    &ARMInterpreter::interpret_vzip,
+    &ARMInterpreter::interpret_wfe,
+    &ARMInterpreter::interpret_wfi,
+    &ARMInterpreter::interpret_yield,
+};
+
+const size_t ARMInterpreter::n_handlers = sizeof(ARMInterpreter::m_handlers) / sizeof(ARMInterpreter::m_handlers[0]);
+
+ARMInterpreter::Handler ARMInterpreter::getHandler(const ARMInstruction &ins) {
+    if (ins.m_status != eStatusValid || ins.id >= n_handlers) {
+        return &ARMInterpreter::interpret_unknown;
+    }
+
+    return m_handlers[ins.id];
+}
+
 void ARMInterpreter::execute(const ARMInstruction &ins) {
-    switch (ins.id) {
-        case ARMInstructionId::adc_immediate: interpret_adc_immediate(ins); break;
-        case ARMInstructionId::adc_register: interpret_adc_register(ins); break;
-        case ARMInstructionId::adc_register_shifted_register: interpret_adc_register_shifted_register(ins); break;
-        case ARMInstructionId::add_immediate_thumb: interpret_add_immediate_thumb(ins); break;
-        case ARMInstructionId::add_immediate_arm: interpret_add_immediate_arm(ins); break;
-        case ARMInstructionId::add_register_thumb: interpret_add_register_thumb(ins); break;
-        case ARMInstructionId::add_register_arm: interpret_add_register_arm(ins); break;
-        case ARMInstructionId::add_register_shifted_register: interpret_add_register_shifted_register(ins); break;
-        case ARMInstructionId::add_sp_plus_immediate: interpret_add_sp_plus_immediate(ins); break;
-        case ARMInstructionId::add_sp_plus_register_thumb: interpret_add_sp_plus_register_thumb(ins); break;
-        case ARMInstructionId::add_sp_plus_register_arm: interpret_add_sp_plus_register_arm(ins); break;
-        case ARMInstructionId::adr: interpret_adr(ins); break;
-        case ARMInstructionId::and_immediate: interpret_and_immediate(ins); break;
-        case ARMInstructionId::and_register: interpret_and_register(ins); break;
-        case ARMInstructionId::and_register_shifted_register: interpret_and_register_shifted_register(ins); break;
-        case ARMInstructionId::asr_immediate: interpret_asr_immediate(ins); break;
-        case ARMInstructionId::asr_register: interpret_asr_register(ins); break;
-        case ARMInstructionId::b: interpret_b(ins); break;
-        case ARMInstructionId::bfc: interpret_bfc(ins); break;
-        case ARMInstructionId::bfi: interpret_bfi(ins); break;
-        case ARMInstructionId::bic_immediate: interpret_bic_immediate(ins); break;
-        case ARMInstructionId::bic_register: interpret_bic_register(ins); break;
-        case ARMInstructionId::bic_register_shifted_register: interpret_bic_register_shifted_register(ins); break;
-        case ARMInstructionId::bkpt: interpret_bkpt(ins); break;
-        case ARMInstructionId::bl_blx_immediate: interpret_bl_blx_immediate(ins); break;
-        case ARMInstructionId::blx_register: interpret_blx_register(ins); break;
-        case ARMInstructionId::bx: interpret_bx(ins); break;
-        case ARMInstructionId::bxj: interpret_bxj(ins); break;
-        case ARMInstructionId::cbnz_cbz: interpret_cbnz_cbz(ins); break;
-        case ARMInstructionId::cdp_cdp2: interpret_cdp_cdp2(ins); break;
-        case ARMInstructionId::clrex: interpret_clrex(ins); break;
-        case ARMInstructionId::clz: interpret_clz(ins); break;
-        case ARMInstructionId::cmn_immediate: interpret_cmn_immediate(ins); break;
-        case ARMInstructionId::cmn_register: interpret_cmn_register(ins); break;
-        case ARMInstructionId::cmn_register_shifted_register: interpret_cmn_register_shifted_register(ins); break;
-        case ARMInstructionId::cmp_immediate: interpret_cmp_immediate(ins); break;
-        case ARMInstructionId::cmp_register: interpret_cmp_register(ins); break;
-        case ARMInstructionId::cmp_register_shifted_register: interpret_cmp_register_shifted_register(ins); break;
-        case ARMInstructionId::cps_thumb: interpret_cps_thumb(ins); break;
-        case ARMInstructionId::cps_arm: interpret_cps_arm(ins); break;
-        case ARMInstructionId::dbg: interpret_dbg(ins); break;
-        case ARMInstructionId::dmb: interpret_dmb(ins); break;
-        case ARMInstructionId::dsb: interpret_dsb(ins); break;
-        case ARMInstructionId::eor_immediate: interpret_eor_immediate(ins); break;
-        case ARMInstructionId::eor_register: interpret_eor_register(ins); break;
-        case ARMInstructionId::eor_register_shifted_register: interpret_eor_register_shifted_register(ins); break;
-        case ARMInstructionId::eret: interpret_eret(ins); break;
-        case ARMInstructionId::hvc: interpret_hvc(ins); break;
-        case ARMInstructionId::isb: interpret_isb(ins); break;
-        case ARMInstructionId::it: interpret_it(ins); break;
-        case ARMInstructionId::ldc_ldc2_immediate: interpret_ldc_ldc2_immediate(ins); break;
-        case ARMInstructionId::ldc_ldc2_literal: interpret_ldc_ldc2_literal(ins); break;
-        case ARMInstructionId::ldm_ldmia_ldmfd_thumb: interpret_ldm_ldmia_ldmfd_thumb(ins); break;
-        case ARMInstructionId::ldm_ldmia_ldmfd_arm: interpret_ldm_ldmia_ldmfd_arm(ins); break;
-        case ARMInstructionId::ldmda_ldmfa: interpret_ldmda_ldmfa(ins); break;
-        case ARMInstructionId::ldmdb_ldmea: interpret_ldmdb_ldmea(ins); break;
-        case ARMInstructionId::ldmib_ldmed: interpret_ldmib_ldmed(ins); break;
-        case ARMInstructionId::ldr_immediate_thumb: interpret_ldr_immediate_thumb(ins); break;
-        case ARMInstructionId::ldr_immediate_arm: interpret_ldr_immediate_arm(ins); break;
-        case ARMInstructionId::ldr_literal: interpret_ldr_literal(ins); break;
-        case ARMInstructionId::ldr_register_thumb: interpret_ldr_register_thumb(ins); break;
-        case ARMInstructionId::ldr_register_arm: interpret_ldr_register_arm(ins); break;
-        case ARMInstructionId::ldrb_immediate_thumb: interpret_ldrb_immediate_thumb(ins); break;
-        case ARMInstructionId::ldrb_immediate_arm: interpret_ldrb_immediate_arm(ins); break;
-        case ARMInstructionId::ldrb_literal: interpret_ldrb_literal(ins); break;
-        case ARMInstructionId::ldrb_register: interpret_ldrb_register(ins); break;
-        case ARMInstructionId::ldrbt: interpret_ldrbt(ins); break;
-        case ARMInstructionId::ldrd_immediate: interpret_ldrd_immediate(ins); break;
-        case ARMInstructionId::ldrd_literal: interpret_ldrd_literal(ins); break;
-        case ARMInstructionId::ldrd_register: interpret_ldrd_register(ins); break;
-        case ARMInstructionId::ldrex: interpret_ldrex(ins); break;
-        case ARMInstructionId::ldrexb: interpret_ldrexb(ins); break;
-        case ARMInstructionId::ldrexd: interpret_ldrexd(ins); break;
-        case ARMInstructionId::ldrexh: interpret_ldrexh(ins); break;
-        case ARMInstructionId::ldrh_immediate_thumb: interpret_ldrh_immediate_thumb(ins); break;
-        case ARMInstructionId::ldrh_immediate_arm: interpret_ldrh_immediate_arm(ins); break;
-        case ARMInstructionId::ldrh_literal: interpret_ldrh_literal(ins); break;
-        case ARMInstructionId::ldrh_register: interpret_ldrh_register(ins); break;
-        case ARMInstructionId::ldrht: interpret_ldrht(ins); break;
-        case ARMInstructionId::ldrsb_immediate: interpret_ldrsb_immediate(ins); break;
-        case ARMInstructionId::ldrsb_literal: interpret_ldrsb_literal(ins); break;
-        case ARMInstructionId::ldrsb_register: interpret_ldrsb_register(ins); break;
-        case ARMInstructionId::ldrsbt: interpret_ldrsbt(ins); break;
-        case ARMInstructionId::ldrsh_immediate: interpret_ldrsh_immediate(ins); break;
-        case ARMInstructionId::ldrsh_literal: interpret_ldrsh_literal(ins); break;
-        case ARMInstructionId::ldrsh_register: interpret_ldrsh_register(ins); break;
-        case ARMInstructionId::ldrsht: interpret_ldrsht(ins); break;
-        case ARMInstructionId::ldrt: interpret_ldrt(ins); break;
-        case ARMInstructionId::lsl_immediate: interpret_lsl_immediate(ins); break;
-        case ARMInstructionId::lsl_register: interpret_lsl_register(ins); break;
-        case ARMInstructionId::lsr_immediate: interpret_lsr_immediate(ins); break;
-        case ARMInstructionId::lsr_register: interpret_lsr_register(ins); break;
-        case ARMInstructionId::mcr_mcr2: interpret_mcr_mcr2(ins); break;
-        case ARMInstructionId::mcrr_mcrr2: interpret_mcrr_mcrr2(ins); break;
-        case ARMInstructionId::mla: interpret_mla(ins); break;
-        case ARMInstructionId::mls: interpret_mls(ins); break;
-        case ARMInstructionId::mov_immediate: interpret_mov_immediate(ins); break;
-        case ARMInstructionId::mov_register_thumb: interpret_mov_register_thumb(ins); break;
-        case ARMInstructionId::mov_register_arm: interpret_mov_register_arm(ins); break;
-        case ARMInstructionId::movt: interpret_movt(ins); break;
-        case ARMInstructionId::mrc_mrc2: interpret_mrc_mrc2(ins); break;
-        case ARMInstructionId::mrrc_mrrc2: interpret_mrrc_mrrc2(ins); break;
-        case ARMInstructionId::mrs: interpret_mrs(ins); break;
-        case ARMInstructionId::mrs_banked_register: interpret_mrs_banked_register(ins); break;
-        case ARMInstructionId::msr_immediate: interpret_msr_immediate(ins); break;
-        case ARMInstructionId::msr_register: interpret_msr_register(ins); break;
-        case ARMInstructionId::mul: interpret_mul(ins); break;
-        case ARMInstructionId::mvn_immediate: interpret_mvn_immediate(ins); break;
-        case ARMInstructionId::mvn_register: interpret_mvn_register(ins); break;
-        case ARMInstructionId::mvn_register_shifted_register: interpret_mvn_register_shifted_register(ins); break;
-        case ARMInstructionId::nop: interpret_nop(ins); break;
-        case ARMInstructionId::orn_immediate: interpret_orn_immediate(ins); break;
-        case ARMInstructionId::orn_register: interpret_orn_register(ins); break;
-        case ARMInstructionId::orr_immediate: interpret_orr_immediate(ins); break;
-        case ARMInstructionId::orr_register: interpret_orr_register(ins); break;
-        case ARMInstructionId::orr_register_shifted_register: interpret_orr_register_shifted_register(ins); break;
-        case ARMInstructionId::pkh: interpret_pkh(ins); break;
-        case ARMInstructionId::pld_pldw_immediate: interpret_pld_pldw_immediate(ins); break;
-        case ARMInstructionId::pld_literal: interpret_pld_literal(ins); break;
-        case ARMInstructionId::pld_pldw_register: interpret_pld_pldw_register(ins); break;
-        case ARMInstructionId::pli_immediate_literal: interpret_pli_immediate_literal(ins); break;
-        case ARMInstructionId::pli_register: interpret_pli_register(ins); break;
-        case ARMInstructionId::pop_thumb: interpret_pop_thumb(ins); break;
-        case ARMInstructionId::pop_arm: interpret_pop_arm(ins); break;
-        case ARMInstructionId::push: interpret_push(ins); break;
-        case ARMInstructionId::qadd: interpret_qadd(ins); break;
-        case ARMInstructionId::qadd16: interpret_qadd16(ins); break;
-        case ARMInstructionId::qadd8: interpret_qadd8(ins); break;
-        case ARMInstructionId::qasx: interpret_qasx(ins); break;
-        case ARMInstructionId::qdadd: interpret_qdadd(ins); break;
-        case ARMInstructionId::qdsub: interpret_qdsub(ins); break;
-        case ARMInstructionId::qsax: interpret_qsax(ins); break;
-        case ARMInstructionId::qsub: interpret_qsub(ins); break;
-        case ARMInstructionId::qsub16: interpret_qsub16(ins); break;
-        case ARMInstructionId::qsub8: interpret_qsub8(ins); break;
-        case ARMInstructionId::rbit: interpret_rbit(ins); break;
-        case ARMInstructionId::rev: interpret_rev(ins); break;
-        case ARMInstructionId::rev16: interpret_rev16(ins); break;
-        case ARMInstructionId::revsh: interpret_revsh(ins); break;
-        case ARMInstructionId::rfe: interpret_rfe(ins); break;
-        case ARMInstructionId::ror_immediate: interpret_ror_immediate(ins); break;
-        case ARMInstructionId::ror_register: interpret_ror_register(ins); break;
-        case ARMInstructionId::rrx: interpret_rrx(ins); break;
-        case ARMInstructionId::rsb_immediate: interpret_rsb_immediate(ins); break;
-        case ARMInstructionId::rsb_register: interpret_rsb_register(ins); break;
-        case ARMInstructionId::rsb_register_shifted_register: interpret_rsb_register_shifted_register(ins); break;
-        case ARMInstructionId::rsc_immediate: interpret_rsc_immediate(ins); break;
-        case ARMInstructionId::rsc_register: interpret_rsc_register(ins); break;
-        case ARMInstructionId::rsc_register_shifted_register: interpret_rsc_register_shifted_register(ins); break;
-        case ARMInstructionId::sadd16: interpret_sadd16(ins); break;
-        case ARMInstructionId::sadd8: interpret_sadd8(ins); break;
-        case ARMInstructionId::sasx: interpret_sasx(ins); break;
-        case ARMInstructionId::sbc_immediate: interpret_sbc_immediate(ins); break;
-        case ARMInstructionId::sbc_register: interpret_sbc_register(ins); break;
-        case ARMInstructionId::sbc_register_shifted_register: interpret_sbc_register_shifted_register(ins); break;
-        case ARMInstructionId::sbfx: interpret_sbfx(ins); break;
-        case ARMInstructionId::sdiv: interpret_sdiv(ins); break;
-        case ARMInstructionId::sel: interpret_sel(ins); break;
-        case ARMInstructionId::setend: interpret_setend(ins); break;
-        case ARMInstructionId::sev: interpret_sev(ins); break;
-        case ARMInstructionId::shadd16: interpret_shadd16(ins); break;
-        case ARMInstructionId::shadd8: interpret_shadd8(ins); break;
-        case ARMInstructionId::shasx: interpret_shasx(ins); break;
-        case ARMInstructionId::shsax: interpret_shsax(ins); break;
-        case ARMInstructionId::shsub16: interpret_shsub16(ins); break;
-        case ARMInstructionId::shsub8: interpret_shsub8(ins); break;
-        case ARMInstructionId::smc_previously_smi: interpret_smc_previously_smi(ins); break;
-        case ARMInstructionId::smlabb_smlabt_smlatb_smlatt: interpret_smlabb_smlabt_smlatb_smlatt(ins); break;
-        case ARMInstructionId::smlad: interpret_smlad(ins); break;
-        case ARMInstructionId::smlal: interpret_smlal(ins); break;
-        case ARMInstructionId::smlalbb_smlalbt_smlaltb_smlaltt: interpret_smlalbb_smlalbt_smlaltb_smlaltt(ins); break;
-        case ARMInstructionId::smlald: interpret_smlald(ins); break;
-        case ARMInstructionId::smlawb_smlawt: interpret_smlawb_smlawt(ins); break;
-        case ARMInstructionId::smlsd: interpret_smlsd(ins); break;
-        case ARMInstructionId::smlsld: interpret_smlsld(ins); break;
-        case ARMInstructionId::smmla: interpret_smmla(ins); break;
-        case ARMInstructionId::smmls: interpret_smmls(ins); break;
-        case ARMInstructionId::smmul: interpret_smmul(ins); break;
-        case ARMInstructionId::smuad: interpret_smuad(ins); break;
-        case ARMInstructionId::smulbb_smulbt_smultb_smultt: interpret_smulbb_smulbt_smultb_smultt(ins); break;
-        case ARMInstructionId::smull: interpret_smull(ins); break;
-        case ARMInstructionId::smulwb_smulwt: interpret_smulwb_smulwt(ins); break;
-        case ARMInstructionId::smusd: interpret_smusd(ins); break;
-        case ARMInstructionId::srs_thumb: interpret_srs_thumb(ins); break;
-        case ARMInstructionId::srs_arm: interpret_srs_arm(ins); break;
-        case ARMInstructionId::ssat: interpret_ssat(ins); break;
-        case ARMInstructionId::ssat16: interpret_ssat16(ins); break;
-        case ARMInstructionId::ssax: interpret_ssax(ins); break;
-        case ARMInstructionId::ssub16: interpret_ssub16(ins); break;
-        case ARMInstructionId::ssub8: interpret_ssub8(ins); break;
-        case ARMInstructionId::stc_stc2: interpret_stc_stc2(ins); break;
-        case ARMInstructionId::stm_stmia_stmea: interpret_stm_stmia_stmea(ins); break;
-        case ARMInstructionId::stmda_stmed: interpret_stmda_stmed(ins); break;
-        case ARMInstructionId::stmdb_stmfd: interpret_stmdb_stmfd(ins); break;
-        case ARMInstructionId::stmib_stmfa: interpret_stmib_stmfa(ins); break;
-        case ARMInstructionId::str_immediate_thumb: interpret_str_immediate_thumb(ins); break;
-        case ARMInstructionId::str_immediate_arm: interpret_str_immediate_arm(ins); break;
-        case ARMInstructionId::str_register: interpret_str_register(ins); break;
-        case ARMInstructionId::strb_immediate_thumb: interpret_strb_immediate_thumb(ins); break;
-        case ARMInstructionId::strb_immediate_arm: interpret_strb_immediate_arm(ins); break;
-        case ARMInstructionId::strb_register: interpret_strb_register(ins); break;
-        case ARMInstructionId::strbt: interpret_strbt(ins); break;
-        case ARMInstructionId::strd_immediate: interpret_strd_immediate(ins); break;
-        case ARMInstructionId::strd_register: interpret_strd_register(ins); break;
-        case ARMInstructionId::strex: interpret_strex(ins); break;
-        case ARMInstructionId::strexb: interpret_strexb(ins); break;
-        case ARMInstructionId::strexd: interpret_strexd(ins); break;
-        case ARMInstructionId::strexh: interpret_strexh(ins); break;
-        case ARMInstructionId::strh_immediate_thumb: interpret_strh_immediate_thumb(ins); break;
-        case ARMInstructionId::strh_immediate_arm: interpret_strh_immediate_arm(ins); break;
-        case ARMInstructionId::strh_register: interpret_strh_register(ins); break;
-        case ARMInstructionId::strht: interpret_strht(ins); break;
-        case ARMInstructionId::strt: interpret_strt(ins); break;
-        case ARMInstructionId::sub_immediate_thumb: interpret_sub_immediate_thumb(ins); break;
-        case ARMInstructionId::sub_immediate_arm: interpret_sub_immediate_arm(ins); break;
-        case ARMInstructionId::sub_register: interpret_sub_register(ins); break;
-        case ARMInstructionId::sub_register_shifted_register: interpret_sub_register_shifted_register(ins); break;
-        case ARMInstructionId::sub_sp_minus_immediate: interpret_sub_sp_minus_immediate(ins); break;
-        case ARMInstructionId::sub_sp_minus_register: interpret_sub_sp_minus_register(ins); break;
-        case ARMInstructionId::subs_pc_lr_thumb: interpret_subs_pc_lr_thumb(ins); break;
-        case ARMInstructionId::subs_pc_lr_and_related_instructions_arm: interpret_subs_pc_lr_and_related_instructions_arm(ins); break;
-        case ARMInstructionId::svc: interpret_svc(ins); break;
-        case ARMInstructionId::swp_swpb: interpret_swp_swpb(ins); break;
-        case ARMInstructionId::sxtab: interpret_sxtab(ins); break;
-        case ARMInstructionId::sxtab16: interpret_sxtab16(ins); break;
-        case ARMInstructionId::sxtah: interpret_sxtah(ins); break;
-        case ARMInstructionId::sxtb: interpret_sxtb(ins); break;
-        case ARMInstructionId::sxtb16: interpret_sxtb16(ins); break;
-        case ARMInstructionId::sxth: interpret_sxth(ins); break;
-        case ARMInstructionId::tbb: interpret_tbb(ins); break;
-        case ARMInstructionId::tbh: interpret_tbh(ins); break;
-        case ARMInstructionId::teq_immediate: interpret_teq_immediate(ins); break;
-        case ARMInstructionId::teq_register: interpret_teq_register(ins); break;
-        case ARMInstructionId::teq_register_shifted_register: interpret_teq_register_shifted_register(ins); break;
-        case ARMInstructionId::tst_immediate: interpret_tst_immediate(ins); break;
-        case ARMInstructionId::tst_register: interpret_tst_register(ins); break;
-        case ARMInstructionId::tst_register_shifted_register: interpret_tst_register_shifted_register(ins); break;
-        case ARMInstructionId::uadd16: interpret_uadd16(ins); break;
-        case ARMInstructionId::uadd8: interpret_uadd8(ins); break;
-        case ARMInstructionId::uasx: interpret_uasx(ins); break;
-        case ARMInstructionId::ubfx: interpret_ubfx(ins); break;
-        case ARMInstructionId::udf: interpret_udf(ins); break;
-        case ARMInstructionId::udiv: interpret_udiv(ins); break;
-        case ARMInstructionId::uhadd16: interpret_uhadd16(ins); break;
-        case ARMInstructionId::uhadd8: interpret_uhadd8(ins); break;
-        case ARMInstructionId::uhasx: interpret_uhasx(ins); break;
-        case ARMInstructionId::uhsax: interpret_uhsax(ins); break;
-        case ARMInstructionId::uhsub16: interpret_uhsub16(ins); break;
-        case ARMInstructionId::uhsub8: interpret_uhsub8(ins); break;
-        case ARMInstructionId::umaal: interpret_umaal(ins); break;
-        case ARMInstructionId::umlal: interpret_umlal(ins); break;
-        case ARMInstructionId::umull: interpret_umull(ins); break;
-        case ARMInstructionId::uqadd16: interpret_uqadd16(ins); break;
-        case ARMInstructionId::uqadd8: interpret_uqadd8(ins); break;
-        case ARMInstructionId::uqasx: interpret_uqasx(ins); break;
-        case ARMInstructionId::uqsax: interpret_uqsax(ins); break;
-        case ARMInstructionId::uqsub16: interpret_uqsub16(ins); break;
-        case ARMInstructionId::uqsub8: interpret_uqsub8(ins); break;
-        case ARMInstructionId::usad8: interpret_usad8(ins); break;
-        case ARMInstructionId::usada8: interpret_usada8(ins); break;
-        case ARMInstructionId::usat: interpret_usat(ins); break;
-        case ARMInstructionId::usat16: interpret_usat16(ins); break;
-        case ARMInstructionId::usax: interpret_usax(ins); break;
-        case ARMInstructionId::usub16: interpret_usub16(ins); break;
-        case ARMInstructionId::usub8: interpret_usub8(ins); break;
-        case ARMInstructionId::uxtab: interpret_uxtab(ins); break;
-        case ARMInstructionId::uxtab16: interpret_uxtab16(ins); break;
-        case ARMInstructionId::uxtah: interpret_uxtah(ins); break;
-        case ARMInstructionId::uxtb: interpret_uxtb(ins); break;
-        case ARMInstructionId::uxtb16: interpret_uxtb16(ins); break;
-        case ARMInstructionId::uxth: interpret_uxth(ins); break;
-        case ARMInstructionId::vaba_vabal: interpret_vaba_vabal(ins); break;
-        case ARMInstructionId::vabd_vabdl_integer: interpret_vabd_vabdl_integer(ins); break;
-        case ARMInstructionId::vabd_floating_point: interpret_vabd_floating_point(ins); break;
-        case ARMInstructionId::vabs: interpret_vabs(ins); break;
-        case ARMInstructionId::vacge_vacgt_vacle_vaclt: interpret_vacge_vacgt_vacle_vaclt(ins); break;
-        case ARMInstructionId::vadd_integer: interpret_vadd_integer(ins); break;
-        case ARMInstructionId::vadd_floating_point: interpret_vadd_floating_point(ins); break;
-        case ARMInstructionId::vaddhn: interpret_vaddhn(ins); break;
-        case ARMInstructionId::vaddl_vaddw: interpret_vaddl_vaddw(ins); break;
-        case ARMInstructionId::vand_register: interpret_vand_register(ins); break;
-        case ARMInstructionId::vbic_immediate: interpret_vbic_immediate(ins); break;
-        case ARMInstructionId::vbic_register: interpret_vbic_register(ins); break;
-        case ARMInstructionId::vbif_vbit_vbsl: interpret_vbif_vbit_vbsl(ins); break;
-        case ARMInstructionId::vceq_register: interpret_vceq_register(ins); break;
-        case ARMInstructionId::vceq_immediate_0: interpret_vceq_immediate_0(ins); break;
-        case ARMInstructionId::vcge_register: interpret_vcge_register(ins); break;
-        case ARMInstructionId::vcge_immediate_0: interpret_vcge_immediate_0(ins); break;
-        case ARMInstructionId::vcgt_register: interpret_vcgt_register(ins); break;
-        case ARMInstructionId::vcgt_immediate_0: interpret_vcgt_immediate_0(ins); break;
-        case ARMInstructionId::vcle_immediate_0: interpret_vcle_immediate_0(ins); break;
-        case ARMInstructionId::vcls: interpret_vcls(ins); break;
-        case ARMInstructionId::vclt_immediate_0: interpret_vclt_immediate_0(ins); break;
-        case ARMInstructionId::vclz: interpret_vclz(ins); break;
-        case ARMInstructionId::vcmp_vcmpe: interpret_vcmp_vcmpe(ins); break;
-        case ARMInstructionId::vcnt: interpret_vcnt(ins); break;
-        case ARMInstructionId::vcvt_between_floating_point_and_integer_advancedsimd: interpret_vcvt_between_floating_point_and_integer_advancedsimd(ins); break;
-        case ARMInstructionId::vcvt_vcvtr_between_floating_point_and_integer_floating_point: interpret_vcvt_vcvtr_between_floating_point_and_integer_floating_point(ins); break;
-        case ARMInstructionId::vcvt_between_floating_point_and_fixed_point_advancedsimd: interpret_vcvt_between_floating_point_and_fixed_point_advancedsimd(ins); break;
-        case ARMInstructionId::vcvt_between_floating_point_and_fixed_point_floating_point: interpret_vcvt_between_floating_point_and_fixed_point_floating_point(ins); break;
-        case ARMInstructionId::vcvt_between_double_precision_and_single_precision: interpret_vcvt_between_double_precision_and_single_precision(ins); break;
-        case ARMInstructionId::vcvt_between_half_precision_and_single_precision_advancedsimd: interpret_vcvt_between_half_precision_and_single_precision_advancedsimd(ins); break;
-        case ARMInstructionId::vcvtb_vcvtt: interpret_vcvtb_vcvtt(ins); break;
-        case ARMInstructionId::vdiv: interpret_vdiv(ins); break;
-        case ARMInstructionId::vdup_scalar: interpret_vdup_scalar(ins); break;
-        case ARMInstructionId::vdup_arm_core_register: interpret_vdup_arm_core_register(ins); break;
-        case ARMInstructionId::veor: interpret_veor(ins); break;
-        case ARMInstructionId::vext: interpret_vext(ins); break;
-        case ARMInstructionId::vfma_vfms: interpret_vfma_vfms(ins); break;
-        case ARMInstructionId::vfnma_vfnms: interpret_vfnma_vfnms(ins); break;
-        case ARMInstructionId::vhadd_vhsub: interpret_vhadd_vhsub(ins); break;
-        case ARMInstructionId::vld1_multiple_single_elements: interpret_vld1_multiple_single_elements(ins); break;
-        case ARMInstructionId::vld1_single_element_to_one_lane: interpret_vld1_single_element_to_one_lane(ins); break;
-        case ARMInstructionId::vld1_single_element_to_all_lanes: interpret_vld1_single_element_to_all_lanes(ins); break;
-        case ARMInstructionId::vld2_multiple_2_element_structures: interpret_vld2_multiple_2_element_structures(ins); break;
-        case ARMInstructionId::vld2_single_2_element_structure_to_one_lane: interpret_vld2_single_2_element_structure_to_one_lane(ins); break;
-        case ARMInstructionId::vld2_single_2_element_structure_to_all_lanes: interpret_vld2_single_2_element_structure_to_all_lanes(ins); break;
-        case ARMInstructionId::vld3_multiple_3_element_structures: interpret_vld3_multiple_3_element_structures(ins); break;
-        case ARMInstructionId::vld3_single_3_element_structure_to_one_lane: interpret_vld3_single_3_element_structure_to_one_lane(ins); break;
-        case ARMInstructionId::vld3_single_3_element_structure_to_all_lanes: interpret_vld3_single_3_element_structure_to_all_lanes(ins); break;
-        case ARMInstructionId::vld4_multiple_4_element_structures: interpret_vld4_multiple_4_element_structures(ins); break;
-        case ARMInstructionId::vld4_single_4_element_structure_to_one_lane: interpret_vld4_single_4_element_structure_to_one_lane(ins); break;
-        case ARMInstructionId::vld4_single_4_element_structure_to_all_lanes: interpret_vld4_single_4_element_structure_to_all_lanes(ins); break;
-        case ARMInstructionId::vldm: interpret_vldm(ins); break;
-        case ARMInstructionId::vldr: interpret_vldr(ins); break;
-        case ARMInstructionId::vmax_vmin_integer: interpret_vmax_vmin_integer(ins); break;
-        case ARMInstructionId::vmax_vmin_floating_point: interpret_vmax_vmin_floating_point(ins); break;
-        case ARMInstructionId::vmla_vmlal_vmls_vmlsl_integer: interpret_vmla_vmlal_vmls_vmlsl_integer(ins); break;
-        case ARMInstructionId::vmla_vmls_floating_point: interpret_vmla_vmls_floating_point(ins); break;
-        case ARMInstructionId::vmla_vmlal_vmls_vmlsl_by_scalar: interpret_vmla_vmlal_vmls_vmlsl_by_scalar(ins); break;
-        case ARMInstructionId::vmov_immediate: interpret_vmov_immediate(ins); break;
-        case ARMInstructionId::vmov_register: interpret_vmov_register(ins); break;
-        case ARMInstructionId::vmov_arm_core_register_to_scalar: interpret_vmov_arm_core_register_to_scalar(ins); break;
-        case ARMInstructionId::vmov_scalar_to_arm_core_register: interpret_vmov_scalar_to_arm_core_register(ins); break;
-        case ARMInstructionId::vmov_between_arm_core_register_and_single_precision_register: interpret_vmov_between_arm_core_register_and_single_precision_register(ins); break;
-        case ARMInstructionId::vmov_between_two_arm_core_registers_and_two_single_precision_registers: interpret_vmov_between_two_arm_core_registers_and_two_single_precision_registers(ins); break;
-        case ARMInstructionId::vmov_between_two_arm_core_registers_and_a_doubleword_extension_register: interpret_vmov_between_two_arm_core_registers_and_a_doubleword_extension_register(ins); break;
-        case ARMInstructionId::vmovl: interpret_vmovl(ins); break;
-        case ARMInstructionId::vmovn: interpret_vmovn(ins); break;
-        case ARMInstructionId::vmrs: interpret_vmrs(ins); break;
-        case ARMInstructionId::vmsr: interpret_vmsr(ins); break;
-        case ARMInstructionId::vmul_vmull_integer_and_polynomial: interpret_vmul_vmull_integer_and_polynomial(ins); break;
-        case ARMInstructionId::vmul_floating_point: interpret_vmul_floating_point(ins); break;
-        case ARMInstructionId::vmul_vmull_by_scalar: interpret_vmul_vmull_by_scalar(ins); break;
-        case ARMInstructionId::vmvn_immediate: interpret_vmvn_immediate(ins); break;
-        case ARMInstructionId::vmvn_register: interpret_vmvn_register(ins); break;
-        case ARMInstructionId::vneg: interpret_vneg(ins); break;
-        case ARMInstructionId::vnmla_vnmls_vnmul: interpret_vnmla_vnmls_vnmul(ins); break;
-        case ARMInstructionId::vorn_register: interpret_vorn_register(ins); break;
-        case ARMInstructionId::vorr_immediate: interpret_vorr_immediate(ins); break;
-        case ARMInstructionId::vorr_register: interpret_vorr_register(ins); break;
-        case ARMInstructionId::vpadal: interpret_vpadal(ins); break;
-        case ARMInstructionId::vpadd_integer: interpret_vpadd_integer(ins); break;
-        case ARMInstructionId::vpadd_floating_point: interpret_vpadd_floating_point(ins); break;
-        case ARMInstructionId::vpaddl: interpret_vpaddl(ins); break;
-        case ARMInstructionId::vpmax_vpmin_integer: interpret_vpmax_vpmin_integer(ins); break;
-        case ARMInstructionId::vpmax_vpmin_floating_point: interpret_vpmax_vpmin_floating_point(ins); break;
-        case ARMInstructionId::vpop: interpret_vpop(ins); break;
-        case ARMInstructionId::vpush: interpret_vpush(ins); break;
-        case ARMInstructionId::vqabs: interpret_vqabs(ins); break;
-        case ARMInstructionId::vqadd: interpret_vqadd(ins); break;
-        case ARMInstructionId::vqdmlal_vqdmlsl: interpret_vqdmlal_vqdmlsl(ins); break;
-        case ARMInstructionId::vqdmulh: interpret_vqdmulh(ins); break;
-        case ARMInstructionId::vqdmull: interpret_vqdmull(ins); break;
-        case ARMInstructionId::vqmovn_vqmovun: interpret_vqmovn_vqmovun(ins); break;
-        case ARMInstructionId::vqneg: interpret_vqneg(ins); break;
-        case ARMInstructionId::vqrdmulh: interpret_vqrdmulh(ins); break;
-        case ARMInstructionId::vqrshl: interpret_vqrshl(ins); break;
-        case ARMInstructionId::vqrshrn_vqrshrun: interpret_vqrshrn_vqrshrun(ins); break;
-        case ARMInstructionId::vqshl_register: interpret_vqshl_register(ins); break;
-        case ARMInstructionId::vqshl_vqshlu_immediate: interpret_vqshl_vqshlu_immediate(ins); break;
-        case ARMInstructionId::vqshrn_vqshrun: interpret_vqshrn_vqshrun(ins); break;
-        case ARMInstructionId::vqsub: interpret_vqsub(ins); break;
-        case ARMInstructionId::vraddhn: interpret_vraddhn(ins); break;
-        case ARMInstructionId::vrecpe: interpret_vrecpe(ins); break;
-        case ARMInstructionId::vrecps: interpret_vrecps(ins); break;
-        case ARMInstructionId::vrev16_vrev32_vrev64: interpret_vrev16_vrev32_vrev64(ins); break;
-        case ARMInstructionId::vrhadd: interpret_vrhadd(ins); break;
-        case ARMInstructionId::vrshl: interpret_vrshl(ins); break;
-        case ARMInstructionId::vrshr: interpret_vrshr(ins); break;
-        case ARMInstructionId::vrshrn: interpret_vrshrn(ins); break;
-        case ARMInstructionId::vrsqrte: interpret_vrsqrte(ins); break;
-        case ARMInstructionId::vrsqrts: interpret_vrsqrts(ins); break;
-        case ARMInstructionId::vrsra: interpret_vrsra(ins); break;
-        case ARMInstructionId::vrsubhn: interpret_vrsubhn(ins); break;
-        case ARMInstructionId::vshl_immediate: interpret_vshl_immediate(ins); break;
-        case ARMInstructionId::vshl_register: interpret_vshl_register(ins); break;
-        case ARMInstructionId::vshll: interpret_vshll(ins); break;
-        case ARMInstructionId::vshr: interpret_vshr(ins); break;
-        case ARMInstructionId::vshrn: interpret_vshrn(ins); break;
-        case ARMInstructionId::vsli: interpret_vsli(ins); break;
-        case ARMInstructionId::vsqrt: interpret_vsqrt(ins); break;
-        case ARMInstructionId::vsra: interpret_vsra(ins); break;
-        case ARMInstructionId::vsri: interpret_vsri(ins); break;
-        case ARMInstructionId::vst1_multiple_single_elements: interpret_vst1_multiple_single_elements(ins); break;
-        case ARMInstructionId::vst1_single_element_from_one_lane: interpret_vst1_single_element_from_one_lane(ins); break;
-        case ARMInstructionId::vst2_multiple_2_element_structures: interpret_vst2_multiple_2_element_structures(ins); break;
-        case ARMInstructionId::vst2_single_2_element_structure_from_one_lane: interpret_vst2_single_2_element_structure_from_one_lane(ins); break;
-        case ARMInstructionId::vst3_multiple_3_element_structures: interpret_vst3_multiple_3_element_structures(ins); break;
-        case ARMInstructionId::vst3_single_3_element_structure_from_one_lane: interpret_vst3_single_3_element_structure_from_one_lane(ins); break;
-        case ARMInstructionId::vst4_multiple_4_element_structures: interpret_vst4_multiple_4_element_structures(ins); break;
-        case ARMInstructionId::vst4_single_4_element_structure_from_one_lane: interpret_vst4_single_4_element_structure_from_one_lane(ins); break;
-        case ARMInstructionId::vstm: interpret_vstm(ins); break;
-        case ARMInstructionId::vstr: interpret_vstr(ins); break;
-        case ARMInstructionId::vsub_integer: interpret_vsub_integer(ins); break;
-        case ARMInstructionId::vsub_floating_point: interpret_vsub_floating_point(ins); break;
-        case ARMInstructionId::vsubhn: interpret_vsubhn(ins); break;
-        case ARMInstructionId::vsubl_vsubw: interpret_vsubl_vsubw(ins); break;
-        case ARMInstructionId::vswp: interpret_vswp(ins); break;
-        case ARMInstructionId::vtbl_vtbx: interpret_vtbl_vtbx(ins); break;
-        case ARMInstructionId::vtrn: interpret_vtrn(ins); break;
-        case ARMInstructionId::vtst: interpret_vtst(ins); break;
-        case ARMInstructionId::vuzp: interpret_vuzp(ins); break;
-        case ARMInstructionId::vzip: interpret_vzip(ins); break;
-        case ARMInstructionId::wfe: interpret_wfe(ins); break;
-        case ARMInstructionId::wfi: interpret_wfi(ins); break;
-        case ARMInstructionId::yield: interpret_yield(ins); break;
-        default: break;
-    }
+    execute(getHandler(ins), ins);
 }
 
 bool ARMInterpreter::interpret_adc_immediate(const ARMInstruction &ins) {
@@ -438,17 +452,14 @@ bool ARMInterpreter::interpret_adc_immediate(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), ins.imm32, m_ctx.APSR.C);
+        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), ins.imm32, m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
         }
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
-            m_ctx.APSR.V = overflow;
+            m_ctx.setFlagsNZCV(result, carry, overflow);
         }
     }
     return true;
@@ -461,17 +472,14 @@ bool ARMInterpreter::interpret_adc_register(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
-        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), shifted, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
+        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), shifted, m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -487,14 +495,11 @@ bool ARMInterpreter::interpret_adc_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
-        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), shifted, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
+        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), shifted, m_ctx.flagC());
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
-            m_ctx.APSR.V = overflow;
+            m_ctx.setFlagsNZCV(result, carry, overflow);
         }
     }
     return true;
@@ -509,10 +514,7 @@ bool ARMInterpreter::interpret_add_immediate_thumb(const ARMInstruction &ins) {
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), ins.imm32, 0);
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
-            m_ctx.APSR.V = overflow;
+            m_ctx.setFlagsNZCV(result, carry, overflow);
         }
     }
     return true;
@@ -530,10 +532,7 @@ bool ARMInterpreter::interpret_add_immediate_arm(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -547,17 +546,14 @@ bool ARMInterpreter::interpret_add_register_thumb(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), shifted, 0);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -571,17 +567,14 @@ bool ARMInterpreter::interpret_add_register_arm(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), shifted, 0);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -597,14 +590,11 @@ bool ARMInterpreter::interpret_add_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), shifted, 0);
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
-            m_ctx.APSR.V = overflow;
+            m_ctx.setFlagsNZCV(result, carry, overflow);
         }
     }
     return true;
@@ -622,10 +612,7 @@ bool ARMInterpreter::interpret_add_sp_plus_immediate(const ARMInstruction &ins)
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -639,17 +626,14 @@ bool ARMInterpreter::interpret_add_sp_plus_register_thumb(const ARMInstruction &
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(13), shifted, 0);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -663,17 +647,14 @@ bool ARMInterpreter::interpret_add_sp_plus_register_arm(const ARMInstruction &in
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(13), shifted, 0);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -704,9 +685,7 @@ bool ARMInterpreter::interpret_and_immediate(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = ExpandImm_C(ins.encoding, ins.imm12, m_ctx.APSR.C);
+                m_ctx.setFlagsNZC(result, ExpandImm_C(ins.encoding, ins.imm12, m_ctx.flagC()));
             }
         }
     }
@@ -719,16 +698,14 @@ bool ARMInterpreter::interpret_and_register(const ARMInstruction &ins) {
     int result = 0;
 
     if (ConditionPassed()) {
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) & shifted);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -743,13 +720,11 @@ bool ARMInterpreter::interpret_and_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) & shifted);
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -760,15 +735,13 @@ bool ARMInterpreter::interpret_asr_immediate(const ARMInstruction &ins) {
     int carry = 0;
 
     if (ConditionPassed()) {
-        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_ASR, ins.shift_n, m_ctx.APSR.C);
+        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_ASR, ins.shift_n, m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -782,12 +755,10 @@ bool ARMInterpreter::interpret_asr_register(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.m), 7, 0));
-        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.n), SRType_ASR, shift_n, m_ctx.APSR.C);
+        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.n), SRType_ASR, shift_n, m_ctx.flagC());
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -842,9 +813,7 @@ bool ARMInterpreter::interpret_bic_immediate(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = ExpandImm_C(ins.encoding, ins.imm12, m_ctx.APSR.C);
+                m_ctx.setFlagsNZC(result, ExpandImm_C(ins.encoding, ins.imm12, m_ctx.flagC()));
             }
         }
     }
@@ -857,16 +826,14 @@ bool ARMInterpreter::interpret_bic_register(const ARMInstruction &ins) {
     int result = 0;
 
     if (ConditionPassed()) {
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) & NOT(shifted, 32));
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -881,13 +848,11 @@ bool ARMInterpreter::interpret_bic_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) & NOT(shifted, 32));
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -1013,10 +978,7 @@ bool ARMInterpreter::interpret_cmn_immediate(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), ins.imm32, 0);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
-        m_ctx.APSR.V = overflow;
+        m_ctx.setFlagsNZCV(result, carry, overflow);
     }
     return true;
 }
@@ -1028,12 +990,9 @@ bool ARMInterpreter::interpret_cmn_register(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), shifted, 0);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
-        m_ctx.APSR.V = overflow;
+        m_ctx.setFlagsNZCV(result, carry, overflow);
     }
     return true;
 }
@@ -1047,12 +1006,9 @@ bool ARMInterpreter::interpret_cmn_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), shifted, 0);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
-        m_ctx.APSR.V = overflow;
+        m_ctx.setFlagsNZCV(result, carry, overflow);
     }
     return true;
 }
@@ -1064,10 +1020,7 @@ bool ARMInterpreter::interpret_cmp_immediate(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(ins.imm32, 32), 1);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
-        m_ctx.APSR.V = overflow;
+        m_ctx.setFlagsNZCV(result, carry, overflow);
     }
     return true;
 }
@@ -1079,12 +1032,9 @@ bool ARMInterpreter::interpret_cmp_register(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(shifted, 32), 1);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
-        m_ctx.APSR.V = overflow;
+        m_ctx.setFlagsNZCV(result, carry, overflow);
     }
     return true;
 }
@@ -1098,12 +1048,9 @@ bool ARMInterpreter::interpret_cmp_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(shifted, 32), 1);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
-        m_ctx.APSR.V = overflow;
+        m_ctx.setFlagsNZCV(result, carry, overflow);
     }
     return true;
 }
@@ -1111,6 +1058,7 @@ bool ARMInterpreter::interpret_cmp_register_shifted_register(const ARMInstructio
 bool ARMInterpreter::interpret_cps_thumb(const ARMInstruction &ins) {
     int cpsr_val = 0;
 
+    m_ctx.syncFlags();
     EncodingSpecificOperations();
     if (CurrentModeIsNotUser()) {
         cpsr_val = m_ctx.CPSR;
@@ -1150,6 +1098,7 @@ bool ARMInterpreter::interpret_cps_thumb(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_cps_arm(const ARMInstruction &ins) {
     int cpsr_val = 0;
 
+    m_ctx.syncFlags();
     EncodingSpecificOperations();
     if (CurrentModeIsNotUser()) {
         cpsr_val = m_ctx.CPSR;
@@ -1328,9 +1277,7 @@ bool ARMInterpreter::interpret_eor_immediate(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = ExpandImm_C(ins.encoding, ins.imm12, m_ctx.APSR.C);
+                m_ctx.setFlagsNZC(result, ExpandImm_C(ins.encoding, ins.imm12, m_ctx.flagC()));
             }
         }
     }
@@ -1343,16 +1290,14 @@ bool ARMInterpreter::interpret_eor_register(const ARMInstruction &ins) {
     int result = 0;
 
     if (ConditionPassed()) {
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) ^ shifted);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -1367,13 +1312,11 @@ bool ARMInterpreter::interpret_eor_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) ^ shifted);
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -1382,6 +1325,7 @@ bool ARMInterpreter::interpret_eor_register_shifted_register(const ARMInstructio
 bool ARMInterpreter::interpret_eret(const ARMInstruction &ins) {
     int new_pc_value = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         if (unlikely((CurrentModeIsUserOrSystem() || (CurrentInstrSet() == InstrSet_ThumbEE)))) {
             return false;
@@ -1436,6 +1380,7 @@ bool ARMInterpreter::interpret_it(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldc_ldc2_immediate(const ARMInstruction &ins) {
     int offset_addr = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         if (!Coproc_Accepted(ins.cp, ThisInstr())) {
@@ -1445,7 +1390,11 @@ bool ARMInterpreter::interpret_ldc_ldc2_immediate(const ARMInstruction &ins) {
             offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
             address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
             do {
-                Coproc_SendLoadedWord(m_ctx.read_MemA(address, 4), ins.cp, ThisInstr());
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    return true;
+                }
+                Coproc_SendLoadedWord(loaded_value, ins.cp, ThisInstr());
             } while (Coproc_DoneLoading(ins.cp, ThisInstr()));
             
             if (ins.wback) {
@@ -1459,6 +1408,7 @@ bool ARMInterpreter::interpret_ldc_ldc2_immediate(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldc_ldc2_literal(const ARMInstruction &ins) {
     int offset_addr = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         if (!Coproc_Accepted(ins.cp, ThisInstr())) {
@@ -1468,7 +1418,11 @@ bool ARMInterpreter::interpret_ldc_ldc2_literal(const ARMInstruction &ins) {
             offset_addr = ((ins.add) ? (Align(m_ctx.readRegularRegister(15), 4) + ins.imm32) : (Align(m_ctx.readRegularRegister(15), 4) - ins.imm32));
             address = ((ins.index) ? offset_addr : Align(m_ctx.readRegularRegister(15), 4));
             do {
-                Coproc_SendLoadedWord(m_ctx.read_MemA(address, 4), ins.cp, ThisInstr());
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    return true;
+                }
+                Coproc_SendLoadedWord(loaded_value, ins.cp, ThisInstr());
             } while (Coproc_DoneLoading(ins.cp, ThisInstr()));
             
         }
@@ -1479,19 +1433,31 @@ bool ARMInterpreter::interpret_ldc_ldc2_literal(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldm_ldmia_ldmfd_thumb(const ARMInstruction &ins) {
     int address = 0;
     int i = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
         address = m_ctx.readRegularRegister(ins.n);
         for (i = 0; i < 14; ++i) {
             if ((get_bit(ins.registers, i) == 1)) {
-                m_ctx.writeRegularRegister(i, m_ctx.read_MemA(address, 4));
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
+                m_ctx.writeRegularRegister(i, loaded_value);
                 address = (address + 4);
             }
         }
         
         if ((get_bit(ins.registers, 15) == 1)) {
-            LoadWritePC(m_ctx.read_MemA(address, 4));
+            loaded_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            LoadWritePC(loaded_value);
         }
         if ((ins.wback && (get_bit(ins.registers, ins.n) == 0))) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + (4 * BitCount(ins.registers))));
@@ -1506,19 +1472,31 @@ bool ARMInterpreter::interpret_ldm_ldmia_ldmfd_thumb(const ARMInstruction &ins)
 bool ARMInterpreter::interpret_ldm_ldmia_ldmfd_arm(const ARMInstruction &ins) {
     int address = 0;
     int i = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
         address = m_ctx.readRegularRegister(ins.n);
         for (i = 0; i < 14; ++i) {
             if ((get_bit(ins.registers, i) == 1)) {
-                m_ctx.writeRegularRegister(i, m_ctx.read_MemA(address, 4));
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
+                m_ctx.writeRegularRegister(i, loaded_value);
                 address = (address + 4);
             }
         }
         
         if ((get_bit(ins.registers, 15) == 1)) {
-            LoadWritePC(m_ctx.read_MemA(address, 4));
+            loaded_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            LoadWritePC(loaded_value);
         }
         if ((ins.wback && (get_bit(ins.registers, ins.n) == 0))) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + (4 * BitCount(ins.registers))));
@@ -1533,18 +1511,30 @@ bool ARMInterpreter::interpret_ldm_ldmia_ldmfd_arm(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldmda_ldmfa(const ARMInstruction &ins) {
     int address = 0;
     int i = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         address = ((m_ctx.readRegularRegister(ins.n) - (4 * BitCount(ins.registers))) + 4);
         for (i = 0; i < 14; ++i) {
             if ((get_bit(ins.registers, i) == 1)) {
-                m_ctx.writeRegularRegister(i, m_ctx.read_MemA(address, 4));
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
+                m_ctx.writeRegularRegister(i, loaded_value);
                 address = (address + 4);
             }
         }
         
         if ((get_bit(ins.registers, 15) == 1)) {
-            LoadWritePC(m_ctx.read_MemA(address, 4));
+            loaded_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            LoadWritePC(loaded_value);
         }
         if ((ins.wback && (get_bit(ins.registers, ins.n) == 0))) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) - (4 * BitCount(ins.registers))));
@@ -1559,19 +1549,31 @@ bool ARMInterpreter::interpret_ldmda_ldmfa(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldmdb_ldmea(const ARMInstruction &ins) {
     int address = 0;
     int i = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
         address = (m_ctx.readRegularRegister(ins.n) - (4 * BitCount(ins.registers)));
         for (i = 0; i < 14; ++i) {
             if ((get_bit(ins.registers, i) == 1)) {
-                m_ctx.writeRegularRegister(i, m_ctx.read_MemA(address, 4));
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
+                m_ctx.writeRegularRegister(i, loaded_value);
                 address = (address + 4);
             }
         }
         
         if ((get_bit(ins.registers, 15) == 1)) {
-            LoadWritePC(m_ctx.read_MemA(address, 4));
+            loaded_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            LoadWritePC(loaded_value);
         }
         if ((ins.wback && (get_bit(ins.registers, ins.n) == 0))) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) - (4 * BitCount(ins.registers))));
@@ -1586,18 +1588,30 @@ bool ARMInterpreter::interpret_ldmdb_ldmea(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldmib_ldmed(const ARMInstruction &ins) {
     int address = 0;
     int i = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         address = (m_ctx.readRegularRegister(ins.n) + 4);
         for (i = 0; i < 14; ++i) {
             if ((get_bit(ins.registers, i) == 1)) {
-                m_ctx.writeRegularRegister(i, m_ctx.read_MemA(address, 4));
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
+                m_ctx.writeRegularRegister(i, loaded_value);
                 address = (address + 4);
             }
         }
         
         if ((get_bit(ins.registers, 15) == 1)) {
-            LoadWritePC(m_ctx.read_MemA(address, 4));
+            loaded_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            LoadWritePC(loaded_value);
         }
         if ((ins.wback && (get_bit(ins.registers, ins.n) == 0))) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + (4 * BitCount(ins.registers))));
@@ -1619,6 +1633,9 @@ bool ARMInterpreter::interpret_ldr_immediate_thumb(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         data = m_ctx.read_MemU(address, 4);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -1647,6 +1664,9 @@ bool ARMInterpreter::interpret_ldr_immediate_arm(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         data = m_ctx.read_MemU(address, 4);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -1676,6 +1696,9 @@ bool ARMInterpreter::interpret_ldr_literal(const ARMInstruction &ins) {
         base = Align(m_ctx.readRegularRegister(15), 4);
         address = ((ins.add) ? (base + ins.imm32) : (base - ins.imm32));
         data = m_ctx.read_MemU(address, 4);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if ((ins.t == 15)) {
             if ((get_bits(address, 1, 0) == 0)) {
                 LoadWritePC(data);
@@ -1704,10 +1727,13 @@ bool ARMInterpreter::interpret_ldr_register_thumb(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         offset_addr = (m_ctx.readRegularRegister(ins.n) + offset);
         address = offset_addr;
         data = m_ctx.read_MemU(address, 4);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if ((ins.t == 15)) {
             if ((get_bits(address, 1, 0) == 0)) {
                 LoadWritePC(data);
@@ -1731,10 +1757,13 @@ bool ARMInterpreter::interpret_ldr_register_arm(const ARMInstruction &ins) {
     int data = 0;
 
     if (ConditionPassed()) {
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         data = m_ctx.read_MemU(address, 4);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
             if ((ins.t == 15)) {
@@ -1757,12 +1786,17 @@ bool ARMInterpreter::interpret_ldr_register_arm(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldrb_immediate_thumb(const ARMInstruction &ins) {
     int offset_addr = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
-        m_ctx.writeRegularRegister(ins.t, ZeroExtend(m_ctx.read_MemU(address, 1), 32));
+        loaded_value = m_ctx.read_MemU(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, ZeroExtend(loaded_value, 32));
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -1773,11 +1807,16 @@ bool ARMInterpreter::interpret_ldrb_immediate_thumb(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldrb_immediate_arm(const ARMInstruction &ins) {
     int offset_addr = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
-        m_ctx.writeRegularRegister(ins.t, ZeroExtend(m_ctx.read_MemU(address, 1), 32));
+        loaded_value = m_ctx.read_MemU(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, ZeroExtend(loaded_value, 32));
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -1788,12 +1827,17 @@ bool ARMInterpreter::interpret_ldrb_immediate_arm(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldrb_literal(const ARMInstruction &ins) {
     int base = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(15);
         base = Align(m_ctx.readRegularRegister(15), 4);
         address = ((ins.add) ? (base + ins.imm32) : (base - ins.imm32));
-        m_ctx.writeRegularRegister(ins.t, ZeroExtend(m_ctx.read_MemU(address, 1), 32));
+        loaded_value = m_ctx.read_MemU(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, ZeroExtend(loaded_value, 32));
     }
     return true;
 }
@@ -1802,13 +1846,18 @@ bool ARMInterpreter::interpret_ldrb_register(const ARMInstruction &ins) {
     int offset = 0;
     int offset_addr = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
-        m_ctx.writeRegularRegister(ins.t, ZeroExtend(m_ctx.read_MemU(address, 1), 32));
+        loaded_value = m_ctx.read_MemU(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, ZeroExtend(loaded_value, 32));
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -1820,16 +1869,21 @@ bool ARMInterpreter::interpret_ldrbt(const ARMInstruction &ins) {
     int offset = 0;
     int offset_addr = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         if (unlikely(CurrentModeIsHyp())) {
             return false;
         }
         NullCheckIfThumbEE(ins.n);
-        offset = ((ins.register_form) ? Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C) : ins.imm32);
+        offset = ((ins.register_form) ? Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC()) : ins.imm32);
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.postindex) ? m_ctx.readRegularRegister(ins.n) : offset_addr);
-        m_ctx.writeRegularRegister(ins.t, ZeroExtend(m_ctx.read_MemU_unpriv(address, 1), 32));
+        loaded_value = m_ctx.read_MemU_unpriv(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, ZeroExtend(loaded_value, 32));
         if (ins.postindex) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -1842,6 +1896,7 @@ bool ARMInterpreter::interpret_ldrd_immediate(const ARMInstruction &ins) {
     int address = 0;
     int data = 0;
     int tmp1 = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
@@ -1849,6 +1904,9 @@ bool ARMInterpreter::interpret_ldrd_immediate(const ARMInstruction &ins) {
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         if ((HaveLPAE() && (get_bits(address, 2, 0) == 0))) {
             data = m_ctx.read_MemA(address, 8);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             if (BigEndian()) {
                 m_ctx.writeRegularRegister(ins.t, get_bits(data, 63, 32));
                 m_ctx.writeRegularRegister(ins.t2, get_bits(data, 31, 0));
@@ -1858,8 +1916,16 @@ bool ARMInterpreter::interpret_ldrd_immediate(const ARMInstruction &ins) {
             }
         } else {
             tmp1 = (address + 4);
-            m_ctx.writeRegularRegister(ins.t, m_ctx.read_MemA(address, 4));
-            m_ctx.writeRegularRegister(ins.t2, m_ctx.read_MemA(tmp1, 4));
+            loaded_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
+            m_ctx.writeRegularRegister(ins.t, loaded_value);
+            loaded_value = m_ctx.read_MemA(tmp1, 4);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
+            m_ctx.writeRegularRegister(ins.t2, loaded_value);
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -1872,12 +1938,16 @@ bool ARMInterpreter::interpret_ldrd_literal(const ARMInstruction &ins) {
     int address = 0;
     int data = 0;
     int tmp1 = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(15);
         address = ((ins.add) ? (Align(m_ctx.readRegularRegister(15), 4) + ins.imm32) : (Align(m_ctx.readRegularRegister(15), 4) - ins.imm32));
         if ((HaveLPAE() && (get_bits(address, 2, 0) == 0))) {
             data = m_ctx.read_MemA(address, 8);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             if (BigEndian()) {
                 m_ctx.writeRegularRegister(ins.t, get_bits(data, 63, 32));
                 m_ctx.writeRegularRegister(ins.t2, get_bits(data, 31, 0));
@@ -1887,8 +1957,16 @@ bool ARMInterpreter::interpret_ldrd_literal(const ARMInstruction &ins) {
             }
         } else {
             tmp1 = (address + 4);
-            m_ctx.writeRegularRegister(ins.t, m_ctx.read_MemA(address, 4));
-            m_ctx.writeRegularRegister(ins.t2, m_ctx.read_MemA(tmp1, 4));
+            loaded_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
+            m_ctx.writeRegularRegister(ins.t, loaded_value);
+            loaded_value = m_ctx.read_MemA(tmp1, 4);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
+            m_ctx.writeRegularRegister(ins.t2, loaded_value);
         }
     }
     return true;
@@ -1899,12 +1977,16 @@ bool ARMInterpreter::interpret_ldrd_register(const ARMInstruction &ins) {
     int address = 0;
     int data = 0;
     int tmp1 = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + m_ctx.readRegularRegister(ins.m)) : (m_ctx.readRegularRegister(ins.n) - m_ctx.readRegularRegister(ins.m)));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         if ((HaveLPAE() && (get_bits(address, 2, 0) == 0))) {
             data = m_ctx.read_MemA(address, 8);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             if (BigEndian()) {
                 m_ctx.writeRegularRegister(ins.t, get_bits(data, 63, 32));
                 m_ctx.writeRegularRegister(ins.t2, get_bits(data, 31, 0));
@@ -1914,8 +1996,16 @@ bool ARMInterpreter::interpret_ldrd_register(const ARMInstruction &ins) {
             }
         } else {
             tmp1 = (address + 4);
-            m_ctx.writeRegularRegister(ins.t, m_ctx.read_MemA(address, 4));
-            m_ctx.writeRegularRegister(ins.t2, m_ctx.read_MemA(tmp1, 4));
+            loaded_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
+            m_ctx.writeRegularRegister(ins.t, loaded_value);
+            loaded_value = m_ctx.read_MemA(tmp1, 4);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
+            m_ctx.writeRegularRegister(ins.t2, loaded_value);
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -1926,24 +2016,34 @@ bool ARMInterpreter::interpret_ldrd_register(const ARMInstruction &ins) {
 
 bool ARMInterpreter::interpret_ldrex(const ARMInstruction &ins) {
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
         address = (m_ctx.readRegularRegister(ins.n) + ins.imm32);
         SetExclusiveMonitors(address, 4);
-        m_ctx.writeRegularRegister(ins.t, m_ctx.read_MemA(address, 4));
+        loaded_value = m_ctx.read_MemA(address, 4);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, loaded_value);
     }
     return true;
 }
 
 bool ARMInterpreter::interpret_ldrexb(const ARMInstruction &ins) {
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
         address = m_ctx.readRegularRegister(ins.n);
         SetExclusiveMonitors(address, 1);
-        m_ctx.writeRegularRegister(ins.t, ZeroExtend(m_ctx.read_MemA(address, 1), 32));
+        loaded_value = m_ctx.read_MemA(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, ZeroExtend(loaded_value, 32));
     }
     return true;
 }
@@ -1957,6 +2057,9 @@ bool ARMInterpreter::interpret_ldrexd(const ARMInstruction &ins) {
         address = m_ctx.readRegularRegister(ins.n);
         SetExclusiveMonitors(address, 8);
         value = m_ctx.read_MemA(address, 8);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         m_ctx.writeRegularRegister(ins.t, ((BigEndian()) ? get_bits(value, 63, 32) : get_bits(value, 31, 0)));
         m_ctx.writeRegularRegister(ins.t2, ((BigEndian()) ? get_bits(value, 31, 0) : get_bits(value, 63, 32)));
     }
@@ -1965,12 +2068,17 @@ bool ARMInterpreter::interpret_ldrexd(const ARMInstruction &ins) {
 
 bool ARMInterpreter::interpret_ldrexh(const ARMInstruction &ins) {
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
         address = m_ctx.readRegularRegister(ins.n);
         SetExclusiveMonitors(address, 2);
-        m_ctx.writeRegularRegister(ins.t, ZeroExtend(m_ctx.read_MemA(address, 2), 32));
+        loaded_value = m_ctx.read_MemA(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, ZeroExtend(loaded_value, 32));
     }
     return true;
 }
@@ -1985,6 +2093,9 @@ bool ARMInterpreter::interpret_ldrh_immediate_thumb(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         data = m_ctx.read_MemU(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2006,6 +2117,9 @@ bool ARMInterpreter::interpret_ldrh_immediate_arm(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         data = m_ctx.read_MemU(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2028,6 +2142,9 @@ bool ARMInterpreter::interpret_ldrh_literal(const ARMInstruction &ins) {
         base = Align(m_ctx.readRegularRegister(15), 4);
         address = ((ins.add) ? (base + ins.imm32) : (base - ins.imm32));
         data = m_ctx.read_MemU(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if ((UnalignedSupport() || (get_bit(address, 0) == 0))) {
             m_ctx.writeRegularRegister(ins.t, ZeroExtend(data, 32));
         } else {
@@ -2045,10 +2162,13 @@ bool ARMInterpreter::interpret_ldrh_register(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         data = m_ctx.read_MemU(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2076,6 +2196,9 @@ bool ARMInterpreter::interpret_ldrht(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.postindex) ? m_ctx.readRegularRegister(ins.n) : offset_addr);
         data = m_ctx.read_MemU_unpriv(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.postindex) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2091,12 +2214,17 @@ bool ARMInterpreter::interpret_ldrht(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldrsb_immediate(const ARMInstruction &ins) {
     int offset_addr = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
-        m_ctx.writeRegularRegister(ins.t, SignExtend(m_ctx.read_MemU(address, 1), 8));
+        loaded_value = m_ctx.read_MemU(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, SignExtend(loaded_value, 8));
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2107,12 +2235,17 @@ bool ARMInterpreter::interpret_ldrsb_immediate(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_ldrsb_literal(const ARMInstruction &ins) {
     int base = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(15);
         base = Align(m_ctx.readRegularRegister(15), 4);
         address = ((ins.add) ? (base + ins.imm32) : (base - ins.imm32));
-        m_ctx.writeRegularRegister(ins.t, SignExtend(m_ctx.read_MemU(address, 1), 8));
+        loaded_value = m_ctx.read_MemU(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, SignExtend(loaded_value, 8));
     }
     return true;
 }
@@ -2121,13 +2254,18 @@ bool ARMInterpreter::interpret_ldrsb_register(const ARMInstruction &ins) {
     int offset = 0;
     int offset_addr = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
-        m_ctx.writeRegularRegister(ins.t, SignExtend(m_ctx.read_MemU(address, 1), 8));
+        loaded_value = m_ctx.read_MemU(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, SignExtend(loaded_value, 8));
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2139,6 +2277,7 @@ bool ARMInterpreter::interpret_ldrsbt(const ARMInstruction &ins) {
     int offset = 0;
     int offset_addr = 0;
     int address = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         if (unlikely(CurrentModeIsHyp())) {
@@ -2148,7 +2287,11 @@ bool ARMInterpreter::interpret_ldrsbt(const ARMInstruction &ins) {
         offset = ((ins.register_form) ? m_ctx.readRegularRegister(ins.m) : ins.imm32);
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.postindex) ? m_ctx.readRegularRegister(ins.n) : offset_addr);
-        m_ctx.writeRegularRegister(ins.t, SignExtend(m_ctx.read_MemU_unpriv(address, 1), 8));
+        loaded_value = m_ctx.read_MemU_unpriv(address, 1);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
+        m_ctx.writeRegularRegister(ins.t, SignExtend(loaded_value, 8));
         if (ins.postindex) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2166,6 +2309,9 @@ bool ARMInterpreter::interpret_ldrsh_immediate(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         data = m_ctx.read_MemU(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2188,6 +2334,9 @@ bool ARMInterpreter::interpret_ldrsh_literal(const ARMInstruction &ins) {
         base = Align(m_ctx.readRegularRegister(15), 4);
         address = ((ins.add) ? (base + ins.imm32) : (base - ins.imm32));
         data = m_ctx.read_MemU(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if ((UnalignedSupport() || (get_bit(address, 0) == 0))) {
             m_ctx.writeRegularRegister(ins.t, SignExtend(data, 16));
         } else {
@@ -2205,10 +2354,13 @@ bool ARMInterpreter::interpret_ldrsh_register(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         data = m_ctx.read_MemU(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2236,6 +2388,9 @@ bool ARMInterpreter::interpret_ldrsht(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.postindex) ? m_ctx.readRegularRegister(ins.n) : offset_addr);
         data = m_ctx.read_MemU_unpriv(address, 2);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.postindex) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2259,10 +2414,13 @@ bool ARMInterpreter::interpret_ldrt(const ARMInstruction &ins) {
             return false;
         }
         NullCheckIfThumbEE(ins.n);
-        offset = ((ins.register_form) ? Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C) : ins.imm32);
+        offset = ((ins.register_form) ? Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC()) : ins.imm32);
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.postindex) ? m_ctx.readRegularRegister(ins.n) : offset_addr);
         data = m_ctx.read_MemU_unpriv(address, 4);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.postindex) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -2284,15 +2442,13 @@ bool ARMInterpreter::interpret_lsl_immediate(const ARMInstruction &ins) {
     int carry = 0;
 
     if (ConditionPassed()) {
-        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_LSL, ins.shift_n, m_ctx.APSR.C);
+        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_LSL, ins.shift_n, m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -2306,12 +2462,10 @@ bool ARMInterpreter::interpret_lsl_register(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.m), 7, 0));
-        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.n), SRType_LSL, shift_n, m_ctx.APSR.C);
+        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.n), SRType_LSL, shift_n, m_ctx.flagC());
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -2322,15 +2476,13 @@ bool ARMInterpreter::interpret_lsr_immediate(const ARMInstruction &ins) {
     int carry = 0;
 
     if (ConditionPassed()) {
-        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_LSR, ins.shift_n, m_ctx.APSR.C);
+        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_LSR, ins.shift_n, m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -2344,12 +2496,10 @@ bool ARMInterpreter::interpret_lsr_register(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.m), 7, 0));
-        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.n), SRType_LSR, shift_n, m_ctx.APSR.C);
+        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.n), SRType_LSR, shift_n, m_ctx.flagC());
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -2383,6 +2533,7 @@ bool ARMInterpreter::interpret_mla(const ARMInstruction &ins) {
     int addend = 0;
     int result = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         operand1 = SInt(m_ctx.readRegularRegister(ins.n), 32);
         operand2 = SInt(m_ctx.readRegularRegister(ins.m), 32);
@@ -2426,9 +2577,7 @@ bool ARMInterpreter::interpret_mov_immediate(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = ExpandImm_C(ins.encoding, ins.imm12, m_ctx.APSR.C);
+                m_ctx.setFlagsNZC(result, ExpandImm_C(ins.encoding, ins.imm12, m_ctx.flagC()));
             }
         }
     }
@@ -2445,8 +2594,7 @@ bool ARMInterpreter::interpret_mov_register_thumb(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
+                m_ctx.setFlagsNZ(result);
             }
         }
     }
@@ -2463,8 +2611,7 @@ bool ARMInterpreter::interpret_mov_register_arm(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
+                m_ctx.setFlagsNZ(result);
             }
         }
     }
@@ -2485,6 +2632,7 @@ bool ARMInterpreter::interpret_movt(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_mrc_mrc2(const ARMInstruction &ins) {
     int value = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         if (!Coproc_Accepted(ins.cp, ThisInstr())) {
             GenerateCoprocessorException();
@@ -2520,6 +2668,7 @@ bool ARMInterpreter::interpret_mrrc_mrrc2(const ARMInstruction &ins) {
 }
 
 bool ARMInterpreter::interpret_mrs(const ARMInstruction &ins) {
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         m_ctx.writeRegularRegister(ins.d, m_ctx.APSR);
     }
@@ -2611,6 +2760,7 @@ bool ARMInterpreter::interpret_mrs_banked_register(const ARMInstruction &ins) {
 }
 
 bool ARMInterpreter::interpret_msr_immediate(const ARMInstruction &ins) {
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         if (ins.write_nzcvq) {
             m_ctx.APSR.N = get_bit(ins.imm32, 31);
@@ -2627,6 +2777,7 @@ bool ARMInterpreter::interpret_msr_immediate(const ARMInstruction &ins) {
 }
 
 bool ARMInterpreter::interpret_msr_register(const ARMInstruction &ins) {
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         if (ins.write_spsr) {
             SPSRWriteByInstr(m_ctx.readRegularRegister(ins.n), ins.mask);
@@ -2645,6 +2796,7 @@ bool ARMInterpreter::interpret_mul(const ARMInstruction &ins) {
     int operand2 = 0;
     int result = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         operand1 = SInt(m_ctx.readRegularRegister(ins.n), 32);
         operand2 = SInt(m_ctx.readRegularRegister(ins.m), 32);
@@ -2671,9 +2823,7 @@ bool ARMInterpreter::interpret_mvn_immediate(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = ExpandImm_C(ins.encoding, ins.imm12, m_ctx.APSR.C);
+                m_ctx.setFlagsNZC(result, ExpandImm_C(ins.encoding, ins.imm12, m_ctx.flagC()));
             }
         }
     }
@@ -2686,16 +2836,14 @@ bool ARMInterpreter::interpret_mvn_register(const ARMInstruction &ins) {
     int result = 0;
 
     if (ConditionPassed()) {
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         result = NOT(shifted, 32);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -2710,13 +2858,11 @@ bool ARMInterpreter::interpret_mvn_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         result = NOT(shifted, 32);
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -2736,9 +2882,7 @@ bool ARMInterpreter::interpret_orn_immediate(const ARMInstruction &ins) {
         result = (m_ctx.readRegularRegister(ins.n) | NOT(ins.imm32, 32));
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = ExpandImm_C(ins.encoding, ins.imm12, m_ctx.APSR.C);
+            m_ctx.setFlagsNZC(result, ExpandImm_C(ins.encoding, ins.imm12, m_ctx.flagC()));
         }
     }
     return true;
@@ -2750,13 +2894,11 @@ bool ARMInterpreter::interpret_orn_register(const ARMInstruction &ins) {
     int result = 0;
 
     if (ConditionPassed()) {
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) | NOT(shifted, 32));
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -2772,9 +2914,7 @@ bool ARMInterpreter::interpret_orr_immediate(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = ExpandImm_C(ins.encoding, ins.imm12, m_ctx.APSR.C);
+                m_ctx.setFlagsNZC(result, ExpandImm_C(ins.encoding, ins.imm12, m_ctx.flagC()));
             }
         }
     }
@@ -2787,16 +2927,14 @@ bool ARMInterpreter::interpret_orr_register(const ARMInstruction &ins) {
     int result = 0;
 
     if (ConditionPassed()) {
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) | shifted);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -2811,13 +2949,11 @@ bool ARMInterpreter::interpret_orr_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) | shifted);
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -2828,7 +2964,7 @@ bool ARMInterpreter::interpret_pkh(const ARMInstruction &ins) {
     int tmp_val = 0;
 
     if (ConditionPassed()) {
-        operand2 = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        operand2 = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         tmp_val = m_ctx.readRegularRegister(ins.d);
         set_bits(tmp_val, 15, 0, ((ins.tbform) ? get_bits(operand2, 15, 0) : get_bits(m_ctx.readRegularRegister(ins.n), 15, 0)));
         set_bits(tmp_val, 31, 16, ((ins.tbform) ? get_bits(m_ctx.readRegularRegister(ins.n), 31, 16) : get_bits(operand2, 31, 16)));
@@ -2866,7 +3002,7 @@ bool ARMInterpreter::interpret_pld_pldw_register(const ARMInstruction &ins) {
     int address = 0;
 
     if (ConditionPassed()) {
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         address = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         if (ins.is_pldw) {
             Hint_PreloadDataForWrite(address);
@@ -2894,7 +3030,7 @@ bool ARMInterpreter::interpret_pli_register(const ARMInstruction &ins) {
     int address = 0;
 
     if (ConditionPassed()) {
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         address = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         Hint_PreloadInstr(address);
     }
@@ -2904,13 +3040,18 @@ bool ARMInterpreter::interpret_pli_register(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_pop_thumb(const ARMInstruction &ins) {
     int address = 0;
     int i = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(13);
         address = m_ctx.readRegularRegister(13);
         for (i = 0; i < 14; ++i) {
             if ((get_bit(ins.registers, i) == 1)) {
-                m_ctx.writeRegularRegister(i, ((ins.UnalignedAllowed) ? m_ctx.read_MemU(address, 4) : m_ctx.read_MemA(address, 4)));
+                loaded_value = ((ins.UnalignedAllowed) ? m_ctx.read_MemU(address, 4) : m_ctx.read_MemA(address, 4));
+                if (m_ctx.hasMemoryFault()) {
+                    return true;
+                }
+                m_ctx.writeRegularRegister(i, loaded_value);
                 address = (address + 4);
             }
         }
@@ -2918,12 +3059,20 @@ bool ARMInterpreter::interpret_pop_thumb(const ARMInstruction &ins) {
         if ((get_bit(ins.registers, 15) == 1)) {
             if (ins.UnalignedAllowed) {
                 if ((get_bits(address, 1, 0) == 0)) {
-                    LoadWritePC(m_ctx.read_MemU(address, 4));
+                    loaded_value = m_ctx.read_MemU(address, 4);
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
+                    LoadWritePC(loaded_value);
                 } else {
                     return false;
                 }
             } else {
-                LoadWritePC(m_ctx.read_MemA(address, 4));
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    return true;
+                }
+                LoadWritePC(loaded_value);
             }
         }
         if ((get_bit(ins.registers, 13) == 0)) {
@@ -2939,13 +3088,18 @@ bool ARMInterpreter::interpret_pop_thumb(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_pop_arm(const ARMInstruction &ins) {
     int address = 0;
     int i = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(13);
         address = m_ctx.readRegularRegister(13);
         for (i = 0; i < 14; ++i) {
             if ((get_bit(ins.registers, i) == 1)) {
-                m_ctx.writeRegularRegister(i, ((ins.UnalignedAllowed) ? m_ctx.read_MemU(address, 4) : m_ctx.read_MemA(address, 4)));
+                loaded_value = ((ins.UnalignedAllowed) ? m_ctx.read_MemU(address, 4) : m_ctx.read_MemA(address, 4));
+                if (m_ctx.hasMemoryFault()) {
+                    return true;
+                }
+                m_ctx.writeRegularRegister(i, loaded_value);
                 address = (address + 4);
             }
         }
@@ -2953,12 +3107,20 @@ bool ARMInterpreter::interpret_pop_arm(const ARMInstruction &ins) {
         if ((get_bit(ins.registers, 15) == 1)) {
             if (ins.UnalignedAllowed) {
                 if ((get_bits(address, 1, 0) == 0)) {
-                    LoadWritePC(m_ctx.read_MemU(address, 4));
+                    loaded_value = m_ctx.read_MemU(address, 4);
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
+                    LoadWritePC(loaded_value);
                 } else {
                     return false;
                 }
             } else {
-                LoadWritePC(m_ctx.read_MemA(address, 4));
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    return true;
+                }
+                LoadWritePC(loaded_value);
             }
         }
         if ((get_bit(ins.registers, 13) == 0)) {
@@ -2982,11 +3144,20 @@ bool ARMInterpreter::interpret_push(const ARMInstruction &ins) {
             if ((get_bit(ins.registers, i) == 1)) {
                 if (((i == 13) && (i != LowestSetBit(ins.registers)))) {
                     m_ctx.write_MemA(address, 4, UNKNOWN_VALUE);
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
                 } else {
                     if (ins.UnalignedAllowed) {
                         m_ctx.write_MemU(address, 4, m_ctx.readRegularRegister(i));
+                        if (m_ctx.hasMemoryFault()) {
+                            return true;
+                        }
                     } else {
                         m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(i));
+                        if (m_ctx.hasMemoryFault()) {
+                            return true;
+                        }
                     }
                 }
                 address = (address + 4);
@@ -2996,8 +3167,14 @@ bool ARMInterpreter::interpret_push(const ARMInstruction &ins) {
         if ((get_bit(ins.registers, 15) == 1)) {
             if (ins.UnalignedAllowed) {
                 m_ctx.write_MemU(address, 4, PCStoreValue());
+                if (m_ctx.hasMemoryFault()) {
+                    return true;
+                }
             } else {
                 m_ctx.write_MemA(address, 4, PCStoreValue());
+                if (m_ctx.hasMemoryFault()) {
+                    return true;
+                }
             }
         }
         m_ctx.writeRegularRegister(13, (m_ctx.readRegularRegister(13) - (4 * BitCount(ins.registers))));
@@ -3234,7 +3411,10 @@ bool ARMInterpreter::interpret_rfe(const ARMInstruction &ins) {
     int address = 0;
     int new_pc_value = 0;
     int tmp = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         if (unlikely(CurrentModeIsHyp())) {
             return false;
@@ -3250,8 +3430,17 @@ bool ARMInterpreter::interpret_rfe(const ARMInstruction &ins) {
                 m_ctx.writeRegularRegister(ins.n, ((ins.increment) ? (m_ctx.readRegularRegister(ins.n) + 8) : (m_ctx.readRegularRegister(ins.n) - 8)));
             }
             new_pc_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
             tmp = (address + 4);
-            CPSRWriteByInstr(m_ctx.read_MemA(tmp, 4), 15, true);
+            loaded_value = m_ctx.read_MemA(tmp, 4);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            CPSRWriteByInstr(loaded_value, 15, true);
             if (unlikely((((get_bits(m_ctx.CPSR, 4, 0) == 26) && (m_ctx.CPSR.J == 1)) && (m_ctx.CPSR.T == 1)))) {
                 return false;
             } else {
@@ -3267,15 +3456,13 @@ bool ARMInterpreter::interpret_ror_immediate(const ARMInstruction &ins) {
     int carry = 0;
 
     if (ConditionPassed()) {
-        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_ROR, ins.shift_n, m_ctx.APSR.C);
+        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_ROR, ins.shift_n, m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -3289,12 +3476,10 @@ bool ARMInterpreter::interpret_ror_register(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.m), 7, 0));
-        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.n), SRType_ROR, shift_n, m_ctx.APSR.C);
+        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.n), SRType_ROR, shift_n, m_ctx.flagC());
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
+            m_ctx.setFlagsNZC(result, carry);
         }
     }
     return true;
@@ -3305,15 +3490,13 @@ bool ARMInterpreter::interpret_rrx(const ARMInstruction &ins) {
     int carry = 0;
 
     if (ConditionPassed()) {
-        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_RRX, 1, m_ctx.APSR.C);
+        std::tie(result, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), SRType_RRX, 1, m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
+                m_ctx.setFlagsNZC(result, carry);
             }
         }
     }
@@ -3332,10 +3515,7 @@ bool ARMInterpreter::interpret_rsb_immediate(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -3349,17 +3529,14 @@ bool ARMInterpreter::interpret_rsb_register(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(NOT(m_ctx.readRegularRegister(ins.n), 32), shifted, 1);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -3375,14 +3552,11 @@ bool ARMInterpreter::interpret_rsb_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(NOT(m_ctx.readRegularRegister(ins.n), 32), shifted, 1);
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
-            m_ctx.APSR.V = overflow;
+            m_ctx.setFlagsNZCV(result, carry, overflow);
         }
     }
     return true;
@@ -3394,16 +3568,13 @@ bool ARMInterpreter::interpret_rsc_immediate(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        std::tie(result, carry, overflow) = AddWithCarry(NOT(m_ctx.readRegularRegister(ins.n), 32), ins.imm32, m_ctx.APSR.C);
+        std::tie(result, carry, overflow) = AddWithCarry(NOT(m_ctx.readRegularRegister(ins.n), 32), ins.imm32, m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -3417,17 +3588,14 @@ bool ARMInterpreter::interpret_rsc_register(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
-        std::tie(result, carry, overflow) = AddWithCarry(NOT(m_ctx.readRegularRegister(ins.n), 32), shifted, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
+        std::tie(result, carry, overflow) = AddWithCarry(NOT(m_ctx.readRegularRegister(ins.n), 32), shifted, m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -3443,14 +3611,11 @@ bool ARMInterpreter::interpret_rsc_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
-        std::tie(result, carry, overflow) = AddWithCarry(NOT(m_ctx.readRegularRegister(ins.n), 32), shifted, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
+        std::tie(result, carry, overflow) = AddWithCarry(NOT(m_ctx.readRegularRegister(ins.n), 32), shifted, m_ctx.flagC());
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
-            m_ctx.APSR.V = overflow;
+            m_ctx.setFlagsNZCV(result, carry, overflow);
         }
     }
     return true;
@@ -3530,16 +3695,13 @@ bool ARMInterpreter::interpret_sbc_immediate(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(ins.imm32, 32), m_ctx.APSR.C);
+        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(ins.imm32, 32), m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -3553,17 +3715,14 @@ bool ARMInterpreter::interpret_sbc_register(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
-        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(shifted, 32), m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
+        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(shifted, 32), m_ctx.flagC());
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -3579,14 +3738,11 @@ bool ARMInterpreter::interpret_sbc_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
-        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(shifted, 32), m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
+        std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(shifted, 32), m_ctx.flagC());
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
-            m_ctx.APSR.V = overflow;
+            m_ctx.setFlagsNZCV(result, carry, overflow);
         }
     }
     return true;
@@ -3825,6 +3981,7 @@ bool ARMInterpreter::interpret_smlad(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_smlal(const ARMInstruction &ins) {
     int result = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         result = ((SInt(m_ctx.readRegularRegister(ins.n), 32) * SInt(m_ctx.readRegularRegister(ins.m), 32)) + SInt(Concatenate(m_ctx.readRegularRegister(ins.dHi), m_ctx.readRegularRegister(ins.dLo), 32), 64));
         m_ctx.writeRegularRegister(ins.dHi, get_bits(result, 63, 32));
@@ -3999,6 +4156,7 @@ bool ARMInterpreter::interpret_smulbb_smulbt_smultb_smultt(const ARMInstruction
 bool ARMInterpreter::interpret_smull(const ARMInstruction &ins) {
     int result = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         result = (SInt(m_ctx.readRegularRegister(ins.n), 32) * SInt(m_ctx.readRegularRegister(ins.m), 32));
         m_ctx.writeRegularRegister(ins.dHi, get_bits(result, 63, 32));
@@ -4070,7 +4228,13 @@ bool ARMInterpreter::interpret_srs_thumb(const ARMInstruction &ins) {
             }
             tmp = (address + 4);
             m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(14));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.write_MemA(tmp, 4, m_ctx.SPSR);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             if (ins.wback) {
                 m_ctx.writeRmode(13, ins.mode, ((ins.increment) ? (base + 8) : (base - 8)));
             }
@@ -4106,7 +4270,13 @@ bool ARMInterpreter::interpret_srs_arm(const ARMInstruction &ins) {
             }
             tmp = (address + 4);
             m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(14));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.write_MemA(tmp, 4, m_ctx.SPSR);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             if (ins.wback) {
                 m_ctx.writeRmode(13, ins.mode, ((ins.increment) ? (base + 8) : (base - 8)));
             }
@@ -4121,7 +4291,7 @@ bool ARMInterpreter::interpret_ssat(const ARMInstruction &ins) {
     int sat = 0;
 
     if (ConditionPassed()) {
-        operand = Shift(m_ctx.readRegularRegister(ins.n), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        operand = Shift(m_ctx.readRegularRegister(ins.n), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, sat) = SignedSatQ(SInt(operand, 32), ins.saturate_to);
         m_ctx.writeRegularRegister(ins.d, SignExtend(result, ins.saturate_to));
         if (sat) {
@@ -4233,6 +4403,9 @@ bool ARMInterpreter::interpret_stc_stc2(const ARMInstruction &ins) {
             address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
             do {
                 m_ctx.write_MemA(address, 4, Coproc_GetWordToStore(ins.cp, ThisInstr()));
+                if (m_ctx.hasMemoryFault()) {
+                    return true;
+                }
             } while (Coproc_DoneStoring(ins.cp, ThisInstr()));
             
             if (ins.wback) {
@@ -4254,8 +4427,14 @@ bool ARMInterpreter::interpret_stm_stmia_stmea(const ARMInstruction &ins) {
             if ((get_bit(ins.registers, i) == 1)) {
                 if ((((i == ins.n) && ins.wback) && (i != LowestSetBit(ins.registers)))) {
                     m_ctx.write_MemA(address, 4, UNKNOWN_VALUE);
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
                 } else {
                     m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(i));
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
                 }
                 address = (address + 4);
             }
@@ -4263,6 +4442,9 @@ bool ARMInterpreter::interpret_stm_stmia_stmea(const ARMInstruction &ins) {
         
         if ((get_bit(ins.registers, 15) == 1)) {
             m_ctx.write_MemA(address, 4, PCStoreValue());
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + (4 * BitCount(ins.registers))));
@@ -4281,8 +4463,14 @@ bool ARMInterpreter::interpret_stmda_stmed(const ARMInstruction &ins) {
             if ((get_bit(ins.registers, i) == 1)) {
                 if ((((i == ins.n) && ins.wback) && (i != LowestSetBit(ins.registers)))) {
                     m_ctx.write_MemA(address, 4, UNKNOWN_VALUE);
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
                 } else {
                     m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(i));
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
                 }
                 address = (address + 4);
             }
@@ -4290,6 +4478,9 @@ bool ARMInterpreter::interpret_stmda_stmed(const ARMInstruction &ins) {
         
         if ((get_bit(ins.registers, 15) == 1)) {
             m_ctx.write_MemA(address, 4, PCStoreValue());
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) - (4 * BitCount(ins.registers))));
@@ -4309,8 +4500,14 @@ bool ARMInterpreter::interpret_stmdb_stmfd(const ARMInstruction &ins) {
             if ((get_bit(ins.registers, i) == 1)) {
                 if ((((i == ins.n) && ins.wback) && (i != LowestSetBit(ins.registers)))) {
                     m_ctx.write_MemA(address, 4, UNKNOWN_VALUE);
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
                 } else {
                     m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(i));
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
                 }
                 address = (address + 4);
             }
@@ -4318,6 +4515,9 @@ bool ARMInterpreter::interpret_stmdb_stmfd(const ARMInstruction &ins) {
         
         if ((get_bit(ins.registers, 15) == 1)) {
             m_ctx.write_MemA(address, 4, PCStoreValue());
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) - (4 * BitCount(ins.registers))));
@@ -4336,8 +4536,14 @@ bool ARMInterpreter::interpret_stmib_stmfa(const ARMInstruction &ins) {
             if ((get_bit(ins.registers, i) == 1)) {
                 if ((((i == ins.n) && ins.wback) && (i != LowestSetBit(ins.registers)))) {
                     m_ctx.write_MemA(address, 4, UNKNOWN_VALUE);
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
                 } else {
                     m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(i));
+                    if (m_ctx.hasMemoryFault()) {
+                        return true;
+                    }
                 }
                 address = (address + 4);
             }
@@ -4345,6 +4551,9 @@ bool ARMInterpreter::interpret_stmib_stmfa(const ARMInstruction &ins) {
         
         if ((get_bit(ins.registers, 15) == 1)) {
             m_ctx.write_MemA(address, 4, PCStoreValue());
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + (4 * BitCount(ins.registers))));
@@ -4363,8 +4572,14 @@ bool ARMInterpreter::interpret_str_immediate_thumb(const ARMInstruction &ins) {
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         if ((UnalignedSupport() || (get_bits(address, 1, 0) == 0))) {
             m_ctx.write_MemU(address, 4, m_ctx.readRegularRegister(ins.t));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             m_ctx.write_MemU(address, 4, UNKNOWN_VALUE);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -4381,6 +4596,9 @@ bool ARMInterpreter::interpret_str_immediate_arm(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         m_ctx.write_MemU(address, 4, (((ins.t == 15)) ? PCStoreValue() : m_ctx.readRegularRegister(ins.t)));
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -4396,7 +4614,7 @@ bool ARMInterpreter::interpret_str_register(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         if ((ins.t == 15)) {
@@ -4406,8 +4624,14 @@ bool ARMInterpreter::interpret_str_register(const ARMInstruction &ins) {
         }
         if (((UnalignedSupport() || (get_bits(address, 1, 0) == 0)) || (CurrentInstrSet() == InstrSet_ARM))) {
             m_ctx.write_MemU(address, 4, data);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             m_ctx.write_MemU(address, 4, UNKNOWN_VALUE);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -4425,6 +4649,9 @@ bool ARMInterpreter::interpret_strb_immediate_thumb(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         m_ctx.write_MemU(address, 1, get_bits(m_ctx.readRegularRegister(ins.t), 7, 0));
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -4440,6 +4667,9 @@ bool ARMInterpreter::interpret_strb_immediate_arm(const ARMInstruction &ins) {
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         m_ctx.write_MemU(address, 1, get_bits(m_ctx.readRegularRegister(ins.t), 7, 0));
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -4454,10 +4684,13 @@ bool ARMInterpreter::interpret_strb_register(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         m_ctx.write_MemU(address, 1, get_bits(m_ctx.readRegularRegister(ins.t), 7, 0));
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -4475,10 +4708,13 @@ bool ARMInterpreter::interpret_strbt(const ARMInstruction &ins) {
             return false;
         }
         NullCheckIfThumbEE(ins.n);
-        offset = ((ins.register_form) ? Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C) : ins.imm32);
+        offset = ((ins.register_form) ? Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC()) : ins.imm32);
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.postindex) ? m_ctx.readRegularRegister(ins.n) : offset_addr);
         m_ctx.write_MemU_unpriv(address, 1, get_bits(m_ctx.readRegularRegister(ins.t), 7, 0));
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if (ins.postindex) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
         }
@@ -4506,10 +4742,19 @@ bool ARMInterpreter::interpret_strd_immediate(const ARMInstruction &ins) {
                 set_bits(data, 63, 32, m_ctx.readRegularRegister(ins.t2));
             }
             m_ctx.write_MemA(address, 8, data);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             tmp = (address + 4);
             m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(ins.t));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.write_MemA(tmp, 4, m_ctx.readRegularRegister(ins.t2));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -4537,10 +4782,19 @@ bool ARMInterpreter::interpret_strd_register(const ARMInstruction &ins) {
                 set_bits(data, 63, 32, m_ctx.readRegularRegister(ins.t2));
             }
             m_ctx.write_MemA(address, 8, data);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             tmp = (address + 4);
             m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(ins.t));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.write_MemA(tmp, 4, m_ctx.readRegularRegister(ins.t2));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -4557,6 +4811,9 @@ bool ARMInterpreter::interpret_strex(const ARMInstruction &ins) {
         address = (m_ctx.readRegularRegister(ins.n) + ins.imm32);
         if (ExclusiveMonitorsPass(address, 4)) {
             m_ctx.write_MemA(address, 4, m_ctx.readRegularRegister(ins.t));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.writeRegularRegister(ins.d, 0);
         } else {
             m_ctx.writeRegularRegister(ins.d, 1);
@@ -4573,6 +4830,9 @@ bool ARMInterpreter::interpret_strexb(const ARMInstruction &ins) {
         address = m_ctx.readRegularRegister(ins.n);
         if (ExclusiveMonitorsPass(address, 1)) {
             m_ctx.write_MemA(address, 1, m_ctx.readRegularRegister(ins.t));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.writeRegularRegister(ins.d, 0);
         } else {
             m_ctx.writeRegularRegister(ins.d, 1);
@@ -4591,6 +4851,9 @@ bool ARMInterpreter::interpret_strexd(const ARMInstruction &ins) {
         value = ((BigEndian()) ? Concatenate(m_ctx.readRegularRegister(ins.t), m_ctx.readRegularRegister(ins.t2), 32) : Concatenate(m_ctx.readRegularRegister(ins.t2), m_ctx.readRegularRegister(ins.t), 32));
         if (ExclusiveMonitorsPass(address, 8)) {
             m_ctx.write_MemA(address, 8, value);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.writeRegularRegister(ins.d, 0);
         } else {
             m_ctx.writeRegularRegister(ins.d, 1);
@@ -4607,6 +4870,9 @@ bool ARMInterpreter::interpret_strexh(const ARMInstruction &ins) {
         address = m_ctx.readRegularRegister(ins.n);
         if (ExclusiveMonitorsPass(address, 2)) {
             m_ctx.write_MemA(address, 2, m_ctx.readRegularRegister(ins.t));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.writeRegularRegister(ins.d, 0);
         } else {
             m_ctx.writeRegularRegister(ins.d, 1);
@@ -4625,8 +4891,14 @@ bool ARMInterpreter::interpret_strh_immediate_thumb(const ARMInstruction &ins) {
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         if ((UnalignedSupport() || (get_bit(address, 0) == 0))) {
             m_ctx.write_MemU(address, 2, get_bits(m_ctx.readRegularRegister(ins.t), 15, 0));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             m_ctx.write_MemU(address, 2, UNKNOWN_VALUE);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -4644,8 +4916,14 @@ bool ARMInterpreter::interpret_strh_immediate_arm(const ARMInstruction &ins) {
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         if ((UnalignedSupport() || (get_bit(address, 0) == 0))) {
             m_ctx.write_MemU(address, 2, get_bits(m_ctx.readRegularRegister(ins.t), 15, 0));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             m_ctx.write_MemU(address, 2, UNKNOWN_VALUE);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -4661,13 +4939,19 @@ bool ARMInterpreter::interpret_strh_register(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         NullCheckIfThumbEE(ins.n);
-        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        offset = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.index) ? offset_addr : m_ctx.readRegularRegister(ins.n));
         if ((UnalignedSupport() || (get_bit(address, 0) == 0))) {
             m_ctx.write_MemU(address, 2, get_bits(m_ctx.readRegularRegister(ins.t), 15, 0));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             m_ctx.write_MemU(address, 2, UNKNOWN_VALUE);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -4691,8 +4975,14 @@ bool ARMInterpreter::interpret_strht(const ARMInstruction &ins) {
         address = ((ins.postindex) ? m_ctx.readRegularRegister(ins.n) : offset_addr);
         if ((UnalignedSupport() || (get_bit(address, 0) == 0))) {
             m_ctx.write_MemU_unpriv(address, 2, get_bits(m_ctx.readRegularRegister(ins.t), 15, 0));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             m_ctx.write_MemU_unpriv(address, 2, UNKNOWN_VALUE);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.postindex) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -4712,7 +5002,7 @@ bool ARMInterpreter::interpret_strt(const ARMInstruction &ins) {
             return false;
         }
         NullCheckIfThumbEE(ins.n);
-        offset = ((ins.register_form) ? Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C) : ins.imm32);
+        offset = ((ins.register_form) ? Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC()) : ins.imm32);
         offset_addr = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + offset) : (m_ctx.readRegularRegister(ins.n) - offset));
         address = ((ins.postindex) ? m_ctx.readRegularRegister(ins.n) : offset_addr);
         if ((ins.t == 15)) {
@@ -4722,8 +5012,14 @@ bool ARMInterpreter::interpret_strt(const ARMInstruction &ins) {
         }
         if (((UnalignedSupport() || (get_bits(address, 1, 0) == 0)) || (CurrentInstrSet() == InstrSet_ARM))) {
             m_ctx.write_MemU_unpriv(address, 4, data);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             m_ctx.write_MemU_unpriv(address, 4, UNKNOWN_VALUE);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
         if (ins.postindex) {
             m_ctx.writeRegularRegister(ins.n, offset_addr);
@@ -4741,10 +5037,7 @@ bool ARMInterpreter::interpret_sub_immediate_thumb(const ARMInstruction &ins) {
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(ins.imm32, 32), 1);
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
-            m_ctx.APSR.V = overflow;
+            m_ctx.setFlagsNZCV(result, carry, overflow);
         }
     }
     return true;
@@ -4762,10 +5055,7 @@ bool ARMInterpreter::interpret_sub_immediate_arm(const ARMInstruction &ins) {
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -4779,17 +5069,14 @@ bool ARMInterpreter::interpret_sub_register(const ARMInstruction &ins) {
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(shifted, 32), 1);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -4805,14 +5092,11 @@ bool ARMInterpreter::interpret_sub_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(ins.n), NOT(shifted, 32), 1);
         m_ctx.writeRegularRegister(ins.d, result);
         if (ins.setflags) {
-            m_ctx.APSR.N = get_bit(result, 31);
-            m_ctx.APSR.Z = IsZeroBit(result);
-            m_ctx.APSR.C = carry;
-            m_ctx.APSR.V = overflow;
+            m_ctx.setFlagsNZCV(result, carry, overflow);
         }
     }
     return true;
@@ -4830,10 +5114,7 @@ bool ARMInterpreter::interpret_sub_sp_minus_immediate(const ARMInstruction &ins)
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -4847,17 +5128,14 @@ bool ARMInterpreter::interpret_sub_sp_minus_register(const ARMInstruction &ins)
     int overflow = 0;
 
     if (ConditionPassed()) {
-        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        shifted = Shift(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, carry, overflow) = AddWithCarry(m_ctx.readRegularRegister(13), NOT(shifted, 32), 1);
         if ((ins.d == 15)) {
             m_ctx.ALUWritePC(result);
         } else {
             m_ctx.writeRegularRegister(ins.d, result);
             if (ins.setflags) {
-                m_ctx.APSR.N = get_bit(result, 31);
-                m_ctx.APSR.Z = IsZeroBit(result);
-                m_ctx.APSR.C = carry;
-                m_ctx.APSR.V = overflow;
+                m_ctx.setFlagsNZCV(result, carry, overflow);
             }
         }
     }
@@ -4870,6 +5148,7 @@ bool ARMInterpreter::interpret_subs_pc_lr_thumb(const ARMInstruction &ins) {
     int ignored_1 = 0;
     int ignored_2 = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         if (unlikely((CurrentModeIsUserOrSystem() || (CurrentInstrSet() == InstrSet_ThumbEE)))) {
             return false;
@@ -4893,6 +5172,7 @@ bool ARMInterpreter::interpret_subs_pc_lr_and_related_instructions_arm(const ARM
     int ignored_1 = 0;
     int ignored_2 = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         if (unlikely(CurrentModeIsHyp())) {
             return false;
@@ -4981,8 +5261,14 @@ bool ARMInterpreter::interpret_swp_swpb(const ARMInstruction &ins) {
         }
         val = m_ctx.readRegularRegister(ins.n);
         data = m_ctx.read_MemA(val, ins.size);
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         tmp = ((8 * ins.size) - 1);
         m_ctx.write_MemA(val, ins.size, get_bits(m_ctx.readRegularRegister(ins.t2), tmp, 0));
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         if ((ins.size == 1)) {
             m_ctx.writeRegularRegister(ins.t, ZeroExtend(data, 32));
         } else {
@@ -5068,6 +5354,9 @@ bool ARMInterpreter::interpret_tbb(const ARMInstruction &ins) {
         NullCheckIfThumbEE(ins.n);
         tmp = (m_ctx.readRegularRegister(ins.n) + m_ctx.readRegularRegister(ins.m));
         halfwords = UInt(m_ctx.read_MemU(tmp, 1));
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         BranchWritePC((m_ctx.readRegularRegister(15) + (2 * halfwords)));
     }
     return true;
@@ -5081,6 +5370,9 @@ bool ARMInterpreter::interpret_tbh(const ARMInstruction &ins) {
         NullCheckIfThumbEE(ins.n);
         tmp = (m_ctx.readRegularRegister(ins.n) + LSL(m_ctx.readRegularRegister(ins.m), 1));
         halfwords = UInt(m_ctx.read_MemU(tmp, 2));
+        if (m_ctx.hasMemoryFault()) {
+            return true;
+        }
         BranchWritePC((m_ctx.readRegularRegister(15) + (2 * halfwords)));
     }
     return true;
@@ -5091,9 +5383,7 @@ bool ARMInterpreter::interpret_teq_immediate(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         result = (m_ctx.readRegularRegister(ins.n) ^ ins.imm32);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = ExpandImm_C(ins.encoding, ins.imm12, m_ctx.APSR.C);
+        m_ctx.setFlagsNZC(result, ExpandImm_C(ins.encoding, ins.imm12, m_ctx.flagC()));
     }
     return true;
 }
@@ -5104,11 +5394,9 @@ bool ARMInterpreter::interpret_teq_register(const ARMInstruction &ins) {
     int result = 0;
 
     if (ConditionPassed()) {
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) ^ shifted);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
+        m_ctx.setFlagsNZC(result, carry);
     }
     return true;
 }
@@ -5121,11 +5409,9 @@ bool ARMInterpreter::interpret_teq_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) ^ shifted);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
+        m_ctx.setFlagsNZC(result, carry);
     }
     return true;
 }
@@ -5135,9 +5421,7 @@ bool ARMInterpreter::interpret_tst_immediate(const ARMInstruction &ins) {
 
     if (ConditionPassed()) {
         result = (m_ctx.readRegularRegister(ins.n) & ins.imm32);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = ExpandImm_C(ins.encoding, ins.imm12, m_ctx.APSR.C);
+        m_ctx.setFlagsNZC(result, ExpandImm_C(ins.encoding, ins.imm12, m_ctx.flagC()));
     }
     return true;
 }
@@ -5148,11 +5432,9 @@ bool ARMInterpreter::interpret_tst_register(const ARMInstruction &ins) {
     int result = 0;
 
     if (ConditionPassed()) {
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, ins.shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) & shifted);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
+        m_ctx.setFlagsNZC(result, carry);
     }
     return true;
 }
@@ -5165,11 +5447,9 @@ bool ARMInterpreter::interpret_tst_register_shifted_register(const ARMInstructio
 
     if (ConditionPassed()) {
         shift_n = UInt(get_bits(m_ctx.readRegularRegister(ins.s), 7, 0));
-        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.APSR.C);
+        std::tie(shifted, carry) = Shift_C(m_ctx.readRegularRegister(ins.m), ins.shift_t, shift_n, m_ctx.flagC());
         result = (m_ctx.readRegularRegister(ins.n) & shifted);
-        m_ctx.APSR.N = get_bit(result, 31);
-        m_ctx.APSR.Z = IsZeroBit(result);
-        m_ctx.APSR.C = carry;
+        m_ctx.setFlagsNZC(result, carry);
     }
     return true;
 }
@@ -5403,6 +5683,7 @@ bool ARMInterpreter::interpret_umaal(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_umlal(const ARMInstruction &ins) {
     int result = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         result = ((UInt(m_ctx.readRegularRegister(ins.n)) * UInt(m_ctx.readRegularRegister(ins.m))) + UInt(Concatenate(m_ctx.readRegularRegister(ins.dHi), m_ctx.readRegularRegister(ins.dLo), 32)));
         m_ctx.writeRegularRegister(ins.dHi, get_bits(result, 63, 32));
@@ -5422,6 +5703,7 @@ bool ARMInterpreter::interpret_umlal(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_umull(const ARMInstruction &ins) {
     int result = 0;
 
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         result = (UInt(m_ctx.readRegularRegister(ins.n)) * UInt(m_ctx.readRegularRegister(ins.m)));
         m_ctx.writeRegularRegister(ins.dHi, get_bits(result, 63, 32));
@@ -5588,7 +5870,7 @@ bool ARMInterpreter::interpret_usat(const ARMInstruction &ins) {
     int sat = 0;
 
     if (ConditionPassed()) {
-        operand = Shift(m_ctx.readRegularRegister(ins.n), ins.shift_t, ins.shift_n, m_ctx.APSR.C);
+        operand = Shift(m_ctx.readRegularRegister(ins.n), ins.shift_t, ins.shift_n, m_ctx.flagC());
         std::tie(result, sat) = UnsignedSatQ(SInt(operand, 32), ins.saturate_to);
         m_ctx.writeRegularRegister(ins.d, ZeroExtend(result, 32));
         if (sat) {
@@ -6687,6 +6969,7 @@ bool ARMInterpreter::interpret_vld1_multiple_single_elements(const ARMInstructio
     int data = 0;
     int r = 0;
     int e = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6703,9 +6986,21 @@ bool ARMInterpreter::interpret_vld1_multiple_single_elements(const ARMInstructio
             for (e = 0; e < (ins.elements - 1); ++e) {
                 if ((ins.ebytes != 8)) {
                     set_bits(data, (ins.esize - 1), 0, m_ctx.read_MemU(address, ins.ebytes));
+                    if (m_ctx.hasMemoryFault()) {
+                        m_ctx.writeRegularRegister(ins.n, saved_base);
+                        return true;
+                    }
                 } else {
                     set_bits(data, 31, 0, ((BigEndian()) ? m_ctx.read_MemU((address + 4), 4) : m_ctx.read_MemU(address, 4)));
+                    if (m_ctx.hasMemoryFault()) {
+                        m_ctx.writeRegularRegister(ins.n, saved_base);
+                        return true;
+                    }
                     set_bits(data, 63, 32, ((BigEndian()) ? m_ctx.read_MemU(address, 4) : m_ctx.read_MemU((address + 4), 4)));
+                    if (m_ctx.hasMemoryFault()) {
+                        m_ctx.writeRegularRegister(ins.n, saved_base);
+                        return true;
+                    }
                 }
                 m_ctx.writeElement(m_ctx.readDoubleRegister((ins.d + r)), e, ins.esize, get_bits(data, (ins.esize - 1), 0));
                 address = (address + ins.ebytes);
@@ -6719,6 +7014,8 @@ bool ARMInterpreter::interpret_vld1_multiple_single_elements(const ARMInstructio
 
 bool ARMInterpreter::interpret_vld1_single_element_to_one_lane(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6730,7 +7027,12 @@ bool ARMInterpreter::interpret_vld1_single_element_to_one_lane(const ARMInstruct
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : ins.ebytes)));
         }
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize, m_ctx.read_MemU(address, ins.ebytes));
+        loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize, loaded_value);
     }
     return true;
 }
@@ -6739,6 +7041,7 @@ bool ARMInterpreter::interpret_vld1_single_element_to_all_lanes(const ARMInstruc
     int address = 0;
     int replicated_element = 0;
     int r = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6751,6 +7054,10 @@ bool ARMInterpreter::interpret_vld1_single_element_to_all_lanes(const ARMInstruc
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : ins.ebytes)));
         }
         replicated_element = Replicate(m_ctx.read_MemU(address, ins.ebytes), ins.elements);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
         for (r = 0; r < (ins.regs - 1); ++r) {
             m_ctx.writeDoubleRegister((ins.d + r), replicated_element);
         }
@@ -6763,6 +7070,8 @@ bool ARMInterpreter::interpret_vld2_multiple_2_element_structures(const ARMInstr
     int address = 0;
     int r = 0;
     int e = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6776,8 +7085,18 @@ bool ARMInterpreter::interpret_vld2_multiple_2_element_structures(const ARMInstr
         }
         for (r = 0; r < (ins.regs - 1); ++r) {
             for (e = 0; e < (ins.elements - 1); ++e) {
-                m_ctx.writeElement(m_ctx.readDoubleRegister((ins.d + r)), e, ins.esize, m_ctx.read_MemU(address, ins.ebytes));
-                m_ctx.writeElement(m_ctx.readDoubleRegister((ins.d2 + r)), e, ins.esize, m_ctx.read_MemU((address + ins.ebytes), ins.ebytes));
+                loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
+                m_ctx.writeElement(m_ctx.readDoubleRegister((ins.d + r)), e, ins.esize, loaded_value);
+                loaded_value = m_ctx.read_MemU((address + ins.ebytes), ins.ebytes);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
+                m_ctx.writeElement(m_ctx.readDoubleRegister((ins.d2 + r)), e, ins.esize, loaded_value);
                 address = (address + (2 * ins.ebytes));
             }
             
@@ -6789,6 +7108,8 @@ bool ARMInterpreter::interpret_vld2_multiple_2_element_structures(const ARMInstr
 
 bool ARMInterpreter::interpret_vld2_single_2_element_structure_to_one_lane(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6800,14 +7121,26 @@ bool ARMInterpreter::interpret_vld2_single_2_element_structure_to_one_lane(const
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : (2 * ins.ebytes))));
         }
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize, m_ctx.read_MemU(address, ins.ebytes));
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), ins.index, ins.esize, m_ctx.read_MemU((address + ins.ebytes), ins.ebytes));
+        loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize, loaded_value);
+        loaded_value = m_ctx.read_MemU((address + ins.ebytes), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), ins.index, ins.esize, loaded_value);
     }
     return true;
 }
 
 bool ARMInterpreter::interpret_vld2_single_2_element_structure_to_all_lanes(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6819,8 +7152,18 @@ bool ARMInterpreter::interpret_vld2_single_2_element_structure_to_all_lanes(cons
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : (2 * ins.ebytes))));
         }
-        m_ctx.writeDoubleRegister(ins.d, Replicate(m_ctx.read_MemU(address, ins.ebytes), ins.elements));
-        m_ctx.writeDoubleRegister(ins.d2, Replicate(m_ctx.read_MemU((address + ins.ebytes), ins.ebytes), ins.elements));
+        loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeDoubleRegister(ins.d, Replicate(loaded_value, ins.elements));
+        loaded_value = m_ctx.read_MemU((address + ins.ebytes), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeDoubleRegister(ins.d2, Replicate(loaded_value, ins.elements));
     }
     return true;
 }
@@ -6828,6 +7171,8 @@ bool ARMInterpreter::interpret_vld2_single_2_element_structure_to_all_lanes(cons
 bool ARMInterpreter::interpret_vld3_multiple_3_element_structures(const ARMInstruction &ins) {
     int address = 0;
     int e = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6840,9 +7185,24 @@ bool ARMInterpreter::interpret_vld3_multiple_3_element_structures(const ARMInstr
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : 24)));
         }
         for (e = 0; e < (ins.elements - 1); ++e) {
-            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), e, ins.esize, m_ctx.read_MemU(address, ins.ebytes));
-            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), e, ins.esize, m_ctx.read_MemU((address + ins.ebytes), ins.ebytes));
-            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d3), e, ins.esize, m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes));
+            loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), e, ins.esize, loaded_value);
+            loaded_value = m_ctx.read_MemU((address + ins.ebytes), ins.ebytes);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), e, ins.esize, loaded_value);
+            loaded_value = m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d3), e, ins.esize, loaded_value);
             address = (address + (3 * ins.ebytes));
         }
         
@@ -6852,6 +7212,8 @@ bool ARMInterpreter::interpret_vld3_multiple_3_element_structures(const ARMInstr
 
 bool ARMInterpreter::interpret_vld3_single_3_element_structure_to_one_lane(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6860,15 +7222,32 @@ bool ARMInterpreter::interpret_vld3_single_3_element_structure_to_one_lane(const
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : (3 * ins.ebytes))));
         }
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize, m_ctx.read_MemU(address, ins.ebytes));
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), ins.index, ins.esize, m_ctx.read_MemU((address + ins.ebytes), ins.ebytes));
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d3), ins.index, ins.esize, m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes));
+        loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize, loaded_value);
+        loaded_value = m_ctx.read_MemU((address + ins.ebytes), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), ins.index, ins.esize, loaded_value);
+        loaded_value = m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d3), ins.index, ins.esize, loaded_value);
     }
     return true;
 }
 
 bool ARMInterpreter::interpret_vld3_single_3_element_structure_to_all_lanes(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6877,9 +7256,24 @@ bool ARMInterpreter::interpret_vld3_single_3_element_structure_to_all_lanes(cons
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : (3 * ins.ebytes))));
         }
-        m_ctx.writeDoubleRegister(ins.d, Replicate(m_ctx.read_MemU(address, ins.ebytes), ins.elements));
-        m_ctx.writeDoubleRegister(ins.d2, Replicate(m_ctx.read_MemU((address + ins.ebytes), ins.ebytes), ins.elements));
-        m_ctx.writeDoubleRegister(ins.d3, Replicate(m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes), ins.elements));
+        loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeDoubleRegister(ins.d, Replicate(loaded_value, ins.elements));
+        loaded_value = m_ctx.read_MemU((address + ins.ebytes), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeDoubleRegister(ins.d2, Replicate(loaded_value, ins.elements));
+        loaded_value = m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeDoubleRegister(ins.d3, Replicate(loaded_value, ins.elements));
     }
     return true;
 }
@@ -6887,6 +7281,8 @@ bool ARMInterpreter::interpret_vld3_single_3_element_structure_to_all_lanes(cons
 bool ARMInterpreter::interpret_vld4_multiple_4_element_structures(const ARMInstruction &ins) {
     int address = 0;
     int e = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6899,10 +7295,30 @@ bool ARMInterpreter::interpret_vld4_multiple_4_element_structures(const ARMInstr
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : 32)));
         }
         for (e = 0; e < (ins.elements - 1); ++e) {
-            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), e, ins.esize, m_ctx.read_MemU(address, ins.ebytes));
-            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), e, ins.esize, m_ctx.read_MemU((address + ins.ebytes), ins.ebytes));
-            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d3), e, ins.esize, m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes));
-            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d4), e, ins.esize, m_ctx.read_MemU((address + (3 * ins.ebytes)), ins.ebytes));
+            loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), e, ins.esize, loaded_value);
+            loaded_value = m_ctx.read_MemU((address + ins.ebytes), ins.ebytes);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), e, ins.esize, loaded_value);
+            loaded_value = m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d3), e, ins.esize, loaded_value);
+            loaded_value = m_ctx.read_MemU((address + (3 * ins.ebytes)), ins.ebytes);
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
+            m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d4), e, ins.esize, loaded_value);
             address = (address + (4 * ins.ebytes));
         }
         
@@ -6912,6 +7328,8 @@ bool ARMInterpreter::interpret_vld4_multiple_4_element_structures(const ARMInstr
 
 bool ARMInterpreter::interpret_vld4_single_4_element_structure_to_one_lane(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6923,16 +7341,38 @@ bool ARMInterpreter::interpret_vld4_single_4_element_structure_to_one_lane(const
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : (4 * ins.ebytes))));
         }
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize, m_ctx.read_MemU(address, ins.ebytes));
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), ins.index, ins.esize, m_ctx.read_MemU((address + ins.ebytes), ins.ebytes));
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d3), ins.index, ins.esize, m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes));
-        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d4), ins.index, ins.esize, m_ctx.read_MemU((address + (3 * ins.ebytes)), ins.ebytes));
+        loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize, loaded_value);
+        loaded_value = m_ctx.read_MemU((address + ins.ebytes), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d2), ins.index, ins.esize, loaded_value);
+        loaded_value = m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d3), ins.index, ins.esize, loaded_value);
+        loaded_value = m_ctx.read_MemU((address + (3 * ins.ebytes)), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeElement(m_ctx.readDoubleRegister(ins.d4), ins.index, ins.esize, loaded_value);
     }
     return true;
 }
 
 bool ARMInterpreter::interpret_vld4_single_4_element_structure_to_all_lanes(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -6944,10 +7384,30 @@ bool ARMInterpreter::interpret_vld4_single_4_element_structure_to_all_lanes(cons
         if (ins.wback) {
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : (4 * ins.ebytes))));
         }
-        m_ctx.writeDoubleRegister(ins.d, Replicate(m_ctx.read_MemU(address, ins.ebytes), ins.elements));
-        m_ctx.writeDoubleRegister(ins.d2, Replicate(m_ctx.read_MemU((address + ins.ebytes), ins.ebytes), ins.elements));
-        m_ctx.writeDoubleRegister(ins.d3, Replicate(m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes), ins.elements));
-        m_ctx.writeDoubleRegister(ins.d4, Replicate(m_ctx.read_MemU((address + (3 * ins.ebytes)), ins.ebytes), ins.elements));
+        loaded_value = m_ctx.read_MemU(address, ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeDoubleRegister(ins.d, Replicate(loaded_value, ins.elements));
+        loaded_value = m_ctx.read_MemU((address + ins.ebytes), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeDoubleRegister(ins.d2, Replicate(loaded_value, ins.elements));
+        loaded_value = m_ctx.read_MemU((address + (2 * ins.ebytes)), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeDoubleRegister(ins.d3, Replicate(loaded_value, ins.elements));
+        loaded_value = m_ctx.read_MemU((address + (3 * ins.ebytes)), ins.ebytes);
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
+        m_ctx.writeDoubleRegister(ins.d4, Replicate(loaded_value, ins.elements));
     }
     return true;
 }
@@ -6957,6 +7417,8 @@ bool ARMInterpreter::interpret_vldm(const ARMInstruction &ins) {
     int r = 0;
     int word1 = 0;
     int word2 = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckVFPEnabled(true);
@@ -6967,11 +7429,24 @@ bool ARMInterpreter::interpret_vldm(const ARMInstruction &ins) {
         }
         for (r = 0; r < (ins.regs - 1); ++r) {
             if (ins.single_regs) {
-                m_ctx.writeSingleRegister((ins.d + r), m_ctx.read_MemA(address, 4));
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
+                m_ctx.writeSingleRegister((ins.d + r), loaded_value);
                 address = (address + 4);
             } else {
                 word1 = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
                 word2 = m_ctx.read_MemA((address + 4), 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
                 address = (address + 8);
                 m_ctx.writeDoubleRegister((ins.d + r), ((BigEndian()) ? Concatenate(word1, word2, 32) : Concatenate(word2, word1, 32)));
             }
@@ -6986,6 +7461,7 @@ bool ARMInterpreter::interpret_vldr(const ARMInstruction &ins) {
     int address = 0;
     int word1 = 0;
     int word2 = 0;
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckVFPEnabled(true);
@@ -6993,10 +7469,20 @@ bool ARMInterpreter::interpret_vldr(const ARMInstruction &ins) {
         base = (((ins.n == 15)) ? Align(m_ctx.readRegularRegister(15), 4) : m_ctx.readRegularRegister(ins.n));
         address = ((ins.add) ? (base + ins.imm32) : (base - ins.imm32));
         if (ins.single_reg) {
-            m_ctx.writeSingleRegister(ins.d, m_ctx.read_MemA(address, 4));
+            loaded_value = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
+            m_ctx.writeSingleRegister(ins.d, loaded_value);
         } else {
             word1 = m_ctx.read_MemA(address, 4);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             word2 = m_ctx.read_MemA((address + 4), 4);
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.writeDoubleRegister(ins.d, ((BigEndian()) ? Concatenate(word1, word2, 32) : Concatenate(word2, word1, 32)));
         }
     }
@@ -7267,6 +7753,7 @@ bool ARMInterpreter::interpret_vmovn(const ARMInstruction &ins) {
 }
 
 bool ARMInterpreter::interpret_vmrs(const ARMInstruction &ins) {
+    m_ctx.syncFlags();
     if (ConditionPassed()) {
         CheckVFPEnabled(true);
         SerializeVFP();
@@ -7676,6 +8163,8 @@ bool ARMInterpreter::interpret_vpop(const ARMInstruction &ins) {
     int r = 0;
     int word1 = 0;
     int word2 = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(13);
+    uint64_t loaded_value = 0;
 
     if (ConditionPassed()) {
         CheckVFPEnabled(true);
@@ -7684,14 +8173,27 @@ bool ARMInterpreter::interpret_vpop(const ARMInstruction &ins) {
         m_ctx.writeRegularRegister(13, (address + ins.imm32));
         if (ins.single_regs) {
             for (r = 0; r < (ins.regs - 1); ++r) {
-                m_ctx.writeSingleRegister((ins.d + r), m_ctx.read_MemA(address, 4));
+                loaded_value = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(13, saved_base);
+                    return true;
+                }
+                m_ctx.writeSingleRegister((ins.d + r), loaded_value);
                 address = (address + 4);
             }
             
         } else {
             for (r = 0; r < (ins.regs - 1); ++r) {
                 word1 = m_ctx.read_MemA(address, 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(13, saved_base);
+                    return true;
+                }
                 word2 = m_ctx.read_MemA((address + 4), 4);
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(13, saved_base);
+                    return true;
+                }
                 address = (address + 8);
                 m_ctx.writeDoubleRegister((ins.d + r), ((BigEndian()) ? Concatenate(word1, word2, 32) : Concatenate(word2, word1, 32)));
             }
@@ -7704,6 +8206,7 @@ bool ARMInterpreter::interpret_vpop(const ARMInstruction &ins) {
 bool ARMInterpreter::interpret_vpush(const ARMInstruction &ins) {
     int address = 0;
     int r = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(13);
 
     if (ConditionPassed()) {
         CheckVFPEnabled(true);
@@ -7713,13 +8216,25 @@ bool ARMInterpreter::interpret_vpush(const ARMInstruction &ins) {
         if (ins.single_regs) {
             for (r = 0; r < (ins.regs - 1); ++r) {
                 m_ctx.write_MemA(address, 4, m_ctx.readSingleRegister((ins.d + r)));
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(13, saved_base);
+                    return true;
+                }
                 address = (address + 4);
             }
             
         } else {
             for (r = 0; r < (ins.regs - 1); ++r) {
                 m_ctx.write_MemA(address, 4, ((BigEndian()) ? get_bits(m_ctx.readDoubleRegister((ins.d + r)), 63, 32) : get_bits(m_ctx.readDoubleRegister((ins.d + r)), 31, 0)));
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(13, saved_base);
+                    return true;
+                }
                 m_ctx.write_MemA((address + 4), 4, ((BigEndian()) ? get_bits(m_ctx.readDoubleRegister((ins.d + r)), 31, 0) : get_bits(m_ctx.readDoubleRegister((ins.d + r)), 63, 32)));
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(13, saved_base);
+                    return true;
+                }
                 address = (address + 8);
             }
             
@@ -8505,6 +9020,7 @@ bool ARMInterpreter::interpret_vst1_multiple_single_elements(const ARMInstructio
     int r = 0;
     int e = 0;
     int data = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -8520,10 +9036,22 @@ bool ARMInterpreter::interpret_vst1_multiple_single_elements(const ARMInstructio
             for (e = 0; e < (ins.elements - 1); ++e) {
                 if ((ins.ebytes != 8)) {
                     m_ctx.write_MemU(address, ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister((ins.d + r)), e, ins.esize));
+                    if (m_ctx.hasMemoryFault()) {
+                        m_ctx.writeRegularRegister(ins.n, saved_base);
+                        return true;
+                    }
                 } else {
                     data = m_ctx.readElement(m_ctx.readDoubleRegister((ins.d + r)), e, ins.esize);
                     m_ctx.write_MemU(address, 4, ((BigEndian()) ? get_bits(data, 63, 32) : get_bits(data, 31, 0)));
+                    if (m_ctx.hasMemoryFault()) {
+                        m_ctx.writeRegularRegister(ins.n, saved_base);
+                        return true;
+                    }
                     m_ctx.write_MemU((address + 4), 4, ((BigEndian()) ? get_bits(data, 31, 0) : get_bits(data, 63, 32)));
+                    if (m_ctx.hasMemoryFault()) {
+                        m_ctx.writeRegularRegister(ins.n, saved_base);
+                        return true;
+                    }
                 }
                 address = (address + ins.ebytes);
             }
@@ -8536,6 +9064,7 @@ bool ARMInterpreter::interpret_vst1_multiple_single_elements(const ARMInstructio
 
 bool ARMInterpreter::interpret_vst1_single_element_from_one_lane(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -8548,6 +9077,10 @@ bool ARMInterpreter::interpret_vst1_single_element_from_one_lane(const ARMInstru
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : ins.ebytes)));
         }
         m_ctx.write_MemU(address, ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
     }
     return true;
 }
@@ -8556,6 +9089,7 @@ bool ARMInterpreter::interpret_vst2_multiple_2_element_structures(const ARMInstr
     int address = 0;
     int r = 0;
     int e = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -8570,7 +9104,15 @@ bool ARMInterpreter::interpret_vst2_multiple_2_element_structures(const ARMInstr
         for (r = 0; r < (ins.regs - 1); ++r) {
             for (e = 0; e < (ins.elements - 1); ++e) {
                 m_ctx.write_MemU(address, ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister((ins.d + r)), e, ins.esize));
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
                 m_ctx.write_MemU((address + ins.ebytes), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister((ins.d2 + r)), e, ins.esize));
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
                 address = (address + (2 * ins.ebytes));
             }
             
@@ -8582,6 +9124,7 @@ bool ARMInterpreter::interpret_vst2_multiple_2_element_structures(const ARMInstr
 
 bool ARMInterpreter::interpret_vst2_single_2_element_structure_from_one_lane(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -8594,7 +9137,15 @@ bool ARMInterpreter::interpret_vst2_single_2_element_structure_from_one_lane(con
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : (2 * ins.ebytes))));
         }
         m_ctx.write_MemU(address, ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
         m_ctx.write_MemU((address + ins.ebytes), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d2), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
     }
     return true;
 }
@@ -8602,6 +9153,7 @@ bool ARMInterpreter::interpret_vst2_single_2_element_structure_from_one_lane(con
 bool ARMInterpreter::interpret_vst3_multiple_3_element_structures(const ARMInstruction &ins) {
     int address = 0;
     int e = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -8615,8 +9167,20 @@ bool ARMInterpreter::interpret_vst3_multiple_3_element_structures(const ARMInstr
         }
         for (e = 0; e < (ins.elements - 1); ++e) {
             m_ctx.write_MemU(address, ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d), e, ins.esize));
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
             m_ctx.write_MemU((address + ins.ebytes), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d2), e, ins.esize));
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
             m_ctx.write_MemU((address + (2 * ins.ebytes)), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d3), e, ins.esize));
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
             address = (address + (3 * ins.ebytes));
         }
         
@@ -8626,6 +9190,7 @@ bool ARMInterpreter::interpret_vst3_multiple_3_element_structures(const ARMInstr
 
 bool ARMInterpreter::interpret_vst3_single_3_element_structure_from_one_lane(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -8635,8 +9200,20 @@ bool ARMInterpreter::interpret_vst3_single_3_element_structure_from_one_lane(con
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : (3 * ins.ebytes))));
         }
         m_ctx.write_MemU(address, ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
         m_ctx.write_MemU((address + ins.ebytes), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d2), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
         m_ctx.write_MemU((address + (2 * ins.ebytes)), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d3), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
     }
     return true;
 }
@@ -8644,6 +9221,7 @@ bool ARMInterpreter::interpret_vst3_single_3_element_structure_from_one_lane(con
 bool ARMInterpreter::interpret_vst4_multiple_4_element_structures(const ARMInstruction &ins) {
     int address = 0;
     int e = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -8657,9 +9235,25 @@ bool ARMInterpreter::interpret_vst4_multiple_4_element_structures(const ARMInstr
         }
         for (e = 0; e < (ins.elements - 1); ++e) {
             m_ctx.write_MemU(address, ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d), e, ins.esize));
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
             m_ctx.write_MemU((address + ins.ebytes), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d2), e, ins.esize));
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
             m_ctx.write_MemU((address + (2 * ins.ebytes)), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d3), e, ins.esize));
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
             m_ctx.write_MemU((address + (3 * ins.ebytes)), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d4), e, ins.esize));
+            if (m_ctx.hasMemoryFault()) {
+                m_ctx.writeRegularRegister(ins.n, saved_base);
+                return true;
+            }
             address = (address + (4 * ins.ebytes));
         }
         
@@ -8669,6 +9263,7 @@ bool ARMInterpreter::interpret_vst4_multiple_4_element_structures(const ARMInstr
 
 bool ARMInterpreter::interpret_vst4_single_4_element_structure_from_one_lane(const ARMInstruction &ins) {
     int address = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckAdvSIMDEnabled();
@@ -8681,9 +9276,25 @@ bool ARMInterpreter::interpret_vst4_single_4_element_structure_from_one_lane(con
             m_ctx.writeRegularRegister(ins.n, (m_ctx.readRegularRegister(ins.n) + ((ins.register_index) ? m_ctx.readRegularRegister(ins.m) : (4 * ins.ebytes))));
         }
         m_ctx.write_MemU(address, ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
         m_ctx.write_MemU((address + ins.ebytes), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d2), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
         m_ctx.write_MemU((address + (2 * ins.ebytes)), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d3), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
         m_ctx.write_MemU((address + (3 * ins.ebytes)), ins.ebytes, m_ctx.readElement(m_ctx.readDoubleRegister(ins.d4), ins.index, ins.esize));
+        if (m_ctx.hasMemoryFault()) {
+            m_ctx.writeRegularRegister(ins.n, saved_base);
+            return true;
+        }
     }
     return true;
 }
@@ -8691,6 +9302,7 @@ bool ARMInterpreter::interpret_vst4_single_4_element_structure_from_one_lane(con
 bool ARMInterpreter::interpret_vstm(const ARMInstruction &ins) {
     int address = 0;
     int r = 0;
+    uint32_t saved_base = m_ctx.readRegularRegister(ins.n);
 
     if (ConditionPassed()) {
         CheckVFPEnabled(true);
@@ -8702,10 +9314,22 @@ bool ARMInterpreter::interpret_vstm(const ARMInstruction &ins) {
         for (r = 0; r < (ins.regs - 1); ++r) {
             if (ins.single_regs) {
                 m_ctx.write_MemA(address, 4, m_ctx.readSingleRegister((ins.d + r)));
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
                 address = (address + 4);
             } else {
                 m_ctx.write_MemA(address, 4, ((BigEndian()) ? get_bits(m_ctx.readDoubleRegister((ins.d + r)), 63, 32) : get_bits(m_ctx.readDoubleRegister((ins.d + r)), 31, 0)));
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
                 m_ctx.write_MemA((address + 4), 4, ((BigEndian()) ? get_bits(m_ctx.readDoubleRegister((ins.d + r)), 31, 0) : get_bits(m_ctx.readDoubleRegister((ins.d + r)), 63, 32)));
+                if (m_ctx.hasMemoryFault()) {
+                    m_ctx.writeRegularRegister(ins.n, saved_base);
+                    return true;
+                }
                 address = (address + 8);
             }
         }
@@ -8723,9 +9347,18 @@ bool ARMInterpreter::interpret_vstr(const ARMInstruction &ins) {
         address = ((ins.add) ? (m_ctx.readRegularRegister(ins.n) + ins.imm32) : (m_ctx.readRegularRegister(ins.n) - ins.imm32));
         if (ins.single_reg) {
             m_ctx.write_MemA(address, 4, m_ctx.readSingleRegister(ins.d));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         } else {
             m_ctx.write_MemA(address, 4, ((BigEndian()) ? get_bits(m_ctx.readDoubleRegister(ins.d), 63, 32) : get_bits(m_ctx.readDoubleRegister(ins.d), 31, 0)));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
             m_ctx.write_MemA((address + 4), 4, ((BigEndian()) ? get_bits(m_ctx.readDoubleRegister(ins.d), 31, 0) : get_bits(m_ctx.readDoubleRegister(ins.d), 63, 32)));
+            if (m_ctx.hasMemoryFault()) {
+                return true;
+            }
         }
     }
     return true;
@@ -13,9 +13,23 @@ public:
 
     void execute(const ARMInstruction &ins);
 
+    // Member function that interprets an instruction. It can be resolved once per decoded
+    // instruction so callers skip the lookup every time the instruction is executed.
+    typedef bool (ARMInterpreter::*Handler)(const ARMInstruction &ins);
+    static Handler getHandler(const ARMInstruction &ins);
+
+    bool execute(Handler handler, const ARMInstruction &ins) {
+        return (this->*handler)(ins);
+    }
+
 private:
     ARMContext &m_ctx;
 
+    // Handlers indexed by ARMInstructionId.
+    static const Handler m_handlers[];
+    static const size_t n_handlers;
+
+    bool interpret_unknown(const ARMInstruction &ins) { return false; }
     bool ConditionPassed() { return true; }
     bool CurrentModeIsHyp() { return false; }
     bool CurrentModeIsNotUser() { return false; }
@@ -24,7 +38,7 @@ private:
     bool IsSecure() { return false; }
     bool JazelleAcceptsExecution() { return false; }
     void BKPTInstrDebugEvent() {}
-    void BranchWritePC(uint32_t address) {}
+    void BranchWritePC(uint32_t address) { m_ctx.BranchWritePC(address); }
     void CheckAdvSIMDEnabled() {}
     void ClearEventRegister() {}
     void EncodingSpecificOperations() {}
@@ -35,7 +49,7 @@ private:
     void WaitForInterrupt() {}
     ARMMode CurrentInstrSet() { return ARMMode_ARM; }
     void SelectInstrSet(unsigned mode) {}
-    void BXWritePC(unsigned address) {}
+    void BXWritePC(unsigned address) { m_ctx.BXWritePC(address); }
     void WriteHSR(unsigned ec, unsigned hsr_string) {}
     unsigned ThisInstr() { return 0; }
     bool Coproc_Accepted(unsigned cp_num, unsigned instr) { return true; }
@@ -56,7 +70,7 @@ private:
     void NullCheckIfThumbEE(unsigned n) {}
     void Coproc_SendLoadedWord(unsigned word, unsigned cp_num, unsigned instr) {}
     bool Coproc_DoneLoading(unsigned cp_num, unsigned instr) { return true; }
-    void LoadWritePC(unsigned address) {}
+    void LoadWritePC(unsigned address) { m_ctx.LoadWritePC(address); }
     bool UnalignedSupport() { return false; }
     bool HaveLPAE() { return true; }
     bool BigEndian() {return false;}
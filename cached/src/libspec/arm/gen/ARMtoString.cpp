@@ -11,8 +11,15 @@
 using namespace Disassembler;
 using namespace std;
 
-string banked_reg(const ARMInstruction *ins) {
-    string tmp = "UNPREDICTABLE";
+// Decimal text of 'value', used to build register lists and data types.
+static ARMText decimal_str(unsigned value) {
+    ARMText text;
+    text.appendf("%u", value);
+    return text;
+}
+
+ARMText banked_reg(const ARMInstruction *ins) {
+    ARMText tmp = "UNPREDICTABLE";
     if (ins->read_spsr == 0) {
         switch(ins->SYSm) {
             case 0: // 0b0
@@ -129,7 +136,7 @@ string banked_reg(const ARMInstruction *ins) {
     return tmp;
 }
 
-string effect_str(const ARMInstruction *ins) {
+ARMText effect_str(const ARMInstruction *ins) {
     if (ins->enable)
         return "IE";
 
@@ -139,7 +146,7 @@ string effect_str(const ARMInstruction *ins) {
     return "";
 }
 
-string align_str(const ARMInstruction *ins) {
+ARMText align_str(const ARMInstruction *ins) {
     switch(ins->id) {
         case vst4_multiple_4_element_structures:
         case vst3_multiple_3_element_structures:
@@ -214,23 +221,23 @@ string align_str(const ARMInstruction *ins) {
     return "missing_id_align_str";
 }
 
-string range(unsigned i, unsigned n, const string &pre) {
+ARMText range(unsigned i, unsigned n, const char *pre) {
     if (n == 0) {
-        return pre + to_string(i);
+        return pre + decimal_str(i);
     }
 
-    string tmp = "";
+    ARMText tmp = "";
     while (i < n - 1) {
-        tmp += pre + to_string(i) + ", ";
+        tmp += pre + decimal_str(i) + ", ";
         i++;
     }
 
-    tmp += pre + to_string(i);
+    tmp += pre + decimal_str(i);
 
     return tmp;
 }
 
-string list_str(const ARMInstruction *ins) {
+ARMText list_str(const ARMInstruction *ins) {
     switch(ins->id) {
         case vldm: {
             // Get the value of imm8.
@@ -245,66 +252,66 @@ string list_str(const ARMInstruction *ins) {
         case vld3_multiple_3_element_structures:
             switch(ins->type) {
                 case 4:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
-                        ", D" + to_string(ins->d + 2) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
+                        ", D" + decimal_str(ins->d + 2) +
                         "}";
                 case 5:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 4) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 4) +
                         "}";
                 default:
-                    return "INVALID:" + to_string(ins->type);
+                    return "INVALID:" + decimal_str(ins->type);
             }
             break;
 
         case vst3_single_3_element_structure_from_one_lane:
         case vld3_single_3_element_structure_to_one_lane:
-            return "{D" + to_string(ins->d) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc * 2) + "["  + to_string(ins->index) + "]" + "}";
+            return "{D" + decimal_str(ins->d) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + "["  + decimal_str(ins->index) + "]" + "}";
 
         case vld3_single_3_element_structure_to_all_lanes:
-            return "{D" + to_string(ins->d) + "[], " +
-                    "D" + to_string(ins->d + ins->inc) + "[], " +
-                    "D" + to_string(ins->d + ins->inc * 2) + "[]" + "}";
+            return "{D" + decimal_str(ins->d) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + "[]" + "}";
 
         case vld4_multiple_4_element_structures:
-            return "{D" + to_string(ins->d) + ", " +
-                    "D" + to_string(ins->d + ins->inc) + ", " +
-                    "D" + to_string(ins->d + ins->inc * 2) + ", " +
-                    "D" + to_string(ins->d + ins->inc * 3) + "}";
+            return "{D" + decimal_str(ins->d) + ", " +
+                    "D" + decimal_str(ins->d + ins->inc) + ", " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + ", " +
+                    "D" + decimal_str(ins->d + ins->inc * 3) + "}";
 
         case vst4_single_4_element_structure_from_one_lane:
         case vld4_single_4_element_structure_to_one_lane:
-            return "{D" + to_string(ins->d) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc * 2) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc * 3) + "["  + to_string(ins->index) + "]" + "}";
+            return "{D" + decimal_str(ins->d) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc * 3) + "["  + decimal_str(ins->index) + "]" + "}";
 
         case vld4_single_4_element_structure_to_all_lanes:
-            return "{D" + to_string(ins->d) + "[], " +
-                    "D" + to_string(ins->d + ins->inc) + "[], " +
-                    "D" + to_string(ins->d + ins->inc * 2) + "[], " +
-                    "D" + to_string(ins->d + ins->inc * 3) + "[]" + "}";
+            return "{D" + decimal_str(ins->d) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc * 3) + "[]" + "}";
 
         case vld2_single_2_element_structure_to_all_lanes:
-            return "{D" + to_string(ins->d) + "[], D" + to_string(ins->d + ins->inc) + "[]}";
+            return "{D" + decimal_str(ins->d) + "[], D" + decimal_str(ins->d + ins->inc) + "[]}";
 
         case vst2_single_2_element_structure_from_one_lane:
         case vld2_single_2_element_structure_to_one_lane:
-            return "{D" + to_string(ins->d) + "["  + to_string(ins->index) + "], D" + to_string(ins->d + ins->inc) + "["  + to_string(ins->index) + "]}";
+            return "{D" + decimal_str(ins->d) + "["  + decimal_str(ins->index) + "], D" + decimal_str(ins->d + ins->inc) + "["  + decimal_str(ins->index) + "]}";
 
         case vld1_single_element_to_all_lanes:
             if (!ins->T) {
-                return "{D" + to_string(ins->d) + "[]}";
+                return "{D" + decimal_str(ins->d) + "[]}";
             }
-            return "{D" + to_string(ins->d) + "[], D" + to_string(ins->d + 1) + "[]}";
+            return "{D" + decimal_str(ins->d) + "[], D" + decimal_str(ins->d + 1) + "[]}";
 
         case vst1_single_element_from_one_lane:
         case vld1_single_element_to_one_lane:
-            return "{D" + to_string(ins->d) + "["  + to_string(ins->index) + "]}";
+            return "{D" + decimal_str(ins->d) + "["  + decimal_str(ins->index) + "]}";
 
         case vld2_multiple_2_element_structures:
         case vld1_multiple_single_elements:
@@ -314,69 +321,69 @@ string list_str(const ARMInstruction *ins) {
         case vst3_multiple_3_element_structures:
             switch(ins->type) {
                 case 1:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 4) +
-                        ", D" + to_string(ins->d + 6) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 4) +
+                        ", D" + decimal_str(ins->d + 6) +
                         "}";
                 case 5:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 4) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 4) +
                         "}";
                 case 8:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
                         "}";
                 case 9:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 2) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 2) +
                         "}";
                 case 3:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 3) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 3) +
                         "}";
                 case 7:
-                    return "{D" + to_string(ins->d) + "}";
+                    return "{D" + decimal_str(ins->d) + "}";
                 case 10:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
                         "}";
                 case 4:
                 case 6:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
-                        ", D" + to_string(ins->d + 2) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
+                        ", D" + decimal_str(ins->d + 2) +
                         "}";
                 case 0:
                 case 2:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 3) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 3) +
                         "}";
                 default:
-                    return "INVALID" + to_string(ins->type);
+                    return "INVALID" + decimal_str(ins->type);
             }
             break;
         case vtbl_vtbx:
             switch(ins->length - 1) {
                 case 0:
-                    return "{D" + to_string(ins->n) + "}";
+                    return "{D" + decimal_str(ins->n) + "}";
                 case 1:
-                    return "{D" + to_string(ins->n) +
-                        ", D" + to_string(ins->n + 1) + "}";
+                    return "{D" + decimal_str(ins->n) +
+                        ", D" + decimal_str(ins->n + 1) + "}";
                 case 2:
-                    return "{D" + to_string(ins->n) +
-                    ", D" + to_string(ins->n + 1) +
-                    ", D" + to_string(ins->n + 2) + "}";
+                    return "{D" + decimal_str(ins->n) +
+                    ", D" + decimal_str(ins->n + 1) +
+                    ", D" + decimal_str(ins->n + 2) + "}";
                 case 3:
-                    return "{D" + to_string(ins->n) +
-                    ", D" + to_string(ins->n + 1) +
-                    ", D" + to_string(ins->n + 2) +
-                    ", D" + to_string(ins->n + 3) + "}";
+                    return "{D" + decimal_str(ins->n) +
+                    ", D" + decimal_str(ins->n + 1) +
+                    ", D" + decimal_str(ins->n + 2) +
+                    ", D" + decimal_str(ins->n + 3) + "}";
                 default:
                     return "INVALID";
             }
@@ -384,16 +391,16 @@ string list_str(const ARMInstruction *ins) {
 
     unsigned first_reg = first_reg = ins->d;
     unsigned n_regs = ins->imm32 >> 2;
-    string reg_type = "S";
+    ARMText reg_type = "S";
 
     if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
         n_regs /= 2;
         reg_type = "D";
     }
 
-    string acum;
+    ARMText acum;
     for(unsigned i = first_reg; i < first_reg + n_regs; ++i) {
-        acum += reg_type + to_string(i);
+        acum += reg_type + decimal_str(i);
         if (i != (first_reg + n_regs - 1))
             acum += ", ";
     }
@@ -401,7 +408,7 @@ string list_str(const ARMInstruction *ins) {
     return "{" + acum + "}";
 }
 
-string amode_str(const ARMInstruction *ins) {
+ARMText amode_str(const ARMInstruction *ins) {
     if (ins->P == 0 && ins->U == 0) return "DA";
     else if (ins->P == 1 && ins->U == 0) return "DB";
     else if (ins->P == 0 && ins->U == 1) return "IA";
@@ -409,19 +416,19 @@ string amode_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string IA_str(const ARMInstruction *ins) {
+ARMText IA_str(const ARMInstruction *ins) {
     return ins->increment ? "IA" : "DB";
 }
 
-string iflags_str(const ARMInstruction *ins) {
-    string out;
+ARMText iflags_str(const ARMInstruction *ins) {
+    ARMText out;
     if (ins->affectA) out += "A";
     if (ins->affectI) out += "I";
     if (ins->affectF) out += "F";
     return out;
 }
 
-string S_str(const ARMInstruction *ins) {
+ARMText S_str(const ARMInstruction *ins) {
     return ins->setflags ? "S" : "";
 }
 
@@ -435,42 +442,42 @@ bool is_conditional_thumb(const ARMInstruction *ins) {
     return false;
 }
 
-string c_str(const ARMInstruction *ins) {
+ARMText c_str(const ARMInstruction *ins) {
     if (EncodingIsThumb(ins->encoding) && !is_conditional_thumb(ins))
         return "";
 
     return ins->cond != COND_AL ? ARMCondCodeToString((cond_t) ins->cond) : "";
 }
 
-string B_str(const ARMInstruction *ins) {
+ARMText B_str(const ARMInstruction *ins) {
     return ins->B ? "B" : "";
 }
 
-string N_str(const ARMInstruction *ins) {
+ARMText N_str(const ARMInstruction *ins) {
     return ins->nonzero ? "N" : "";
 }
 
-string W_str(const ARMInstruction *ins) {
+ARMText W_str(const ARMInstruction *ins) {
     return ins->is_pldw ? "W" : "";
 }
 
-string x_str(const ARMInstruction *ins) {
+ARMText x_str(const ARMInstruction *ins) {
     return ins->n_high ? "T" : "B";
 }
 
-string y_str(const ARMInstruction *ins) {
+ARMText y_str(const ARMInstruction *ins) {
     return ins->m_high ? "T" : "B";
 }
 
-string X_str(const ARMInstruction *ins) {
+ARMText X_str(const ARMInstruction *ins) {
     return ins->m_swap ? "X" : "";
 }
 
-string R_str(const ARMInstruction *ins) {
+ARMText R_str(const ARMInstruction *ins) {
     return ins->round ? "R" : "";
 }
 
-string mode_str(const ARMInstruction *ins) {
+ARMText mode_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vldm: // VLDM
         case vstm: // VSTM
@@ -488,7 +495,7 @@ string mode_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string op_str(const ARMInstruction *ins) {
+ARMText op_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vpmax_vpmin_floating_point: // VPMAX, VPMIN (floating-point)
         case vpmax_vpmin_integer: // VPMAX, VPMIN (integer)
@@ -505,20 +512,20 @@ string op_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string dt_str(const ARMInstruction *ins) {
+ARMText dt_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vrsqrte:
-            return ((ins->floating_point) ? "F" : "U") + to_string(ins->esize);
+            return ((ins->floating_point) ? "F" : "U") + decimal_str(ins->esize);
 
         case vrhadd:
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vrecpe:
             return (ins->floating_point) ? "F32" : "U32";
 
         case vpadal:
         case vpaddl:
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vmla_vmlal_vmls_vmlsl_integer:
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
@@ -547,10 +554,10 @@ string dt_str(const ARMInstruction *ins) {
             }
         case vmla_vmlal_vmls_vmlsl_by_scalar:
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->floating_point ? "F" : "I") + string(ins->size == 1 ? "16" : "32");
+                return (ins->floating_point ? "F" : "I") + ARMText(ins->size == 1 ? "16" : "32");
             }
 
-            return (ins->unsigned_ ? "U" : "S") + string(ins->size == 1 ? "16" : "32");
+            return (ins->unsigned_ ? "U" : "S") + ARMText(ins->size == 1 ? "16" : "32");
 
         case vmax_vmin_integer:
         case vhadd_vhsub:
@@ -586,26 +593,26 @@ string dt_str(const ARMInstruction *ins) {
                 default: return "INVALID";
             }
         case vqadd:
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vceq_immediate_0:
-            return (ins->floating_point ? "F" : "I") + to_string(ins->esize);
+            return (ins->floating_point ? "F" : "I") + decimal_str(ins->esize);
         case vcgt_immediate_0:
         case vcle_immediate_0:
         case vclt_immediate_0:
         case vcge_immediate_0:
-            return (ins->floating_point ? "F" : "S") + to_string(ins->esize);
+            return (ins->floating_point ? "F" : "S") + decimal_str(ins->esize);
 
         case vcgt_register:
         case vcge_register:
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->U ? "U" : "S") + to_string(ins->esize);
+                return (ins->U ? "U" : "S") + decimal_str(ins->esize);
             }
 
             return "F32";
 
         case vceq_register: // VCEQ (register)
-            return (ins->int_operation ? "I" : "F") + to_string(ins->esize);
+            return (ins->int_operation ? "I" : "F") + decimal_str(ins->esize);
 
         case vbic_immediate:
         case vmov_immediate:
@@ -657,7 +664,7 @@ string dt_str(const ARMInstruction *ins) {
         case vneg:
         case vabs: // VABS
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->floating_point ? "F" : "S") + to_string(ins->esize);
+                return (ins->floating_point ? "F" : "S") + decimal_str(ins->esize);
             }
             return ins->dp_operation ? "F64" : "F32";
         case vaddhn: // VADDHN
@@ -687,7 +694,7 @@ string dt_str(const ARMInstruction *ins) {
 
             break;
         case vmovl: // VMOVL
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vmovn: // VMOVN
             switch (ins->size) {
@@ -704,17 +711,17 @@ string dt_str(const ARMInstruction *ins) {
             break;
         case vmul_vmull_by_scalar: // VMUL, VMULL (by scalar)
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->floating_point ? "F" : "I") + to_string(ins->esize);
+                return (ins->floating_point ? "F" : "I") + decimal_str(ins->esize);
             }
 
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vmul_vmull_integer_and_polynomial: // VMUL, VMULL (integer and polynomial)
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->polynomial ? "P" : "I") + to_string(ins->esize);
+                return (ins->polynomial ? "P" : "I") + decimal_str(ins->esize);
             }
 
-            return (ins->polynomial ? "P" : (ins->unsigned_ ? "U" : "S")) + to_string(ins->esize);
+            return (ins->polynomial ? "P" : (ins->unsigned_ ? "U" : "S")) + decimal_str(ins->esize);
 
         case vpadd_integer: // VPADD (integer)
             switch (ins->size) {
@@ -801,7 +808,7 @@ string dt_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string U_str(const ARMInstruction *ins) {
+ARMText U_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vqmovn_vqmovun: // VQMOVN, VQMOVUN
             return ins->op == 1 ? "U" : "";
@@ -816,7 +823,7 @@ string U_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string size_str(const ARMInstruction *ins) {
+ARMText size_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vst3_single_3_element_structure_from_one_lane:
         case vst2_single_2_element_structure_from_one_lane:
@@ -838,7 +845,7 @@ string size_str(const ARMInstruction *ins) {
         case vrev16_vrev32_vrev64:
         case vqsub:
         case vqshl_vqshlu_immediate:
-            return to_string(ins->esize);
+            return decimal_str(ins->esize);
 
         case vld1_single_element_to_one_lane:
         case vld1_single_element_to_all_lanes:
@@ -896,7 +903,7 @@ string size_str(const ARMInstruction *ins) {
 
             break;
         case vshll: // VSHLL
-            return to_string(ins->esize);
+            return decimal_str(ins->esize);
         case vqrshrn_vqrshrun: // VQRSHRN, VQRSHRUN
         case vqshrn_vqshrun: // VQSHRN, VQSHRUN
         case vrshrn: // VRSHRN
@@ -912,7 +919,7 @@ string size_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string type_str(const ARMInstruction *ins) {
+ARMText type_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vqshl_vqshlu_immediate:
             return ins->src_unsigned ? "U" : "S";
@@ -968,7 +975,7 @@ string type_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string regular_reg_str(unsigned reg) {
+ARMText regular_reg_str(unsigned reg) {
     switch (reg) {
         case 0:
             return "r0";
@@ -1009,7 +1016,7 @@ string regular_reg_str(unsigned reg) {
     return "INVALID";
 }
 
-string coproc_str(unsigned coproc) {
+ARMText coproc_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "p0";
@@ -1050,7 +1057,7 @@ string coproc_str(unsigned coproc) {
     return "INVALID";
 }
 
-string shift_type_str(unsigned shift) {
+ARMText shift_type_str(unsigned shift) {
     switch (shift) {
         case 0:
             return "LSL";
@@ -1069,7 +1076,7 @@ string shift_type_str(unsigned shift) {
     return "INVALID";
 }
 
-string coproc_reg_str(unsigned coproc) {
+ARMText coproc_reg_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "c0";
@@ -1110,7 +1117,7 @@ string coproc_reg_str(unsigned coproc) {
     return "INVALID";
 }
 
-string quad_reg_str(unsigned coproc) {
+ARMText quad_reg_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "q0";
@@ -1151,7 +1158,7 @@ string quad_reg_str(unsigned coproc) {
     return "INVALID";
 }
 
-string double_reg_str(unsigned coproc) {
+ARMText double_reg_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "d0";
@@ -1224,7 +1231,7 @@ string double_reg_str(unsigned coproc) {
     return "INVALID";
 }
 
-string simple_reg_str(unsigned coproc) {
+ARMText simple_reg_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "s0";
@@ -1297,7 +1304,7 @@ string simple_reg_str(unsigned coproc) {
     return "INVALID";
 }
 
-string option_str(const ARMInstruction *ins) {
+ARMText option_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case dbg:
             return integer_to_string(ins->option, ins->option >= 10);
@@ -1340,12 +1347,12 @@ string option_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string endian_specifier_str(unsigned endian) {
+ARMText endian_specifier_str(unsigned endian) {
     return endian ? "BE" : "LE";
 }
 
-string spec_reg_str(const ARMInstruction *ins) {
-    string t;
+ARMText spec_reg_str(const ARMInstruction *ins) {
+    ARMText t;
 
     switch(ins->id) {
         case vmrs:
@@ -1355,7 +1362,7 @@ string spec_reg_str(const ARMInstruction *ins) {
                 case 6: return "MVFR1";
                 case 7: return "MVFR0";
                 case 8: return "FPEXC";
-                default: return "VFP_CUSTOM_REG_" + to_string(ins->reg);
+                default: return "VFP_CUSTOM_REG_" + decimal_str(ins->reg);
             }
             break;
         case vmsr:
@@ -1363,7 +1370,7 @@ string spec_reg_str(const ARMInstruction *ins) {
                 case 0: return "FPSID";
                 case 1: return "FPSCR";
                 case 8: return "FPEXC";
-                default: return "VFP_CUSTOM_REG_" + to_string(ins->reg);
+                default: return "VFP_CUSTOM_REG_" + decimal_str(ins->reg);
             }
             break;
         case mrs:
@@ -1393,29 +1400,29 @@ string spec_reg_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string registers_str(unsigned registers) {
-    string regs;
+ARMText registers_str(unsigned registers) {
+    ARMText regs;
     bool f = false;
     for (unsigned i = 0; i < 32; i++) {
         if (get_bit(registers, i)) {
             regs += i && f ? ", " : "";
             f = true;
-            regs += string(regular_reg_str(i));
+            regs += regular_reg_str(i);
         }
     }
 
     return "{" + regs + "}";
 }
 
-string shift_str(unsigned shift_t, unsigned shift_n) {
+ARMText shift_str(unsigned shift_t, unsigned shift_n) {
     if (shift_t == SRType_RRX && shift_n == 1)
-        return string(shift_type_str(shift_t));
+        return shift_type_str(shift_t);
 
-    string shift = string(shift_type_str(shift_t)) + " #" + integer_to_string(shift_n, false);
+    ARMText shift = shift_type_str(shift_t) + " #" + integer_to_string(shift_n, false);
     return shift;
 }
 
-string rotation_str(unsigned rotation) {
+ARMText rotation_str(unsigned rotation) {
     switch(rotation) {
         case 0:
             return "";
@@ -1430,75 +1437,75 @@ string rotation_str(unsigned rotation) {
     return "INVALID";
 }
 
-string R0_R14_APSR_nzcv(const ARMInstruction *ins) {
-    return ins->t == 15 ? string("apsr_nzcv") : regular_reg_str(ins->t);
+ARMText R0_R14_APSR_nzcv(const ARMInstruction *ins) {
+    return ins->t == 15 ? ARMText("apsr_nzcv") : regular_reg_str(ins->t);
 }
 
-string decode_adc_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_adc_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADC{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adc_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_adc_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADC{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adc_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_adc_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADCS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADCS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adc_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_adc_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: ADC{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADC%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -1506,19 +1513,19 @@ string decode_adc_register_t2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adc_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_adc_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADC{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -1526,19 +1533,19 @@ string decode_adc_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adc_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_adc_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADC{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -1547,144 +1554,144 @@ string decode_adc_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_add_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADDS <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADDS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_add_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: ADDS <Rdn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADDS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_immediate_thumb_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_add_immediate_thumb_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD{S}<c>.W <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_immediate_thumb_t4_to_string(const ARMInstruction *ins) {
+ARMText decode_add_immediate_thumb_t4_to_string(const ARMInstruction *ins) {
     // DEBUG: ADDW<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADDW%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_immediate_arm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_add_immediate_arm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_register_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_add_register_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADDS <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADDS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_register_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_add_register_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD<c> <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_register_thumb_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_add_register_thumb_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -1692,19 +1699,19 @@ string decode_add_register_thumb_t3_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_register_arm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_add_register_arm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -1712,19 +1719,19 @@ string decode_add_register_arm_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_add_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -1733,320 +1740,320 @@ string decode_add_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_sp_plus_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_add_sp_plus_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD<c> <Rd>, SP, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_sp_plus_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_add_sp_plus_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD<c> SP, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " SP, #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_sp_plus_immediate_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_add_sp_plus_immediate_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD{S}<c>.W <Rd>, SP, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_sp_plus_immediate_t4_to_string(const ARMInstruction *ins) {
+ARMText decode_add_sp_plus_immediate_t4_to_string(const ARMInstruction *ins) {
     // DEBUG: ADDW<c> <Rd>, SP, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADDW%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_sp_plus_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_add_sp_plus_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD{S}<c> <Rd>, SP, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_sp_plus_register_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_add_sp_plus_register_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD<c> <Rdm>, SP, <Rdm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->d).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_sp_plus_register_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_add_sp_plus_register_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD<c> SP, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " SP, %s",
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_sp_plus_register_thumb_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_add_sp_plus_register_thumb_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD{S}<c>.W <Rd>, SP, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_add_sp_plus_register_arm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_add_sp_plus_register_arm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD{S}<c> <Rd>, SP, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adr_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_adr_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADR<c> <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adr_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_adr_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB<c>.W <Rd>, pc, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, pc, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adr_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_adr_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: ADD<c>.W <Rd>, pc, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADD%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, pc, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adr_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_adr_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ADR<c> <Rd>, pc, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ADR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, pc, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_adr_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_adr_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB<c> <Rd>, pc, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, pc, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_and_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_and_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: AND{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "AND%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_and_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_and_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: AND{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "AND%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_and_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_and_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ANDS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ANDS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_and_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_and_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: AND{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "AND%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -2054,19 +2061,19 @@ string decode_and_register_t2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_and_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_and_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: AND{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "AND%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -2074,19 +2081,19 @@ string decode_and_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_and_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_and_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: AND{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "AND%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -2095,228 +2102,228 @@ string decode_and_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_asr_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_asr_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ASRS <Rd>, <Rm>, #<shift_n>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ASRS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_asr_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_asr_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: ASR{S}<c>.W <Rd>, <Rm>, #<shift_n>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ASR%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_asr_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_asr_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ASR{S}<c> <Rd>, <Rm>, #<shift_n>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ASR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_asr_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_asr_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ASRS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ASRS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_asr_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_asr_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: ASR{S}<c>.W <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ASR%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_asr_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_asr_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ASR{S}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ASR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_b_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_b_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: B<c> #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "B%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_b_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_b_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: B #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "B"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_b_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_b_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: B<c>.W #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "B%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_b_t4_to_string(const ARMInstruction *ins) {
+ARMText decode_b_t4_to_string(const ARMInstruction *ins) {
     // DEBUG: B.W #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "B.W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bfc_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_bfc_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: BFC<c> <Rd>, #<lsb>, #<width>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BFC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->lsbit, ins->lsbit >= 10).c_str(),
             integer_to_string(ins->msbit - ins->lsbit + 1, ins->msbit - ins->lsbit + 1 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bfc_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_bfc_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BFC<c> <Rd>, #<lsb>, #<width>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BFC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->lsbit, ins->lsbit >= 10).c_str(),
             integer_to_string(ins->msbit - ins->lsbit + 1, ins->msbit - ins->lsbit + 1 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bfi_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_bfi_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: BFI<c> <Rd>, <Rn>, #<lsb>, #<width>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BFI%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -2324,18 +2331,18 @@ string decode_bfi_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->msbit - ins->lsbit + 1, ins->msbit - ins->lsbit + 1 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bfi_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_bfi_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BFI<c> <Rd>, <Rn>, #<lsb>, #<width>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BFI%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -2343,74 +2350,74 @@ string decode_bfi_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->msbit - ins->lsbit + 1, ins->msbit - ins->lsbit + 1 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bic_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_bic_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: BIC{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BIC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bic_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_bic_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BIC{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BIC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bic_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_bic_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: BICS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BICS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bic_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_bic_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: BIC{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BIC%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -2418,19 +2425,19 @@ string decode_bic_register_t2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bic_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_bic_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BIC{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BIC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -2438,19 +2445,19 @@ string decode_bic_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bic_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_bic_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BIC{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BIC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -2459,241 +2466,241 @@ string decode_bic_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bkpt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_bkpt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: BKPT #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BKPT"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bkpt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_bkpt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BKPT #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BKPT"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bl_blx_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_bl_blx_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: BL<c> #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bl_blx_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_bl_blx_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: BLX<c> #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BLX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bl_blx_immediate_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_bl_blx_immediate_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: BLX #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BLX"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bl_blx_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_bl_blx_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BL<c> #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_b_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_b_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: B<c> #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "B%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_blx_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_blx_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: BLX<c> <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BLX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_blx_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_blx_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BLX<c> <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BLX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_bx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: BX<c> <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_bx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BX<c> <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bxj_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_bxj_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: BXJ<c> <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BXJ%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_bxj_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_bxj_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: BXJ<c> <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "BXJ%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cbnz_cbz_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_cbnz_cbz_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: CB{N}Z <Rn>, #<label>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CB%s%s",
             N_str(ins).c_str(),
             "Z"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32 + (EncodingIsThumb(ins->encoding) ? 4 : 8)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cdp_cdp2_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_cdp_cdp2_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: CDP<c> <coproc>, #<opc1>, <CRd>, <CRn>, <CRm>, #<opc2>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CDP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -2703,17 +2710,17 @@ string decode_cdp_cdp2_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cdp_cdp2_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_cdp_cdp2_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: CDP2 <coproc>, #<opc1>, <CRd>, <CRn>, <CRm>, #<opc2>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CDP2"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -2723,18 +2730,18 @@ string decode_cdp_cdp2_a2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cdp_cdp2_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_cdp_cdp2_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: CDP<c> <coproc>, #<opc1>, <CRd>, <CRn>, <CRm>, #<opc2>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CDP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -2744,18 +2751,18 @@ string decode_cdp_cdp2_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cdp_cdp2_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_cdp_cdp2_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: CDP2<c> <coproc>, #<opc1>, <CRd>, <CRn>, <CRm>, #<opc2>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CDP2%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -2765,161 +2772,161 @@ string decode_cdp_cdp2_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_clrex_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_clrex_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: CLREX<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CLREX%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_clrex_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_clrex_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: CLREX
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CLREX"
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_clz_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_clz_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: CLZ<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CLZ%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_clz_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_clz_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: CLZ<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CLZ%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmn_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmn_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMN<c> <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMN%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmn_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmn_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMN<c> <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMN%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmn_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmn_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMN<c> <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMN%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmn_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_cmn_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: CMN<c>.W <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMN%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmn_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmn_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMN<c> <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMN%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmn_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmn_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMN<c> <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMN%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
@@ -2927,141 +2934,141 @@ string decode_cmn_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmp_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmp_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMP<c> <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmp_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_cmp_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: CMP<c>.W <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMP%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmp_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmp_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMP<c> <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmp_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmp_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMP<c> <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmp_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_cmp_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: CMP<c> <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmp_register_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_cmp_register_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: CMP<c>.W <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMP%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmp_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmp_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMP<c> <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_cmp_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_cmp_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: CMP<c> <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "CMP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
@@ -3069,168 +3076,168 @@ string decode_cmp_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_dbg_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_dbg_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: DBG<c> #<option>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "DBG%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             option_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_dbg_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_dbg_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: DBG<c> #<option>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "DBG%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             option_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_dmb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_dmb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: DMB<c> <option>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "DMB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             option_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_dmb_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_dmb_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: DMB <option>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "DMB"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             option_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_dsb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_dsb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: DSB<c> <option>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "DSB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             option_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_dsb_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_dsb_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: DSB <option>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "DSB"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             option_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_eor_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_eor_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: EOR{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "EOR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_eor_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_eor_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: EOR{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "EOR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_eor_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_eor_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: EORS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "EORS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_eor_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_eor_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: EOR{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "EOR%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -3238,19 +3245,19 @@ string decode_eor_register_t2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_eor_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_eor_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: EOR{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "EOR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -3258,19 +3265,19 @@ string decode_eor_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_eor_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_eor_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: EOR{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "EOR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -3279,298 +3286,298 @@ string decode_eor_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_isb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_isb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ISB<c> <option>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ISB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             option_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_isb_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_isb_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ISB <option>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ISB"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             option_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rfe_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_rfe_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: RFEDB<c> <Rn>{!}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RFEDB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : ""
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rfe_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_rfe_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: RFE{IA}<c> <Rn>{!}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RFE%s%s",
             IA_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : ""
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rfe_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rfe_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: RFE<amode> <Rn>{!}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RFE%s",
             amode_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : ""
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldm_ldmia_ldmfd_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldm_ldmia_ldmfd_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDM<c>.W <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDM%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldm_ldmia_ldmfd_arm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldm_ldmia_ldmfd_arm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDM<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDM%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldmda_ldmfa_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldmda_ldmfa_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDMDA<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDMDA%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldmdb_ldmea_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldmdb_ldmea_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDMDB<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDMDB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldmdb_ldmea_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldmdb_ldmea_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDMDB<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDMDB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldmib_ldmed_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldmib_ldmed_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDMIB<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDMIB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldr_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldr_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDR<c> <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldr_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldr_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDR<c> <Rt>, [SP{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [SP, #%s]",
             regular_reg_str(ins->t).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldr_immediate_thumb_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_ldr_immediate_thumb_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: LDR<c>.W <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDR%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pld_pldw_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_pld_pldw_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLD{W} [<Rn>, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLD%s",
             W_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, #%s%s]",
             regular_reg_str(ins->n).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pld_literal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_pld_literal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLD [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLD"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [pc, #%s%s]",
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pld_pldw_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_pld_pldw_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLD{W} [<Rn>, +/-<Rm>{, <shift>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLD%s",
             W_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, %s%s, %s]",
             regular_reg_str(ins->n).c_str(),
             ins->add ? "" : "-",
@@ -3578,35 +3585,35 @@ string decode_pld_pldw_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pli_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_pli_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLI<c> [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLI%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, %s, LSL #%s]",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pli_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_pli_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLI [<Rn>, +/-<Rm>{, <shift>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLI"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, %s%s, %s]",
             regular_reg_str(ins->n).c_str(),
             ins->add ? "" : "-",
@@ -3614,109 +3621,109 @@ string decode_pli_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pli_immediate_literal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_pli_immediate_literal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLI [<Rn>, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLI"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, #%s%s]",
             regular_reg_str(ins->n).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldr_literal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldr_literal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDR<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldr_literal_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldr_literal_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDR<c>.W <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDR%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldr_literal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldr_literal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDR<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldr_register_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldr_register_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDR<c> <Rt>, [<Rn>, <Rm>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldr_register_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldr_register_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDR<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDR%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s, LSL #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -3724,110 +3731,110 @@ string decode_ldr_register_thumb_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrb_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrb_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRB<c> <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrb_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrb_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRB<c>.W <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRB%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrb_literal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrb_literal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRB<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrb_literal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrb_literal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRB<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrb_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrb_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRB<c> <Rt>, [<Rn>, <Rm>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrb_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrb_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRB<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRB%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s, LSL #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -3835,36 +3842,36 @@ string decode_ldrb_register_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrbt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrbt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRBT<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRBT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrbt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrbt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRBT<c> <Rt>, [<Rn>], #+/-<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRBT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], #%s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -3872,18 +3879,18 @@ string decode_ldrbt_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrbt_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrbt_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRBT<c> <Rt>, [<Rn>], +/-<Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRBT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], %s%s, %s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -3892,18 +3899,18 @@ string decode_ldrbt_a2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrd_literal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrd_literal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRD<c> <Rt>, <Rt2>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->t2).c_str(),
@@ -3911,18 +3918,18 @@ string decode_ldrd_literal_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrd_literal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrd_literal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRD<c> <Rt>, <Rt2>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->t2).c_str(),
@@ -3930,249 +3937,249 @@ string decode_ldrd_literal_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrex_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrex_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDREX<c> <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDREX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrex_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrex_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDREX<c> <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDREX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrexb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrexb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDREXB<c> <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDREXB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrexb_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrexb_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDREXB<c> <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDREXB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrexd_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrexd_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDREXD<c> <Rt>, <Rt2>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDREXD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->t2).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrexd_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrexd_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDREXD<c> <Rt>, <Rt2>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDREXD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->t2).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrexh_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrexh_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDREXH<c> <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDREXH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrexh_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrexh_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDREXH<c> <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDREXH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrh_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrh_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRH<c> <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrh_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrh_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRH<c>.W <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrh_literal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrh_literal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRH<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrh_literal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrh_literal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRH<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrh_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrh_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRH<c> <Rt>, [<Rn>, <Rm>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrh_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrh_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRH<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s, LSL #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4180,36 +4187,36 @@ string decode_ldrh_register_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrht_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrht_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRHT<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRHT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrht_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrht_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRHT<c> <Rt>, [<Rn>]{, #+/-<imm32>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRHT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], #%s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4217,18 +4224,18 @@ string decode_ldrht_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrht_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrht_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRHT<c> <Rt>, [<Rn>], +/-<Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRHT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], %s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4236,91 +4243,91 @@ string decode_ldrht_a2_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsb_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsb_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSB<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsb_literal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsb_literal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSB<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsb_literal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsb_literal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSB<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsb_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsb_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSB<c> <Rt>, [<Rn>, <Rm>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsb_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsb_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSB<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSB%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s, LSL #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4328,36 +4335,36 @@ string decode_ldrsb_register_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsbt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsbt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSBT<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSBT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsbt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsbt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSBT<c> <Rt>, [<Rn>]{, #+/-<imm32>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSBT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], #%s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4365,18 +4372,18 @@ string decode_ldrsbt_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsbt_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsbt_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSBT<c> <Rt>, [<Rn>], +/-<Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSBT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], %s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4384,91 +4391,91 @@ string decode_ldrsbt_a2_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsh_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsh_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSH<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsh_literal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsh_literal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSH<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsh_literal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsh_literal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSH<c> <Rt>, [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [pc, #%s%s]",
             regular_reg_str(ins->t).c_str(),
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsh_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsh_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSH<c> <Rt>, [<Rn>, <Rm>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsh_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsh_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSH<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s, LSL #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4476,36 +4483,36 @@ string decode_ldrsh_register_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsht_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsht_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSHT<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSHT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsht_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsht_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSHT<c> <Rt>, [<Rn>]{, #+/-<imm32>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSHT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], #%s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4513,18 +4520,18 @@ string decode_ldrsht_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrsht_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrsht_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRSHT<c> <Rt>, [<Rn>], +/-<Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRSHT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], %s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4532,36 +4539,36 @@ string decode_ldrsht_a2_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRT<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRT<c> <Rt>, [<Rn>]{, #+/-<imm32>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], #%s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4569,18 +4576,18 @@ string decode_ldrt_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldrt_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_ldrt_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: LDRT<c> <Rt>, [<Rn>], +/-<Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDRT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], %s%s, %s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4589,240 +4596,240 @@ string decode_ldrt_a2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsl_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_lsl_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LSLS <Rd>, <Rm>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSLS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsl_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_lsl_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LSL{S}<c>.W <Rd>, <Rm>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSL%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsl_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_lsl_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LSL{S}<c> <Rd>, <Rm>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSL%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsl_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_lsl_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LSLS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSLS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsl_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_lsl_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LSL{S}<c>.W <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSL%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsl_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_lsl_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LSL{S}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSL%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsr_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_lsr_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LSRS <Rd>, <Rm>, #<shift_n>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSRS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsr_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_lsr_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LSR{S}<c>.W <Rd>, <Rm>, #<shift_n>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSR%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsr_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_lsr_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LSR{S}<c> <Rd>, <Rm>, #<shift_n>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsr_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_lsr_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: LSRS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSRS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsr_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_lsr_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: LSR{S}<c>.W <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSR%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_lsr_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_lsr_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LSR{S}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LSR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mcr_mcr2_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mcr_mcr2_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MCR<c> <coproc>, #<opc1>, <Rt>, <CRn>, <CRm>{, #<opc2>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MCR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -4832,17 +4839,17 @@ string decode_mcr_mcr2_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mcr_mcr2_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_mcr_mcr2_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: MCR2 <coproc>, #<opc1>, <Rt>, <CRn>, <CRm>{, #<opc2>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MCR2"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -4852,18 +4859,18 @@ string decode_mcr_mcr2_a2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mcr_mcr2_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mcr_mcr2_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MCR<c> <coproc>, #<opc1>, <Rt>, <CRn>, <CRm>{, #<opc2>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MCR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -4873,18 +4880,18 @@ string decode_mcr_mcr2_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mcr_mcr2_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_mcr_mcr2_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: MCR2<c> <coproc>, #<opc1>, <Rt>, <CRn>, <CRm>{, #<opc2>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MCR2%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -4894,18 +4901,18 @@ string decode_mcr_mcr2_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mcrr_mcrr2_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mcrr_mcrr2_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MCRR<c> <coproc>, #<opc1>, <Rt>, <Rt2>, <CRm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MCRR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -4914,18 +4921,18 @@ string decode_mcrr_mcrr2_t1_to_string(const ARMInstruction *ins) {
             coproc_reg_str(ins->CRm).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mcrr_mcrr2_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_mcrr_mcrr2_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: MCRR2<c> <coproc>, #<opc1>, <Rt>, <Rt2>, <CRm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MCRR2%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -4934,17 +4941,17 @@ string decode_mcrr_mcrr2_t2_to_string(const ARMInstruction *ins) {
             coproc_reg_str(ins->CRm).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mcrr_mcrr2_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_mcrr_mcrr2_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: MCRR2 <coproc>, #<opc1>, <Rt>, <Rt2>, <CRm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MCRR2"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -4953,18 +4960,18 @@ string decode_mcrr_mcrr2_a2_to_string(const ARMInstruction *ins) {
             coproc_reg_str(ins->CRm).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mcrr_mcrr2_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mcrr_mcrr2_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MCRR<c> <coproc>, #<opc1>, <Rt>, <Rt2>, <CRm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MCRR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -4973,18 +4980,18 @@ string decode_mcrr_mcrr2_a1_to_string(const ARMInstruction *ins) {
             coproc_reg_str(ins->CRm).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mla_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mla_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MLA<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MLA%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -4992,19 +4999,19 @@ string decode_mla_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mla_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mla_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MLA{S}<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MLA%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -5012,18 +5019,18 @@ string decode_mla_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mls_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mls_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MLS<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MLS%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -5031,18 +5038,18 @@ string decode_mls_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mls_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mls_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MLS<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MLS%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -5050,209 +5057,209 @@ string decode_mls_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mov_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mov_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MOVS <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOVS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mov_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_mov_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: MOV{S}<c>.W <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOV%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mov_immediate_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_mov_immediate_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: MOVW<c> <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOVW%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mov_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mov_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MOV{S}<c> <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOV%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mov_immediate_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_mov_immediate_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: MOVW<c> <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOVW%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mov_register_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mov_register_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MOV<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOV%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mov_register_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_mov_register_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: MOVS <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOVS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mov_register_thumb_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_mov_register_thumb_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: MOV{S}<c>.W <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOV%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mov_register_arm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mov_register_arm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MOV{S}<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOV%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_movt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_movt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MOVT<c> <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOVT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_movt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_movt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MOVT<c> <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MOVT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrc_mrc2_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mrc_mrc2_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MRC<c> <coproc>, #<opc1>, <R0_R14_APSR_nzcv>, <CRn>, <CRm>{, #<opc2>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -5262,17 +5269,17 @@ string decode_mrc_mrc2_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrc_mrc2_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_mrc_mrc2_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: MRC2 <coproc>, #<opc1>, <R0_R14_APSR_nzcv>, <CRn>, <CRm>{, #<opc2>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRC2"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -5282,18 +5289,18 @@ string decode_mrc_mrc2_a2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrc_mrc2_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mrc_mrc2_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MRC<c> <coproc>, #<opc1>, <R0_R14_APSR_nzcv>, <CRn>, <CRm>{, #<opc2>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -5303,18 +5310,18 @@ string decode_mrc_mrc2_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrc_mrc2_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_mrc_mrc2_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: MRC2<c> <coproc>, #<opc1>, <R0_R14_APSR_nzcv>, <CRn>, <CRm>{, #<opc2>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRC2%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s, #%s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -5324,18 +5331,18 @@ string decode_mrc_mrc2_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->opc2, ins->opc2 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrrc_mrrc2_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mrrc_mrrc2_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MRRC<c> <coproc>, #<opc1>, <Rt>, <Rt2>, <CRm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRRC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -5344,17 +5351,17 @@ string decode_mrrc_mrrc2_t1_to_string(const ARMInstruction *ins) {
             coproc_reg_str(ins->CRm).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrrc_mrrc2_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_mrrc_mrrc2_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: MRRC2 <coproc>, #<opc1>, <Rt>, <Rt2>, <CRm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRRC2"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -5363,18 +5370,18 @@ string decode_mrrc_mrrc2_a2_to_string(const ARMInstruction *ins) {
             coproc_reg_str(ins->CRm).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrrc_mrrc2_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mrrc_mrrc2_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MRRC<c> <coproc>, #<opc1>, <Rt>, <Rt2>, <CRm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRRC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -5383,18 +5390,18 @@ string decode_mrrc_mrrc2_a1_to_string(const ARMInstruction *ins) {
             coproc_reg_str(ins->CRm).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrrc_mrrc2_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_mrrc_mrrc2_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: MRRC2<c> <coproc>, #<opc1>, <Rt>, <Rt2>, <CRm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRRC2%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s, %s",
             coproc_str(ins->coproc).c_str(),
             integer_to_string(ins->opc1, ins->opc1 >= 10).c_str(),
@@ -5403,249 +5410,249 @@ string decode_mrrc_mrrc2_t2_to_string(const ARMInstruction *ins) {
             coproc_reg_str(ins->CRm).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrs_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mrs_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MRS<c> <Rd>, <spec_reg>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRS%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             spec_reg_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrs_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mrs_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MRS<c> <Rd>, <spec_reg>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRS%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             spec_reg_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_msr_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_msr_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MSR<c> <spec_reg>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MSR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             spec_reg_str(ins).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_msr_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_msr_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MSR<c> <spec_reg>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MSR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             spec_reg_str(ins).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_msr_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_msr_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MSR<c> <spec_reg>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MSR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             spec_reg_str(ins).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mul_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mul_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MULS <Rdm>, <Rn>, <Rdm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MULS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->d).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mul_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_mul_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: MUL<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MUL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mul_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mul_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MUL{S}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MUL%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mvn_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mvn_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MVN{S}<c> <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MVN%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mvn_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mvn_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MVN{S}<c> <Rd>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MVN%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mvn_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mvn_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MVNS <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MVNS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mvn_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_mvn_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: MVN{S}<c>.W <Rd>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MVN%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mvn_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mvn_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MVN{S}<c> <Rd>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MVN%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mvn_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mvn_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MVN{S}<c> <Rd>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MVN%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
@@ -5653,72 +5660,72 @@ string decode_mvn_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_nop_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_nop_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: NOP<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "NOP%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_nop_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_nop_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: NOP<c>.W
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "NOP%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_nop_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_nop_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: NOP<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "NOP%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_orn_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_orn_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ORN{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ORN%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_orn_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_orn_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ORN{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ORN%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -5726,74 +5733,74 @@ string decode_orn_register_t1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_orr_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_orr_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ORR{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ORR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_orr_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_orr_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ORR{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ORR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_orr_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_orr_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ORRS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ORRS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_orr_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_orr_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: ORR{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ORR%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -5801,19 +5808,19 @@ string decode_orr_register_t2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_orr_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_orr_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ORR{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ORR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -5821,19 +5828,19 @@ string decode_orr_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_orr_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_orr_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ORR{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ORR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -5842,1042 +5849,1042 @@ string decode_orr_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pld_pldw_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_pld_pldw_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLD{W}<c> [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLD%s%s",
             W_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, #%s]",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pld_pldw_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_pld_pldw_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: PLD{W}<c> [<Rn>, #-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLD%s%s",
             W_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, #-%s]",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pld_literal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_pld_literal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLD<c> [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [pc, #%s%s]",
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pld_pldw_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_pld_pldw_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLD{W}<c> [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLD%s%s",
             W_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, %s, LSL #%s]",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pli_immediate_literal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_pli_immediate_literal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: PLI<c> [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLI%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, #%s]",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pli_immediate_literal_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_pli_immediate_literal_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: PLI<c> [<Rn>, #-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLI%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, #-%s]",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pli_immediate_literal_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_pli_immediate_literal_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: PLI<c> [pc, #+/-<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PLI%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [pc, #%s%s]",
             ins->add ? "" : "-",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pop_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_pop_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: POP<c> <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "POP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pop_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_pop_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: POP<c>.W <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "POP%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pop_thumb_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_pop_thumb_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: POP<c>.W <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "POP%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pop_arm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_pop_arm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: POP<c> <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "POP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_pop_arm_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_pop_arm_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: POP<c> <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "POP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_push_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_push_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: PUSH<c> <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PUSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_push_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_push_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: PUSH<c>.W <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PUSH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_push_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_push_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: PUSH<c>.W <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PUSH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_push_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_push_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: PUSH<c> <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PUSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_push_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_push_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: PUSH<c> <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "PUSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qadd_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qadd_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QADD<c> <Rd>, <Rm>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QADD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qadd_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qadd_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QADD<c> <Rd>, <Rm>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QADD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qadd16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qadd16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qadd16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qadd16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qadd8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qadd8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qadd8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qadd8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qasx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qasx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qasx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qasx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qdadd_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qdadd_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QDADD<c> <Rd>, <Rm>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QDADD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qdadd_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qdadd_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QDADD<c> <Rd>, <Rm>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QDADD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qdsub_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qdsub_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QDSUB<c> <Rd>, <Rm>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QDSUB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qdsub_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qdsub_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QDSUB<c> <Rd>, <Rm>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QDSUB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qsax_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qsax_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qsax_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qsax_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qsub_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qsub_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QSUB<c> <Rd>, <Rm>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QSUB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qsub_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qsub_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QSUB<c> <Rd>, <Rm>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QSUB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qsub16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qsub16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qsub16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qsub16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qsub8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_qsub8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: QSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_qsub8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_qsub8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: QSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "QSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rbit_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_rbit_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: RBIT<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RBIT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rbit_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rbit_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: RBIT<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RBIT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rev_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_rev_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: REV<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "REV%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rev_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_rev_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: REV<c>.W <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "REV%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rev_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rev_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: REV<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "REV%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rev16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_rev16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: REV16<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "REV16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rev16_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_rev16_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: REV16<c>.W <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "REV16%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rev16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rev16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: REV16<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "REV16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_revsh_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_revsh_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: REVSH<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "REVSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_revsh_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_revsh_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: REVSH<c>.W <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "REVSH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_revsh_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_revsh_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: REVSH<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "REVSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ror_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ror_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ROR{S}<c> <Rd>, <Rm>, #<shift_n>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ROR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ror_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ror_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ROR{S}<c> <Rd>, <Rm>, #<shift_n>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ROR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ror_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ror_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: RORS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RORS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ror_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_ror_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: ROR{S}<c>.W <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ROR%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ror_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ror_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ROR{S}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ROR%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rrx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_rrx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: RRX{S}<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RRX%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rrx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rrx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: RRX{S}<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RRX%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rsb_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_rsb_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: RSB{S} <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RSB%s",
             S_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rsb_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_rsb_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: RSB{S}<c>.W <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RSB%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rsb_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rsb_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: RSB{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RSB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rsb_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_rsb_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: RSB{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RSB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -6885,19 +6892,19 @@ string decode_rsb_register_t1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rsb_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rsb_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: RSB{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RSB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -6905,19 +6912,19 @@ string decode_rsb_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rsb_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rsb_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: RSB{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RSB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -6926,38 +6933,38 @@ string decode_rsb_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rsc_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rsc_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: RSC{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RSC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rsc_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rsc_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: RSC{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RSC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -6965,19 +6972,19 @@ string decode_rsc_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_rsc_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_rsc_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: RSC{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "RSC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -6986,182 +6993,182 @@ string decode_rsc_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sadd16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sadd16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sadd16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sadd16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sadd8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sadd8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sadd8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sadd8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sasx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sasx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sasx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sasx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sbc_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sbc_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SBC{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SBC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sbc_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sbc_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SBC{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SBC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sbc_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sbc_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SBCS <Rdn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SBCS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sbc_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_sbc_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SBC{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SBC%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7169,19 +7176,19 @@ string decode_sbc_register_t2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sbc_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sbc_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SBC{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SBC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7189,19 +7196,19 @@ string decode_sbc_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sbc_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sbc_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SBC{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SBC%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7210,18 +7217,18 @@ string decode_sbc_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sbfx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sbfx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SBFX<c> <Rd>, <Rn>, #<lsb>, #<widthminus1>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SBFX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7229,18 +7236,18 @@ string decode_sbfx_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->widthminus1 + 1, ins->widthminus1 + 1 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sbfx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sbfx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SBFX<c> <Rd>, <Rn>, #<lsb>, #<widthminus1>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SBFX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7248,372 +7255,372 @@ string decode_sbfx_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->widthminus1 + 1, ins->widthminus1 + 1 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sdiv_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sdiv_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SDIV<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SDIV%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sdiv_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sdiv_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SDIV<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SDIV%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sel_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sel_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SEL<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SEL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sel_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sel_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SEL<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SEL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_setend_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_setend_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SETEND <endian_specifier>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SETEND"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             endian_specifier_str(ins->set_bigend).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_setend_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_setend_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SETEND <endian_specifier>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SETEND"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             endian_specifier_str(ins->set_bigend).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sev_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sev_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SEV<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SEV%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_sev_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_sev_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SEV<c>.W
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SEV%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_sev_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sev_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SEV<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SEV%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_shadd16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_shadd16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shadd16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_shadd16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shadd8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_shadd8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shadd8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_shadd8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shasx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_shasx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shasx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_shasx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shsax_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_shsax_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shsax_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_shsax_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shsub16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_shsub16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shsub16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_shsub16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shsub8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_shsub8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_shsub8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_shsub8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SHSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SHSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlabb_smlabt_smlatb_smlatt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlabb_smlabt_smlatb_smlatt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLA<x><y><c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLA%s%s%s",
             x_str(ins).c_str(),
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7621,20 +7628,20 @@ string decode_smlabb_smlabt_smlatb_smlatt_t1_to_string(const ARMInstruction *ins
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlabb_smlabt_smlatb_smlatt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlabb_smlabt_smlatb_smlatt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLA<x><y><c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLA%s%s%s",
             x_str(ins).c_str(),
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7642,19 +7649,19 @@ string decode_smlabb_smlabt_smlatb_smlatt_a1_to_string(const ARMInstruction *ins
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlad_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlad_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLAD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLAD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7662,19 +7669,19 @@ string decode_smlad_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlad_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlad_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLAD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLAD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7682,18 +7689,18 @@ string decode_smlad_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLAL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLAL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -7701,19 +7708,19 @@ string decode_smlal_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLAL{S}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLAL%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -7721,20 +7728,20 @@ string decode_smlal_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlalbb_smlalbt_smlaltb_smlaltt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlalbb_smlalbt_smlaltb_smlaltt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLAL<x><y><c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLAL%s%s%s",
             x_str(ins).c_str(),
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -7742,20 +7749,20 @@ string decode_smlalbb_smlalbt_smlaltb_smlaltt_t1_to_string(const ARMInstruction
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlalbb_smlalbt_smlaltb_smlaltt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlalbb_smlalbt_smlaltb_smlaltt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLAL<x><y><c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLAL%s%s%s",
             x_str(ins).c_str(),
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -7763,19 +7770,19 @@ string decode_smlalbb_smlalbt_smlaltb_smlaltt_a1_to_string(const ARMInstruction
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlald_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlald_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLALD{X}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLALD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -7783,19 +7790,19 @@ string decode_smlald_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlald_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlald_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLALD{X}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLALD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -7803,19 +7810,19 @@ string decode_smlald_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlawb_smlawt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlawb_smlawt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLAW<y><c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLAW%s%s",
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7823,19 +7830,19 @@ string decode_smlawb_smlawt_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlawb_smlawt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlawb_smlawt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLAW<y><c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLAW%s%s",
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7843,19 +7850,19 @@ string decode_smlawb_smlawt_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlsd_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlsd_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLSD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLSD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7863,19 +7870,19 @@ string decode_smlsd_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlsd_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlsd_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLSD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLSD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7883,19 +7890,19 @@ string decode_smlsd_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlsld_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlsld_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLSLD{X}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLSLD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -7903,19 +7910,19 @@ string decode_smlsld_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smlsld_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smlsld_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMLSLD{X}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMLSLD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -7923,19 +7930,19 @@ string decode_smlsld_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smmla_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smmla_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMMLA{R}<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMMLA%s%s",
             R_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7943,19 +7950,19 @@ string decode_smmla_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smmla_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smmla_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMMLA{R}<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMMLA%s%s",
             R_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7963,19 +7970,19 @@ string decode_smmla_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smmls_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smmls_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMMLS{R}<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMMLS%s%s",
             R_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -7983,19 +7990,19 @@ string decode_smmls_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smmls_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smmls_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMMLS{R}<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMMLS%s%s",
             R_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -8003,134 +8010,134 @@ string decode_smmls_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smmul_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smmul_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMMUL{R}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMMUL%s%s",
             R_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smmul_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smmul_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMMUL{R}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMMUL%s%s",
             R_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smuad_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smuad_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMUAD{X}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMUAD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smuad_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smuad_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMUAD{X}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMUAD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smulbb_smulbt_smultb_smultt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smulbb_smulbt_smultb_smultt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMUL<x><y><c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMUL%s%s%s",
             x_str(ins).c_str(),
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smulbb_smulbt_smultb_smultt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smulbb_smulbt_smultb_smultt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMUL<x><y><c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMUL%s%s%s",
             x_str(ins).c_str(),
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smull_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smull_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMULL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMULL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -8138,19 +8145,19 @@ string decode_smull_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smull_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smull_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMULL{S}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMULL%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -8158,94 +8165,94 @@ string decode_smull_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smulwb_smulwt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smulwb_smulwt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMULW<y><c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMULW%s%s",
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smulwb_smulwt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smulwb_smulwt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMULW<y><c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMULW%s%s",
             y_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smusd_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smusd_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMUSD{X}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMUSD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smusd_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_smusd_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMUSD{X}<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMUSD%s%s",
             X_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssat_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssat_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSAT<c> <Rd>, #<saturate_to>, <Rn>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSAT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->saturate_to, false).c_str(),
@@ -8253,18 +8260,18 @@ string decode_ssat_t1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssat_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssat_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSAT<c> <Rd>, #<saturate_to>, <Rn>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSAT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->saturate_to, false).c_str(),
@@ -8272,361 +8279,361 @@ string decode_ssat_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssat16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssat16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSAT16<c> <Rd>, #<saturate_to>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSAT16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->saturate_to, false).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssat16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssat16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSAT16<c> <Rd>, #<saturate_to>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSAT16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->saturate_to, false).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssax_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssax_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssax_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssax_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssub16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssub16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssub16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssub16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssub8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssub8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ssub8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ssub8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_stm_stmia_stmea_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_stm_stmia_stmea_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STM<c> <Rn>!, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STM%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s!, %s",
             regular_reg_str(ins->n).c_str(),
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_stm_stmia_stmea_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_stm_stmia_stmea_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: STM<c>.W <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STM%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_stm_stmia_stmea_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_stm_stmia_stmea_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STM<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STM%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_stmda_stmed_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_stmda_stmed_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STMDA<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STMDA%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_stmdb_stmfd_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_stmdb_stmfd_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STMDB<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STMDB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_stmdb_stmfd_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_stmdb_stmfd_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STMDB<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STMDB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_stmib_stmfa_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_stmib_stmfa_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STMIB<c> <Rn>{!}, <registers>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STMIB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_str_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_str_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STR<c> <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_str_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_str_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: STR<c> <Rt>, [SP, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [SP, #%s]",
             regular_reg_str(ins->t).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_str_immediate_thumb_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_str_immediate_thumb_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: STR<c>.W <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STR%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_str_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_str_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STR<c> <Rt>, [<Rn>, <Rm>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_str_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_str_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: STR<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STR%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s, LSL #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -8634,74 +8641,74 @@ string decode_str_register_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strb_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strb_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRB<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strb_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_strb_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: STRB<c>.W <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRB%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strb_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strb_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRB<c> <Rt>, [<Rn>, <Rm>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strb_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_strb_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: STRB<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRB%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s, LSL #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -8709,36 +8716,36 @@ string decode_strb_register_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strbt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strbt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRBT<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRBT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strbt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_strbt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRBT<c> <Rt>, [<Rn>], #+/-<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRBT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], #%s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -8746,18 +8753,18 @@ string decode_strbt_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strbt_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_strbt_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: STRBT<c> <Rt>, [<Rn>], +/-<Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRBT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], %s%s, %s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -8766,18 +8773,18 @@ string decode_strbt_a2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strex_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strex_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STREX<c> <Rd>, <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STREX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [%s, #%s]",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->t).c_str(),
@@ -8785,72 +8792,72 @@ string decode_strex_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strex_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_strex_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STREX<c> <Rd>, <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STREX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [%s]",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strexb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strexb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STREXB<c> <Rd>, <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STREXB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [%s]",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strexb_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_strexb_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STREXB<c> <Rd>, <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STREXB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [%s]",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strexd_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strexd_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STREXD<c> <Rd>, <Rt>, <Rt2>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STREXD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, [%s]",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->t).c_str(),
@@ -8858,18 +8865,18 @@ string decode_strexd_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strexd_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_strexd_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STREXD<c> <Rd>, <Rt>, <Rt2>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STREXD%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, [%s]",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->t).c_str(),
@@ -8877,110 +8884,110 @@ string decode_strexd_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strexh_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strexh_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STREXH<c> <Rd>, <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STREXH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [%s]",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strexh_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_strexh_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STREXH<c> <Rd>, <Rt>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STREXH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [%s]",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strh_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strh_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRH<c> <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strh_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_strh_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: STRH<c>.W <Rt>, [<Rn>{, #<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strh_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strh_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRH<c> <Rt>, [<Rn>, <Rm>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strh_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_strh_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: STRH<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<shift_n>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, %s, LSL #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -8988,36 +8995,36 @@ string decode_strh_register_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->shift_n, ins->shift_n >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strht_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strht_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRHT<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRHT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strht_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_strht_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRHT<c> <Rt>, [<Rn>]{, #+/-<imm32>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRHT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], #%s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9025,18 +9032,18 @@ string decode_strht_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strht_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_strht_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: STRHT<c> <Rt>, [<Rn>], +/-<Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRHT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], %s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9044,36 +9051,36 @@ string decode_strht_a2_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strt_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_strt_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRT<c> <Rt>, [<Rn>, #<imm32>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strt_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_strt_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STRT<c> <Rt>, [<Rn>]{, #+/-<imm32>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], #%s%s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9081,18 +9088,18 @@ string decode_strt_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_strt_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_strt_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: STRT<c> <Rt>, [<Rn>], +/-<Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STRT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s], %s%s, %s",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9101,127 +9108,127 @@ string decode_strt_a2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_immediate_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUBS <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUBS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_immediate_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SUBS <Rdn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUBS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_immediate_thumb_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_immediate_thumb_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB{S}<c>.W <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_immediate_thumb_t4_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_immediate_thumb_t4_to_string(const ARMInstruction *ins) {
     // DEBUG: SUBW<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUBW%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_immediate_arm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_immediate_arm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB{S}<c> <Rd>, <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUBS <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUBS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9229,19 +9236,19 @@ string decode_sub_register_t2_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9249,19 +9256,19 @@ string decode_sub_register_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB{S}<c> <Rd>, <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9270,177 +9277,177 @@ string decode_sub_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_sp_minus_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_sp_minus_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB<c> SP, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " SP, #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_sp_minus_immediate_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_sp_minus_immediate_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB{S}<c>.W <Rd>, SP, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_sp_minus_immediate_t3_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_sp_minus_immediate_t3_to_string(const ARMInstruction *ins) {
     // DEBUG: SUBW<c> <Rd>, SP, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUBW%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_sp_minus_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_sp_minus_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB{S}<c> <Rd>, SP, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, #%s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_sp_minus_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_sp_minus_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB{S}<c> <Rd>, SP, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sub_sp_minus_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sub_sp_minus_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUB{S}<c> <Rd>, SP, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUB%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, SP, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_svc_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_svc_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SVC<c> #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SVC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_svc_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_svc_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SVC<c> #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SVC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_swp_swpb_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_swp_swpb_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SWP{B}<c> <Rt>, <Rt2>, [<Rn>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SWP%s%s",
             B_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, [%s]",
             regular_reg_str(ins->t).c_str(),
             regular_reg_str(ins->t2).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtab_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtab_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTAB<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTAB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9448,18 +9455,18 @@ string decode_sxtab_t1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtab_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtab_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTAB<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTAB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9467,18 +9474,18 @@ string decode_sxtab_a1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtab16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtab16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTAB16<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTAB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9486,18 +9493,18 @@ string decode_sxtab16_t1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtab16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtab16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTAB16<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTAB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9505,18 +9512,18 @@ string decode_sxtab16_a1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtah_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtah_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTAH<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTAH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9524,18 +9531,18 @@ string decode_sxtah_t1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtah_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtah_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTAH<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTAH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -9543,266 +9550,266 @@ string decode_sxtah_a1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTB<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTB<c>.W <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTB%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtb_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtb_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTB<c> <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtb16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtb16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTB16<c> <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxtb16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxtb16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTB16<c> <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxth_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxth_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTH<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxth_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_sxth_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTH<c>.W <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_sxth_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_sxth_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SXTH<c> <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SXTH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_tbb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_tbb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: TBB<c> [<Rn>, <Rm>]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TBB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, %s]",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_tbh_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_tbh_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: TBH<c> [<Rn>, <Rm>, LSL #1]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TBH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " [%s, %s, LSL #1]",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_teq_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_teq_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: TEQ<c> <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TEQ%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_teq_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_teq_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: TEQ<c> <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TEQ%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_teq_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_teq_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: TEQ<c> <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TEQ%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_teq_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_teq_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: TEQ<c> <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TEQ%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_teq_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_teq_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: TEQ<c> <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TEQ%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
@@ -9810,106 +9817,106 @@ string decode_teq_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_tst_immediate_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_tst_immediate_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: TST<c> <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TST%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_tst_immediate_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_tst_immediate_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: TST<c> <Rn>, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TST%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s",
             regular_reg_str(ins->n).c_str(),
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_tst_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_tst_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: TST<c> <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TST%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_tst_register_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_tst_register_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: TST<c>.W <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TST%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_tst_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_tst_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: TST<c> <Rn>, <Rm>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TST%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_tst_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_tst_register_shifted_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: TST<c> <Rn>, <Rm>, <type> <Rs>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "TST%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s %s",
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str(),
@@ -9917,126 +9924,126 @@ string decode_tst_register_shifted_register_a1_to_string(const ARMInstruction *i
             regular_reg_str(ins->s).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uadd16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uadd16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uadd16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uadd16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uadd8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uadd8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uadd8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uadd8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uasx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uasx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uasx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uasx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ubfx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_ubfx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UBFX<c> <Rd>, <Rn>, #<lsb>, #<widthminus1>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UBFX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -10044,18 +10051,18 @@ string decode_ubfx_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->widthminus1 + 1, ins->widthminus1 + 1 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ubfx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ubfx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UBFX<c> <Rd>, <Rn>, #<lsb>, #<widthminus1>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UBFX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s, #%s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -10063,318 +10070,318 @@ string decode_ubfx_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->widthminus1 + 1, ins->widthminus1 + 1 >= 10).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_udf_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_udf_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UDF<c> #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UDF%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_udf_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_udf_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: UDF<c>.W #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UDF%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_udf_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_udf_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UDF #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UDF"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_udiv_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_udiv_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UDIV<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UDIV%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_udiv_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_udiv_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UDIV<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UDIV%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhadd16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhadd16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhadd16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhadd16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhadd8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhadd8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhadd8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhadd8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhasx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhasx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhasx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhasx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhsax_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhsax_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhsax_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhsax_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhsub16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhsub16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhsub16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhsub16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhsub8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhsub8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uhsub8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uhsub8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UHSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UHSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_umaal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_umaal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UMAAL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UMAAL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -10382,18 +10389,18 @@ string decode_umaal_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_umaal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_umaal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UMAAL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UMAAL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -10401,18 +10408,18 @@ string decode_umaal_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_umlal_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_umlal_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UMLAL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UMLAL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -10420,19 +10427,19 @@ string decode_umlal_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_umlal_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_umlal_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UMLAL{S}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UMLAL%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -10440,18 +10447,18 @@ string decode_umlal_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_umull_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_umull_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UMULL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UMULL%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -10459,19 +10466,19 @@ string decode_umull_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_umull_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_umull_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UMULL{S}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UMULL%s%s",
             S_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->dLo).c_str(),
             regular_reg_str(ins->dHi).c_str(),
@@ -10479,270 +10486,270 @@ string decode_umull_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqadd16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqadd16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqadd16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqadd16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQADD16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQADD16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqadd8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqadd8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqadd8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqadd8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQADD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQADD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqasx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqasx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqasx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqasx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQASX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQASX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqsax_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqsax_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqsax_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqsax_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQSAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQSAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqsub16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqsub16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqsub16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqsub16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQSUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQSUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqsub8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqsub8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uqsub8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uqsub8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UQSUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UQSUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usad8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_usad8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: USAD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USAD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usad8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_usad8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: USAD8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USAD8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usada8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_usada8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: USADA8<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USADA8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -10750,18 +10757,18 @@ string decode_usada8_t1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usada8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_usada8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: USADA8<c> <Rd>, <Rn>, <Rm>, <Ra>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USADA8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -10769,18 +10776,18 @@ string decode_usada8_a1_to_string(const ARMInstruction *ins) {
             regular_reg_str(ins->a).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usat_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_usat_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: USAT<c> <Rd>, #<saturate_to>, <Rn>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USAT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->saturate_to, false).c_str(),
@@ -10788,18 +10795,18 @@ string decode_usat_t1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usat_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_usat_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: USAT<c> <Rd>, #<saturate_to>, <Rn>{, <shift>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USAT%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->saturate_to, false).c_str(),
@@ -10807,162 +10814,162 @@ string decode_usat_a1_to_string(const ARMInstruction *ins) {
             shift_str(ins->shift_t, ins->shift_n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usat16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_usat16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: USAT16<c> <Rd>, #<saturate_to>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USAT16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->saturate_to, false).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usat16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_usat16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: USAT16<c> <Rd>, #<saturate_to>, <Rn>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USAT16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, #%s, %s",
             regular_reg_str(ins->d).c_str(),
             integer_to_string(ins->saturate_to, false).c_str(),
             regular_reg_str(ins->n).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usax_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_usax_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: USAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usax_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_usax_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: USAX<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USAX%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usub16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_usub16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: USUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usub16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_usub16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: USUB16<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USUB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usub8_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_usub8_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: USUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_usub8_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_usub8_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: USUB8<c> <Rd>, <Rn>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "USUB8%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtab_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtab_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTAB<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTAB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -10970,18 +10977,18 @@ string decode_uxtab_t1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtab_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtab_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTAB<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTAB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -10989,18 +10996,18 @@ string decode_uxtab_a1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtab16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtab16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTAB16<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTAB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -11008,18 +11015,18 @@ string decode_uxtab16_t1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtab16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtab16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTAB16<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTAB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -11027,18 +11034,18 @@ string decode_uxtab16_a1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtah_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtah_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTAH<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTAH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -11046,18 +11053,18 @@ string decode_uxtah_t1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtah_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtah_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTAH<c> <Rd>, <Rn>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTAH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -11065,648 +11072,648 @@ string decode_uxtah_a1_to_string(const ARMInstruction *ins) {
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTB<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTB<c>.W <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTB%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtb_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtb_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTB<c> <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtb16_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtb16_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTB16<c> <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxtb16_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxtb16_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTB16<c> <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTB16%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxth_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxth_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTH<c> <Rd>, <Rm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxth_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_uxth_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTH<c>.W <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTH%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_uxth_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_uxth_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: UXTH<c> <Rd>, <Rm>{, <rotation>}
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "UXTH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             regular_reg_str(ins->d).c_str(),
             regular_reg_str(ins->m).c_str(),
             rotation_str(ins->rotation).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_wfe_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_wfe_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: WFE<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "WFE%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_wfe_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_wfe_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: WFE<c>.W
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "WFE%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_wfe_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_wfe_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: WFE<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "WFE%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_wfi_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_wfi_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: WFI<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "WFI%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_wfi_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_wfi_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: WFI<c>.W
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "WFI%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_wfi_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_wfi_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: WFI<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "WFI%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_yield_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_yield_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: YIELD<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "YIELD%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_yield_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_yield_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: YIELD<c>.W
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "YIELD%s%s",
             c_str(ins).c_str(),
             ".W"
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_yield_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_yield_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: YIELD<c>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "YIELD%s",
             c_str(ins).c_str()
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_eret_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_eret_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: ERET
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ERET"
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_eret_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_eret_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: ERET
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "ERET"
     );
 
-    return string(op_name);
+    return text;
 }
 
-string decode_hvc_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_hvc_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: HVC #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "HVC"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_hvc_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_hvc_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: HVC #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "HVC"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldm_exception_return_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldm_exception_return_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDM<amode><c> <Rn>{!}, <registers_with_pc> ^
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDM%s%s",
             amode_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s ^",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             registers_str(ins->registers | (1 << 15)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_ldm_user_registers_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_ldm_user_registers_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: LDM<amode><c> <Rn>, <registers_without_pc> ^
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "LDM%s%s",
             amode_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s ^",
             regular_reg_str(ins->n).c_str(),
             registers_str(ins->registers & ((1 << 15) - 1)).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrs_banked_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_mrs_banked_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: MRS<c> <Rd>, <banked_reg>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRS%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             banked_reg(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_mrs_banked_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_mrs_banked_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: MRS<c> <Rd>, <banked_reg>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "MRS%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->d).c_str(),
             banked_reg(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smc_previously_smi_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_smc_previously_smi_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SMC<c> #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_smc_previously_smi_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_smc_previously_smi_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SMC<c> #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SMC%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_srs_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_srs_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SRSDB<c> SP{!}, #<mode>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SRSDB%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " SP%s, #%s",
             ins->wback ? "!" : "",
             integer_to_string(ins->mode, false).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_srs_thumb_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_srs_thumb_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: SRS{IA}<c> SP{!}, #<mode>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SRS%s%s",
             IA_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " SP%s, #%s",
             ins->wback ? "!" : "",
             integer_to_string(ins->mode, false).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_srs_arm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_srs_arm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: SRS<amode> SP{!}, #<mode>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SRS%s",
             amode_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " SP%s, #%s",
             ins->wback ? "!" : "",
             integer_to_string(ins->mode, false).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_stm_user_registers_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_stm_user_registers_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: STM<amode><c> <Rn>, <registers> ^
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "STM%s%s",
             amode_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s ^",
             regular_reg_str(ins->n).c_str(),
             registers_str(ins->registers).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_subs_pc_lr_thumb_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_subs_pc_lr_thumb_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: SUBS<c> PC, LR, #<imm32>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "SUBS%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " PC, LR, #%s",
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vabd_vabdl_integer_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vabd_vabdl_integer_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VABDL.<dt> <Qd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VABDL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vabd_vabdl_integer_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vabd_vabdl_integer_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VABDL.<dt> <Qd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VABDL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vaddhn_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vaddhn_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VADDHN.<dt> <Dd>, <Qn>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VADDHN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->n >> 1).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vaddhn_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vaddhn_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VADDHN.<dt> <Dd>, <Qn>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VADDHN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->n >> 1).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vldm_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vldm_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VLDM{mode} <Rn>{!}, <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VLDM%s",
             mode_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vldm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vldm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VLDM{mode}<c> <Rn>{!}, <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VLDM%s%s",
             mode_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vldm_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vldm_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VLDM{mode} <Rn>{!}, <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VLDM%s",
             mode_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vldm_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vldm_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VLDM{mode}<c> <Rn>{!}, <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VLDM%s%s",
             mode_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vldr_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vldr_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VLDR <Dd>, [<Rn>{, #+/-<imm>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VLDR"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s%s]",
             double_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -11714,18 +11721,18 @@ string decode_vldr_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vldr_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vldr_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VLDR<c> <Dd>, [<Rn>{, #+/-<imm>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VLDR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s%s]",
             double_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -11733,17 +11740,17 @@ string decode_vldr_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vldr_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vldr_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VLDR <Sd>, [<Rn>{, #+/-<imm>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VLDR"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s%s]",
             simple_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -11751,18 +11758,18 @@ string decode_vldr_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vldr_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vldr_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VLDR<c> <Sd>, [<Rn>{, #+/-<imm>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VLDR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s%s]",
             simple_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -11770,715 +11777,715 @@ string decode_vldr_a2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmov_arm_core_register_to_scalar_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmov_arm_core_register_to_scalar_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMOV.<size> <Dd[x]>, <Rt>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMOV.%s",
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
-            (double_reg_str(ins->d) + "[" + to_string(ins->index) + "]").c_str(),
+            (double_reg_str(ins->d) + "[" + integer_to_string(ins->index, false) + "]").c_str(),
             regular_reg_str(ins->t).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmov_arm_core_register_to_scalar_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmov_arm_core_register_to_scalar_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMOV<c>.<size> <Dd[x]>, <Rt>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMOV%s%s%s",
             c_str(ins).c_str(),
             ".",
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
-            (double_reg_str(ins->d) + "[" + to_string(ins->index) + "]").c_str(),
+            (double_reg_str(ins->d) + "[" + integer_to_string(ins->index, false) + "]").c_str(),
             regular_reg_str(ins->t).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmov_scalar_to_arm_core_register_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmov_scalar_to_arm_core_register_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMOV.<dt> <Rt>, <Dn[x]>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMOV.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->t).c_str(),
-            (double_reg_str(ins->n) + "[" + to_string(ins->index) + "]").c_str()
+            (double_reg_str(ins->n) + "[" + integer_to_string(ins->index, false) + "]").c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmov_scalar_to_arm_core_register_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmov_scalar_to_arm_core_register_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMOV<c>.<dt> <Rt>, <Dn[x]>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMOV%s%s%s",
             c_str(ins).c_str(),
             ".",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->t).c_str(),
-            (double_reg_str(ins->n) + "[" + to_string(ins->index) + "]").c_str()
+            (double_reg_str(ins->n) + "[" + integer_to_string(ins->index, false) + "]").c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmovl_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmovl_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMOVL.<dt> <Qd>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMOVL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmovl_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmovl_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMOVL.<dt> <Qd>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMOVL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmovn_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmovn_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMOVN.<dt> <Dd>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMOVN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmovn_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmovn_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMOVN.<dt> <Dd>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMOVN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmrs_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmrs_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMRS <Rt>, <spec_reg>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMRS"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->t).c_str(),
             spec_reg_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmrs_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmrs_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMRS<c> <Rt>, <spec_reg>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMRS%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             regular_reg_str(ins->t).c_str(),
             spec_reg_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmsr_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmsr_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMSR <spec_reg>, <Rt>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMSR"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             spec_reg_str(ins).c_str(),
             regular_reg_str(ins->t).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmsr_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vmsr_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VMSR<c> <spec_reg>, <Rt>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMSR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             spec_reg_str(ins).c_str(),
             regular_reg_str(ins->t).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmul_vmull_integer_and_polynomial_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vmul_vmull_integer_and_polynomial_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VMULL.<dt> <Qd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMULL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmul_vmull_integer_and_polynomial_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vmul_vmull_integer_and_polynomial_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VMULL.<dt> <Qd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMULL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmul_vmull_by_scalar_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vmul_vmull_by_scalar_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VMULL.<dt> <Qd>, <Dn>, <Dm[x]>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMULL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
-            (double_reg_str(ins->m) + "[" + to_string(ins->index) + "]").c_str()
+            (double_reg_str(ins->m) + "[" + integer_to_string(ins->index, false) + "]").c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vmul_vmull_by_scalar_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vmul_vmull_by_scalar_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VMULL.<dt> <Qd>, <Dn>, <Dm[x]>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VMULL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
-            (double_reg_str(ins->m) + "[" + to_string(ins->index) + "]").c_str()
+            (double_reg_str(ins->m) + "[" + integer_to_string(ins->index, false) + "]").c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpadd_integer_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpadd_integer_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VPADD.<dt> <Dd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPADD.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpadd_integer_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpadd_integer_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VPADD.<dt> <Dd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPADD.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpadd_floating_point_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpadd_floating_point_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VPADD.F32 <Dd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPADD.F32"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpadd_floating_point_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpadd_floating_point_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VPADD.F32 <Dd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPADD.F32"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpmax_vpmin_integer_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpmax_vpmin_integer_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VP<op>.<dt> <Dd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VP%s%s%s",
             op_str(ins).c_str(),
             ".",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpmax_vpmin_integer_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpmax_vpmin_integer_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VP<op>.<dt> <Dd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VP%s%s%s",
             op_str(ins).c_str(),
             ".",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpmax_vpmin_floating_point_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpmax_vpmin_floating_point_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VP<op>.F32 <Dd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VP%s%s",
             op_str(ins).c_str(),
             ".F32"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpmax_vpmin_floating_point_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpmax_vpmin_floating_point_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VP<op>.F32 <Dd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VP%s%s",
             op_str(ins).c_str(),
             ".F32"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpop_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpop_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VPOP <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPOP"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpop_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpop_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VPOP<c> <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPOP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpop_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vpop_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VPOP <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPOP"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpop_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vpop_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VPOP<c> <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPOP%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpush_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpush_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VPUSH <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPUSH"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpush_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vpush_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VPUSH<c> <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPUSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpush_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vpush_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VPUSH <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPUSH"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vpush_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vpush_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VPUSH<c> <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VPUSH%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqdmlal_vqdmlsl_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqdmlal_vqdmlsl_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQD<op>.<dt> <Qd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQD%s%s%s",
             op_str(ins).c_str(),
             ".",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqdmlal_vqdmlsl_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqdmlal_vqdmlsl_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQD<op>.<dt> <Qd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQD%s%s%s",
             op_str(ins).c_str(),
             ".",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqdmlal_vqdmlsl_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vqdmlal_vqdmlsl_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VQD<op>.<dt> <Qd>, <Dn>, <Dm[x]>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQD%s%s%s",
             op_str(ins).c_str(),
             ".",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
-            (double_reg_str(ins->m) + "[" + to_string(ins->index) + "]").c_str()
+            (double_reg_str(ins->m) + "[" + integer_to_string(ins->index, false) + "]").c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqdmlal_vqdmlsl_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vqdmlal_vqdmlsl_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VQD<op>.<dt> <Qd>, <Dn>, <Dm[x]>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQD%s%s%s",
             op_str(ins).c_str(),
             ".",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
-            (double_reg_str(ins->m) + "[" + to_string(ins->index) + "]").c_str()
+            (double_reg_str(ins->m) + "[" + integer_to_string(ins->index, false) + "]").c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqdmull_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqdmull_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQDMULL.<dt> <Qd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQDMULL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqdmull_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqdmull_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQDMULL.<dt> <Qd>, <Dn>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQDMULL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqdmull_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vqdmull_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VQDMULL.<dt> <Qd>, <Dn>, <Dm[x]>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQDMULL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
-            (double_reg_str(ins->m) + "[" + to_string(ins->index) + "]").c_str()
+            (double_reg_str(ins->m) + "[" + integer_to_string(ins->index, false) + "]").c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqdmull_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vqdmull_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VQDMULL.<dt> <Qd>, <Dn>, <Dm[x]>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQDMULL.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->n).c_str(),
-            (double_reg_str(ins->m) + "[" + to_string(ins->index) + "]").c_str()
+            (double_reg_str(ins->m) + "[" + integer_to_string(ins->index, false) + "]").c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqmovn_vqmovun_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqmovn_vqmovun_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQMOV{U}N.<type><size> <Dd>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQMOV%s%s%s%s",
             U_str(ins).c_str(),
             "N.",
@@ -12486,19 +12493,19 @@ string decode_vqmovn_vqmovun_t1_to_string(const ARMInstruction *ins) {
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqmovn_vqmovun_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqmovn_vqmovun_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQMOV{U}N.<type><size> <Dd>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQMOV%s%s%s%s",
             U_str(ins).c_str(),
             "N.",
@@ -12506,19 +12513,19 @@ string decode_vqmovn_vqmovun_a1_to_string(const ARMInstruction *ins) {
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqrshrn_vqrshrun_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqrshrn_vqrshrun_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQRSHR{U}N.<type><size> <Dd>, <Qm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQRSHR%s%s%s%s",
             U_str(ins).c_str(),
             "N.",
@@ -12526,20 +12533,20 @@ string decode_vqrshrn_vqrshrun_t1_to_string(const ARMInstruction *ins) {
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqrshrn_vqrshrun_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqrshrn_vqrshrun_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQRSHR{U}N.<type><size> <Dd>, <Qm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQRSHR%s%s%s%s",
             U_str(ins).c_str(),
             "N.",
@@ -12547,20 +12554,20 @@ string decode_vqrshrn_vqrshrun_a1_to_string(const ARMInstruction *ins) {
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqshrn_vqshrun_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqshrn_vqshrun_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQSHR{U}N.<type><size> <Dd>, <Qm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQSHR%s%s%s%s",
             U_str(ins).c_str(),
             "N.",
@@ -12568,20 +12575,20 @@ string decode_vqshrn_vqshrun_t1_to_string(const ARMInstruction *ins) {
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vqshrn_vqshrun_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vqshrn_vqshrun_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VQSHR{U}N.<type><size> <Dd>, <Qm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VQSHR%s%s%s%s",
             U_str(ins).c_str(),
             "N.",
@@ -12589,318 +12596,318 @@ string decode_vqshrn_vqshrun_a1_to_string(const ARMInstruction *ins) {
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vraddhn_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vraddhn_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VRADDHN.<dt> <Dd>, <Qn>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VRADDHN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->n >> 1).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vraddhn_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vraddhn_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VRADDHN.<dt> <Dd>, <Qn>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VRADDHN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->n >> 1).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vrshrn_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vrshrn_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VRSHRN.I<size> <Dd>, <Qm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VRSHRN.I%s",
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vrshrn_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vrshrn_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VRSHRN.I<size> <Dd>, <Qm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VRSHRN.I%s",
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vrsubhn_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vrsubhn_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VRSUBHN.<dt> <Dd>, <Qn>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VRSUBHN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->n >> 1).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vrsubhn_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vrsubhn_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VRSUBHN.<dt> <Dd>, <Qn>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VRSUBHN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->n >> 1).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vshll_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vshll_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSHLL.<type><size> <Qd>, <Dm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSHLL.%s%s",
             type_str(ins).c_str(),
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vshll_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vshll_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSHLL.<type><size> <Qd>, <Dm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSHLL.%s%s",
             type_str(ins).c_str(),
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vshll_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vshll_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VSHLL.<type><size> <Qd>, <Dm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSHLL.%s%s",
             type_str(ins).c_str(),
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vshll_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vshll_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VSHLL.<type><size> <Qd>, <Dm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSHLL.%s%s",
             type_str(ins).c_str(),
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             quad_reg_str(ins->d >> 1).c_str(),
             double_reg_str(ins->m).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vshrn_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vshrn_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSHRN.I<size> <Dd>, <Qm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSHRN.I%s",
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vshrn_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vshrn_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSHRN.I<size> <Dd>, <Qm>, #<shift_amount>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSHRN.I%s",
             size_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, #%s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->m >> 1).c_str(),
             integer_to_string(ins->shift_amount, true).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vstm_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vstm_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSTM{mode} <Rn>{!}, <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSTM%s",
             mode_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vstm_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vstm_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSTM{mode}<c> <Rn>{!}, <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSTM%s%s",
             mode_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vstm_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vstm_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VSTM{mode} <Rn>{!}, <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSTM%s",
             mode_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vstm_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vstm_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VSTM{mode}<c> <Rn>{!}, <list>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSTM%s%s",
             mode_str(ins).c_str(),
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s%s, %s",
             regular_reg_str(ins->n).c_str(),
             ins->wback ? "!" : "",
             list_str(ins).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vstr_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vstr_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSTR <Dd>, [<Rn>{, #+/-<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSTR"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s%s]",
             double_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -12908,18 +12915,18 @@ string decode_vstr_t1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vstr_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vstr_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSTR<c> <Dd>, [<Rn>{, #+/-<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSTR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s%s]",
             double_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -12927,17 +12934,17 @@ string decode_vstr_a1_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vstr_t2_to_string(const ARMInstruction *ins) {
+ARMText decode_vstr_t2_to_string(const ARMInstruction *ins) {
     // DEBUG: VSTR <Sd>, [<Rn>{, #+/-<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSTR"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s%s]",
             simple_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -12945,18 +12952,18 @@ string decode_vstr_t2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vstr_a2_to_string(const ARMInstruction *ins) {
+ARMText decode_vstr_a2_to_string(const ARMInstruction *ins) {
     // DEBUG: VSTR<c> <Sd>, [<Rn>{, #+/-<imm32>}]
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSTR%s",
             c_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, [%s, #%s%s]",
             simple_reg_str(ins->d).c_str(),
             regular_reg_str(ins->n).c_str(),
@@ -12964,80 +12971,80 @@ string decode_vstr_a2_to_string(const ARMInstruction *ins) {
             integer_to_string(ins->imm32).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vsubhn_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vsubhn_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSUBHN.<dt> <Dd>, <Qn>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSUBHN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->n >> 1).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vsubhn_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vsubhn_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: VSUBHN.<dt> <Dd>, <Qn>, <Qm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "VSUBHN.%s",
             dt_str(ins).c_str()
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             quad_reg_str(ins->n >> 1).c_str(),
             quad_reg_str(ins->m >> 1).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vtbl_vtbx_t1_to_string(const ARMInstruction *ins) {
+ARMText decode_vtbl_vtbx_t1_to_string(const ARMInstruction *ins) {
     // DEBUG: V<op>.8 <Dd>, <list>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "V%s%s",
             op_str(ins).c_str(),
             ".8"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             list_str(ins).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
-string decode_vtbl_vtbx_a1_to_string(const ARMInstruction *ins) {
+ARMText decode_vtbl_vtbx_a1_to_string(const ARMInstruction *ins) {
     // DEBUG: V<op>.8 <Dd>, <list>, <Dm>
-    char op_name[256], op_args[256];
-    snprintf(op_name, sizeof(op_name),
+    ARMText text;
+    text.appendf(
             "V%s%s",
             op_str(ins).c_str(),
             ".8"
     );
 
-    snprintf(op_args, sizeof(op_args),
+    text.appendf(
             " %s, %s, %s",
             double_reg_str(ins->d).c_str(),
             list_str(ins).c_str(),
             double_reg_str(ins->m).c_str()
     );
 
-    return string(op_name) + string(op_args);
+    return text;
 }
 
@@ -3,682 +3,682 @@
 #include "arm/ARMDisassembler.h"
 
 bool is_conditional_thumb(const Disassembler::ARMInstruction *ins);
-std::string B_str(const Disassembler::ARMInstruction *ins);
-std::string IA_str(const Disassembler::ARMInstruction *ins);
-std::string N_str(const Disassembler::ARMInstruction *ins);
-std::string R_str(const Disassembler::ARMInstruction *ins);
-std::string S_str(const Disassembler::ARMInstruction *ins);
-std::string U_str(const Disassembler::ARMInstruction *ins);
-std::string W_str(const Disassembler::ARMInstruction *ins);
-std::string X_str(const Disassembler::ARMInstruction *ins);
-std::string align_str(const Disassembler::ARMInstruction *ins);
-std::string amode_str(const Disassembler::ARMInstruction *ins);
-std::string banked_reg(const Disassembler::ARMInstruction *ins);
-std::string c_str(const Disassembler::ARMInstruction *ins);
-std::string coproc_reg_str(unsigned coproc);
-std::string coproc_str(unsigned coproc);
-std::string double_reg_str(unsigned coproc);
-std::string dt_str(const Disassembler::ARMInstruction *ins);
-std::string effect_str(const Disassembler::ARMInstruction *ins);
-std::string endian_specifier_str(unsigned endian);
-std::string iflags_str(const Disassembler::ARMInstruction *ins);
-std::string list_str(const Disassembler::ARMInstruction *ins);
-std::string mode_str(const Disassembler::ARMInstruction *ins);
-std::string op_str(const Disassembler::ARMInstruction *ins);
-std::string option_str(const Disassembler::ARMInstruction *ins);
-std::string quad_reg_str(unsigned coproc);
-std::string registers_str(unsigned registers);
-std::string regular_reg_str(unsigned reg);
-std::string rotation_str(unsigned rotation);
-std::string shift_str(unsigned shift_t, unsigned shift_n);
-std::string shift_type_str(unsigned shift);
-std::string simple_reg_str(unsigned coproc);
-std::string size_str(const Disassembler::ARMInstruction *ins);
-std::string spec_reg_str(const Disassembler::ARMInstruction *ins);
-std::string type_str(const Disassembler::ARMInstruction *ins);
-std::string x_str(const Disassembler::ARMInstruction *ins);
-std::string y_str(const Disassembler::ARMInstruction *ins);
-std::string decode_adc_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adc_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adc_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adc_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adc_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adc_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_immediate_thumb_t4_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_register_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_register_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_register_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_register_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_sp_plus_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_sp_plus_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_sp_plus_immediate_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_sp_plus_immediate_t4_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_sp_plus_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_sp_plus_register_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_sp_plus_register_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_sp_plus_register_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_add_sp_plus_register_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adr_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adr_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adr_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adr_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_adr_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_and_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_and_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_and_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_and_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_and_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_and_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_asr_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_asr_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_asr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_asr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_asr_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_asr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_b_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_b_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_b_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_b_t4_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bfc_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bfc_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bfi_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bfi_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bic_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bic_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bic_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bic_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bic_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bic_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bkpt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bkpt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bl_blx_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bl_blx_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bl_blx_immediate_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bl_blx_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_b_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_blx_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_blx_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bxj_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_bxj_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cbnz_cbz_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cdp_cdp2_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cdp_cdp2_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cdp_cdp2_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cdp_cdp2_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_clrex_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_clrex_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_clz_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_clz_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmn_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmn_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmn_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmn_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmn_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmp_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmp_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmp_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmp_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmp_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmp_register_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmp_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cmp_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_dbg_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_dbg_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_dmb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_dmb_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_dsb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_dsb_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_eor_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_eor_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_eor_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_eor_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_eor_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_eor_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_isb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_isb_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rfe_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rfe_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rfe_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldm_ldmia_ldmfd_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldm_ldmia_ldmfd_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldmda_ldmfa_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldmdb_ldmea_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldmdb_ldmea_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldmib_ldmed_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pld_pldw_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pld_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pld_pldw_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pli_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pli_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pli_immediate_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_literal_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_register_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_register_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrb_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrb_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrb_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrb_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrb_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrb_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrbt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrbt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrbt_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrd_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrd_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrex_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrex_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrexb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrexb_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrexd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrexd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrexh_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrexh_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrh_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrh_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrh_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrh_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrh_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrh_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrht_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrht_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrht_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsb_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsb_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsb_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsb_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsb_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsbt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsbt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsbt_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsh_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsh_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsh_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsh_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsh_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsht_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsht_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsht_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrt_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsl_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsl_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsl_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsl_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsl_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsl_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsr_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsr_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsr_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_lsr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mcr_mcr2_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mcr_mcr2_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mcr_mcr2_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mcr_mcr2_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mcrr_mcrr2_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mcrr_mcrr2_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mcrr_mcrr2_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mcrr_mcrr2_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mla_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mla_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mls_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mls_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mov_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mov_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mov_immediate_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mov_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mov_immediate_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mov_register_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mov_register_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mov_register_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mov_register_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_movt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_movt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrc_mrc2_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrc_mrc2_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrc_mrc2_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrc_mrc2_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrrc_mrrc2_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrrc_mrrc2_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrrc_mrrc2_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrrc_mrrc2_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrs_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrs_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_msr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_msr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_msr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mul_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mul_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mul_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mvn_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mvn_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mvn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mvn_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mvn_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mvn_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_nop_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_nop_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_nop_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_orn_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_orn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_orr_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_orr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_orr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_orr_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_orr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_orr_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pld_pldw_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pld_pldw_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pld_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pld_pldw_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pli_immediate_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pli_immediate_literal_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pli_immediate_literal_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pop_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pop_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pop_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pop_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pop_arm_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_push_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_push_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_push_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_push_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_push_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qadd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qadd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qasx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qasx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qdadd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qdadd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qdsub_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qdsub_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qsax_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qsax_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qsub_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qsub_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qsub16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qsub16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qsub8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_qsub8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rbit_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rbit_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rev_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rev_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rev_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rev16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rev16_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rev16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_revsh_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_revsh_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_revsh_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ror_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ror_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ror_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ror_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ror_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rrx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rrx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rsb_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rsb_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rsb_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rsb_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rsb_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rsb_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rsc_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rsc_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_rsc_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sasx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sasx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sbc_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sbc_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sbc_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sbc_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sbc_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sbc_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sbfx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sbfx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sdiv_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sdiv_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sel_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sel_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_setend_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_setend_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sev_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sev_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sev_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shasx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shasx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shsax_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shsax_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shsub16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shsub16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shsub8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_shsub8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlabb_smlabt_smlatb_smlatt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlabb_smlabt_smlatb_smlatt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlad_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlad_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlalbb_smlalbt_smlaltb_smlaltt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlalbb_smlalbt_smlaltb_smlaltt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlald_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlald_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlawb_smlawt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlawb_smlawt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlsd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlsd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlsld_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smlsld_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smmla_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smmla_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smmls_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smmls_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smmul_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smmul_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smuad_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smuad_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smulbb_smulbt_smultb_smultt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smulbb_smulbt_smultb_smultt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smull_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smull_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smulwb_smulwt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smulwb_smulwt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smusd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smusd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssat_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssat_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssat16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssat16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssax_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssax_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssub16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssub16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssub8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ssub8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stm_stmia_stmea_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stm_stmia_stmea_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stm_stmia_stmea_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stmda_stmed_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stmdb_stmfd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stmdb_stmfd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stmib_stmfa_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_str_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_str_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_str_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_str_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_str_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strb_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strb_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strb_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strb_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strbt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strbt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strbt_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strex_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strex_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strexb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strexb_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strexd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strexd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strexh_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strexh_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strh_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strh_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strh_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strh_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strht_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strht_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strht_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strt_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_immediate_thumb_t4_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_sp_minus_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_sp_minus_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_sp_minus_immediate_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_sp_minus_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_sp_minus_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sub_sp_minus_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_svc_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_svc_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_swp_swpb_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtab_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtab_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtab16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtab16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtah_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtah_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtb_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtb16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxtb16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxth_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxth_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_sxth_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_tbb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_tbh_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_teq_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_teq_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_teq_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_teq_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_teq_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_tst_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_tst_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_tst_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_tst_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_tst_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_tst_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uasx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uasx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ubfx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ubfx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_udf_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_udf_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_udf_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_udiv_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_udiv_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhasx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhasx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhsax_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhsax_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhsub16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhsub16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhsub8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uhsub8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_umaal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_umaal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_umlal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_umlal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_umull_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_umull_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqasx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqasx_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqsax_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqsax_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqsub16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqsub16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqsub8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uqsub8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usad8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usad8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usada8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usada8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usat_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usat_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usat16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usat16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usax_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usax_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usub16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usub16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usub8_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_usub8_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtab_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtab_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtab16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtab16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtah_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtah_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtb_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtb16_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxtb16_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxth_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxth_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_uxth_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_wfe_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_wfe_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_wfe_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_wfi_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_wfi_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_wfi_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_yield_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_yield_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_yield_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_eret_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_eret_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_hvc_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_hvc_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldm_exception_return_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldm_user_registers_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrs_banked_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_mrs_banked_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smc_previously_smi_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_smc_previously_smi_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_srs_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_srs_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_srs_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stm_user_registers_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_subs_pc_lr_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabd_vabdl_integer_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabd_vabdl_integer_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vaddhn_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vaddhn_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldm_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldm_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldm_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldr_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldr_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldr_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldr_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_arm_core_register_to_scalar_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_arm_core_register_to_scalar_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_scalar_to_arm_core_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_scalar_to_arm_core_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmovl_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmovl_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmovn_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmovn_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmrs_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmrs_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmsr_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmsr_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_vmull_integer_and_polynomial_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_vmull_integer_and_polynomial_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_vmull_by_scalar_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_vmull_by_scalar_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpadd_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpadd_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpadd_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpadd_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpmax_vpmin_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpmax_vpmin_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpmax_vpmin_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpmax_vpmin_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpop_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpop_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpop_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpop_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpush_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpush_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpush_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpush_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmlal_vqdmlsl_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmlal_vqdmlsl_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmlal_vqdmlsl_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmlal_vqdmlsl_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmull_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmull_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmull_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmull_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqmovn_vqmovun_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqmovn_vqmovun_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqrshrn_vqrshrun_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqrshrn_vqrshrun_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqshrn_vqshrun_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqshrn_vqshrun_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vraddhn_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vraddhn_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrshrn_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrshrn_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrsubhn_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrsubhn_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshll_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshll_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshll_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshll_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshrn_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshrn_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vstm_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vstm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vstm_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vstm_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vstr_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vstr_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vstr_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vstr_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsubhn_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsubhn_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vtbl_vtbx_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vtbl_vtbx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText B_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText IA_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText N_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText R_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText S_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText U_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText W_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText X_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText align_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText amode_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText banked_reg(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText c_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText coproc_reg_str(unsigned coproc);
+Disassembler::ARMText coproc_str(unsigned coproc);
+Disassembler::ARMText double_reg_str(unsigned coproc);
+Disassembler::ARMText dt_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText effect_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText endian_specifier_str(unsigned endian);
+Disassembler::ARMText iflags_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText list_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText mode_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText op_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText option_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText quad_reg_str(unsigned coproc);
+Disassembler::ARMText registers_str(unsigned registers);
+Disassembler::ARMText regular_reg_str(unsigned reg);
+Disassembler::ARMText rotation_str(unsigned rotation);
+Disassembler::ARMText shift_str(unsigned shift_t, unsigned shift_n);
+Disassembler::ARMText shift_type_str(unsigned shift);
+Disassembler::ARMText simple_reg_str(unsigned coproc);
+Disassembler::ARMText size_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText spec_reg_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText type_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText x_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText y_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adc_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adc_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adc_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adc_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adc_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adc_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_immediate_thumb_t4_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_register_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_register_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_register_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_register_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_sp_plus_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_sp_plus_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_sp_plus_immediate_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_sp_plus_immediate_t4_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_sp_plus_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_sp_plus_register_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_sp_plus_register_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_sp_plus_register_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_add_sp_plus_register_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adr_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adr_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adr_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adr_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_adr_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_and_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_and_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_and_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_and_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_and_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_and_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_asr_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_asr_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_asr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_asr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_asr_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_asr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_b_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_b_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_b_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_b_t4_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bfc_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bfc_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bfi_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bfi_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bic_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bic_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bic_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bic_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bic_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bic_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bkpt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bkpt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bl_blx_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bl_blx_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bl_blx_immediate_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bl_blx_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_b_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_blx_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_blx_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bxj_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_bxj_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cbnz_cbz_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cdp_cdp2_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cdp_cdp2_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cdp_cdp2_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cdp_cdp2_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_clrex_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_clrex_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_clz_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_clz_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmn_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmn_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmn_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmn_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmn_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmp_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmp_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmp_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmp_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmp_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmp_register_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmp_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cmp_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_dbg_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_dbg_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_dmb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_dmb_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_dsb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_dsb_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_eor_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_eor_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_eor_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_eor_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_eor_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_eor_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_isb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_isb_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rfe_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rfe_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rfe_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldm_ldmia_ldmfd_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldm_ldmia_ldmfd_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldmda_ldmfa_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldmdb_ldmea_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldmdb_ldmea_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldmib_ldmed_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pld_pldw_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pld_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pld_pldw_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pli_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pli_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pli_immediate_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_literal_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_register_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_register_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrb_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrb_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrb_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrb_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrb_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrb_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrbt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrbt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrbt_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrd_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrd_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrex_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrex_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrexb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrexb_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrexd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrexd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrexh_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrexh_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrh_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrh_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrh_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrh_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrh_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrh_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrht_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrht_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrht_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsb_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsb_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsb_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsb_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsb_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsbt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsbt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsbt_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsh_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsh_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsh_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsh_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsh_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsht_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsht_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsht_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrt_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsl_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsl_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsl_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsl_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsl_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsl_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsr_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsr_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsr_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_lsr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mcr_mcr2_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mcr_mcr2_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mcr_mcr2_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mcr_mcr2_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mcrr_mcrr2_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mcrr_mcrr2_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mcrr_mcrr2_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mcrr_mcrr2_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mla_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mla_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mls_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mls_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mov_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mov_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mov_immediate_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mov_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mov_immediate_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mov_register_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mov_register_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mov_register_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mov_register_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_movt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_movt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrc_mrc2_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrc_mrc2_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrc_mrc2_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrc_mrc2_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrrc_mrrc2_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrrc_mrrc2_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrrc_mrrc2_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrrc_mrrc2_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrs_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrs_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_msr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_msr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_msr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mul_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mul_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mul_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mvn_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mvn_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mvn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mvn_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mvn_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mvn_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_nop_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_nop_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_nop_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_orn_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_orn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_orr_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_orr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_orr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_orr_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_orr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_orr_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pld_pldw_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pld_pldw_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pld_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pld_pldw_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pli_immediate_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pli_immediate_literal_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pli_immediate_literal_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pop_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pop_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pop_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pop_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pop_arm_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_push_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_push_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_push_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_push_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_push_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qadd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qadd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qasx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qasx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qdadd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qdadd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qdsub_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qdsub_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qsax_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qsax_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qsub_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qsub_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qsub16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qsub16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qsub8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_qsub8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rbit_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rbit_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rev_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rev_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rev_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rev16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rev16_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rev16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_revsh_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_revsh_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_revsh_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ror_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ror_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ror_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ror_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ror_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rrx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rrx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rsb_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rsb_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rsb_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rsb_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rsb_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rsb_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rsc_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rsc_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_rsc_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sasx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sasx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sbc_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sbc_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sbc_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sbc_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sbc_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sbc_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sbfx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sbfx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sdiv_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sdiv_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sel_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sel_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_setend_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_setend_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sev_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sev_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sev_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shasx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shasx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shsax_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shsax_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shsub16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shsub16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shsub8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_shsub8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlabb_smlabt_smlatb_smlatt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlabb_smlabt_smlatb_smlatt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlad_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlad_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlalbb_smlalbt_smlaltb_smlaltt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlalbb_smlalbt_smlaltb_smlaltt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlald_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlald_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlawb_smlawt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlawb_smlawt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlsd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlsd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlsld_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smlsld_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smmla_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smmla_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smmls_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smmls_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smmul_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smmul_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smuad_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smuad_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smulbb_smulbt_smultb_smultt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smulbb_smulbt_smultb_smultt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smull_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smull_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smulwb_smulwt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smulwb_smulwt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smusd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smusd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssat_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssat_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssat16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssat16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssax_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssax_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssub16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssub16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssub8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ssub8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stm_stmia_stmea_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stm_stmia_stmea_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stm_stmia_stmea_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stmda_stmed_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stmdb_stmfd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stmdb_stmfd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stmib_stmfa_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_str_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_str_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_str_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_str_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_str_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strb_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strb_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strb_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strb_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strbt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strbt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strbt_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strex_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strex_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strexb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strexb_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strexd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strexd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strexh_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strexh_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strh_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strh_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strh_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strh_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strht_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strht_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strht_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strt_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_immediate_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_immediate_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_immediate_thumb_t4_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_sp_minus_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_sp_minus_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_sp_minus_immediate_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_sp_minus_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_sp_minus_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sub_sp_minus_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_svc_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_svc_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_swp_swpb_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtab_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtab_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtab16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtab16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtah_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtah_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtb_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtb16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxtb16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxth_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxth_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_sxth_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_tbb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_tbh_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_teq_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_teq_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_teq_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_teq_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_teq_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_tst_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_tst_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_tst_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_tst_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_tst_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_tst_register_shifted_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uasx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uasx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ubfx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ubfx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_udf_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_udf_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_udf_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_udiv_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_udiv_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhasx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhasx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhsax_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhsax_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhsub16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhsub16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhsub8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uhsub8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_umaal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_umaal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_umlal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_umlal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_umull_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_umull_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqadd16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqadd16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqadd8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqadd8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqasx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqasx_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqsax_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqsax_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqsub16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqsub16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqsub8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uqsub8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usad8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usad8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usada8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usada8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usat_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usat_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usat16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usat16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usax_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usax_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usub16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usub16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usub8_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_usub8_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtab_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtab_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtab16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtab16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtah_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtah_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtb_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtb16_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxtb16_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxth_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxth_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_uxth_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_wfe_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_wfe_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_wfe_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_wfi_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_wfi_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_wfi_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_yield_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_yield_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_yield_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_eret_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_eret_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_hvc_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_hvc_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldm_exception_return_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldm_user_registers_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrs_banked_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_mrs_banked_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smc_previously_smi_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_smc_previously_smi_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_srs_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_srs_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_srs_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stm_user_registers_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_subs_pc_lr_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabd_vabdl_integer_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabd_vabdl_integer_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vaddhn_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vaddhn_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldm_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldm_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldm_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldr_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldr_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldr_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldr_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_arm_core_register_to_scalar_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_arm_core_register_to_scalar_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_scalar_to_arm_core_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_scalar_to_arm_core_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmovl_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmovl_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmovn_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmovn_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmrs_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmrs_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmsr_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmsr_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_vmull_integer_and_polynomial_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_vmull_integer_and_polynomial_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_vmull_by_scalar_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_vmull_by_scalar_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpadd_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpadd_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpadd_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpadd_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpmax_vpmin_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpmax_vpmin_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpmax_vpmin_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpmax_vpmin_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpop_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpop_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpop_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpop_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpush_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpush_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpush_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpush_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmlal_vqdmlsl_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmlal_vqdmlsl_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmlal_vqdmlsl_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmlal_vqdmlsl_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmull_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmull_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmull_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmull_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqmovn_vqmovun_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqmovn_vqmovun_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqrshrn_vqrshrun_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqrshrn_vqrshrun_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqshrn_vqshrun_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqshrn_vqshrun_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vraddhn_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vraddhn_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrshrn_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrshrn_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrsubhn_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrsubhn_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshll_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshll_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshll_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshll_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshrn_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshrn_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vstm_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vstm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vstm_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vstm_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vstr_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vstr_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vstr_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vstr_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsubhn_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsubhn_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vtbl_vtbx_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vtbl_vtbx_a1_to_string(const Disassembler::ARMInstruction *ins);
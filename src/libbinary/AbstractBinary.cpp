@@ -211,6 +211,19 @@ const std::string &AbstractBinary::getUniqueId() const {
     return m_unique_id;
 }
 
+const std::string &AbstractBinary::getFilePath() const {
+    return m_file_path;
+}
+
+uint64_t AbstractBinary::getFileOffset() const {
+    return m_file_offset;
+}
+
+void AbstractBinary::setFileLocation(const std::string &path, uint64_t offset) {
+    m_file_path = path;
+    m_file_offset = offset;
+}
+
 AbstractBinary *AbstractBinary::create(std::string path) {
     if (path.empty()) {
         LOG_ERR("Invalid path");
@@ -268,6 +281,8 @@ bool AbstractBinary::load(const std::string &path) {
     }
 
     m_path = path;
+    m_file_path = path;
+    m_file_offset = 0;
     m_size = file_stats.st_size;
     m_memory = static_cast<unsigned char *>(mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_FILE | MAP_PRIVATE, fd, 0));
     if (m_memory == MAP_FAILED) {
@@ -293,6 +308,8 @@ bool AbstractBinary::load(unsigned char *memory, size_t size) {
     m_size = size;
     m_unmap = false;
     m_path = "(loaded from memory)";
+    m_file_path.clear();
+    m_file_offset = 0;
     m_memory = memory;
 
     m_data = MemoryMap(m_memory, m_size);
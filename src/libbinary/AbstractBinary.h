@@ -121,6 +121,14 @@ public:
     const std::string &getVersion() const;
     const std::string &getUniqueId() const;
 
+    // File the binary was loaded from and where its first byte is in it. The path is empty if
+    // the binary does not come from a file.
+    const std::string &getFilePath() const;
+    uint64_t getFileOffset() const;
+
+    // Used for binaries loaded from memory that is a part of a file, like the slices of a fat binary.
+    void setFileLocation(const std::string &path, uint64_t offset);
+
 protected:
     unsigned pointer_size() const;
 
@@ -150,6 +158,10 @@ protected:
     MemoryMap m_data;
     std::string m_path;
 
+    // Location of the binary in its file, see getFilePath().
+    std::string m_file_path;
+    uint64_t m_file_offset = 0;
+
     // If 'm_unmap' is true then we need to clean the resources used.
     bool m_unmap = false;
     unsigned char *m_memory = nullptr;
@@ -75,6 +75,10 @@ bool FatBinary::init() {
 			continue;
 		}
 
+		if (!m_file_path.empty()) {
+			macho_binary->setFileLocation(m_file_path, m_file_offset + m_archs[i].offset);
+		}
+
 		if (!macho_binary->init()) {
 			LOG_ERR("Could not initialize mach-o binary %u", i);
 			continue;
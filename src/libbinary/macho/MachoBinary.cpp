@@ -8,6 +8,7 @@
 #include <cassert>
 #include <cstring>
 #include <iomanip>
+#include <limits>
 #include <queue>
 #include <sstream>
 #include <string>
@@ -733,6 +734,7 @@ bool MachoBinary::parse_function_starts(struct load_command *lc) {
                 more = false;
 
                 addEntryPoint(function_offset);
+                m_function_starts.push_back(function_offset);
             }
         } while (more);
     }
@@ -213,6 +213,9 @@ public:
     // The address of the first __TEXT segment.
     uint64_t m_base_address = 0;
 
+    // Offsets from the base address of the functions listed in 'LC_FUNCTION_STARTS'.
+    std::vector<uint64_t> m_function_starts;
+
     // Architecture specific information collected while parsing.
     std::vector<segment_command> m_segments_32;
     std::vector<segment_command_64> m_segments_64;
@@ -232,6 +235,17 @@ public:
 
     bool init() override;
 
+    // Addresses of the functions listed in 'LC_FUNCTION_STARTS', in ascending order. ld64 sets the
+    // low bit on the starts of Thumb functions, it is kept so callers can tell them apart.
+    std::vector<uint64_t> getFunctionStarts() const {
+        std::vector<uint64_t> starts;
+        starts.reserve(m_function_starts.size());
+        for (auto offset : m_function_starts)
+            starts.push_back(m_base_address + offset);
+
+        return starts;
+    }
+
     static bool check(uint8_t *memory, size_t size) {
         if (!memory || size < sizeof(struct mach_header)) {
             return false;
@@ -40,7 +40,7 @@ void ITSession::ITAdvance() {
 	if (ITCounter == 0)
 		ITState = 0;
 	else {
-		unsigned short NewITState4_0 = get_bits(ITState, 4, 0) << 1;
+		unsigned short NewITState4_0 = (get_bits(ITState, 4, 0) << 1) & 0x1f;
 		// SetBits32(ITState, 4, 0, NewITState4_0);
 		ITState = (ITState & 0xffffffe0) | NewITState4_0;
 	}
@@ -61,6 +61,15 @@ uint32_t ITSession::GetCond() const{
 		return COND_AL;
 }
 
+uint32_t ITSession::GetITState() const {
+	return InITBlock() ? get_bits(ITState, 7, 0) : 0;
+}
+
+void ITSession::SetITState(uint32_t itstate) {
+	ITCounter = get_bits(itstate, 3, 0) ? CountITSize(get_bits(itstate, 3, 0)) : 0;
+	ITState = ITCounter ? get_bits(itstate, 7, 0) : 0;
+}
+
 std::string Register::name(Register::Core regno) {
     const static std::string names[] {
         "ARM_REG_R0",
@@ -845,6 +845,12 @@ class ITSession {
 		bool LastInITBlock() const;
 		uint32_t GetCond() const;
 
+		// ITSTATE bits of the CPSR at the current position, zero outside an IT block.
+		uint32_t GetITState() const;
+
+		// Resume the session at the position described by the ITSTATE bits of the CPSR.
+		void SetITState(uint32_t itstate);
+
 	private:
 		uint32_t ITCounter;
 		uint32_t ITState;
@@ -0,0 +1,78 @@
+/*
+ * ARMDecodeCache.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#include "arm/ARMDecodeCache.h"
+#include "arm/gen/ARMDecodingTable.h"
+
+namespace Disassembler {
+    // Pack the parts of the decoding context that can change the decoded instruction.
+    static inline uint8_t ContextState(const ARMDecoderContext &ctx) {
+        return (ctx.mode == ARMMode_Thumb)
+            | (ctx.it_session.InITBlock() << 1)
+            | (ctx.it_session.LastInITBlock() << 2)
+            | (ctx.hyp_mode << 3);
+    }
+
+    ARMDecodeCache::ARMDecodeCache(size_t n_entries) {
+        unsigned bits = 1;
+        while ((1ULL << bits) < n_entries && bits < 31) {
+            bits++;
+        }
+
+        m_entries.resize(1ULL << bits);
+        m_shift = 32 - bits;
+    }
+
+    const ARMDecodeCache::Entry &ARMDecodeCache::decode(const ARMDisassembler &disassembler,
+            const ARMDecoderContext &ctx, uint32_t opcode) {
+        uint8_t state = ContextState(ctx);
+        ARMVariants variant = disassembler.getDecoder()->getVariant();
+
+        // Fibonacci hashing spreads the encodings that only differ in their low bits.
+        uint32_t index = ((opcode ^ (static_cast<uint32_t>(state) << 24)) * 0x9e3779b1u) >> m_shift;
+        Entry &entry = m_entries[index];
+
+        if (entry.m_valid && entry.m_opcode == opcode && entry.m_state == state && entry.m_variant == variant) {
+            m_hits++;
+            return entry;
+        }
+
+        m_misses++;
+        entry.ins = disassembler.disassemble(ctx, opcode);
+        entry.m_opcode = opcode;
+        entry.m_variant = variant;
+        entry.m_state = state;
+        entry.m_valid = true;
+        entry.m_formatted = false;
+        return entry;
+    }
+
+    const ARMText &ARMDecodeCache::text(const Entry &entry) {
+        if (entry.m_formatted) {
+            m_text_hits++;
+            return entry.m_text;
+        }
+
+        m_text_misses++;
+        char buffer[sizeof(entry.m_text)];
+        entry.ins.format(buffer, sizeof(buffer));
+        entry.m_text = buffer;
+        entry.m_formatted = true;
+        return entry.m_text;
+    }
+
+    void ARMDecodeCache::clear() {
+        for (auto &entry : m_entries) {
+            entry.m_valid = false;
+        }
+
+        m_hits = 0;
+        m_misses = 0;
+        m_text_hits = 0;
+        m_text_misses = 0;
+    }
+} /* namespace Disassembler */
@@ -0,0 +1,86 @@
+/*
+ * ARMDecodeCache.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_LIBDISASSEMBLY_ARM_ARMDECODECACHE_H_
+#define SRC_LIBDISASSEMBLY_ARM_ARMDECODECACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "arm/ARMArch.h"
+#include "arm/ARMDisassembler.h"
+
+namespace Disassembler {
+	// Direct mapped cache of decoded instructions. Real code repeats the same encodings over
+	// and over (prologues, epilogues, returns) so those skip the decoder and, when the text is
+	// requested, the formatting too. Entries are keyed by the opcode, the decoder variant and
+	// the bits of the decoding context the decoders look at (mode, IT block position and
+	// hypervisor mode), so a cached result is always the one the decoder would return. The
+	// text does not depend on the address so it is shared by every occurrence of the encoding.
+	//
+	// A cache is not thread safe, every thread needs its own.
+	class ARMDecodeCache {
+		public:
+			struct Entry {
+				ARMInstruction ins;
+
+			private:
+				friend class ARMDecodeCache;
+
+				uint32_t m_opcode = 0;
+				ARMVariants m_variant = ARMvAll;
+				uint8_t m_state = 0;
+				bool m_valid = false;
+				mutable bool m_formatted = false;
+				mutable ARMText m_text;
+			};
+
+			// The number of entries is rounded up to a power of two.
+			explicit ARMDecodeCache(size_t n_entries = 4096);
+
+			// Decode 'opcode' with 'disassembler' unless it is already cached. The returned entry
+			// stays valid until the next call to decode() or clear().
+			const Entry &decode(const ARMDisassembler &disassembler, const ARMDecoderContext &ctx, uint32_t opcode);
+
+			// Text of the instruction in 'entry', formatted the first time it is requested. It
+			// stays valid as long as the entry does.
+			const ARMText &text(const Entry &entry);
+
+			void clear();
+
+			size_t size() const {
+				return m_entries.size();
+			}
+
+			size_t hits() const {
+				return m_hits;
+			}
+
+			size_t misses() const {
+				return m_misses;
+			}
+
+			size_t textHits() const {
+				return m_text_hits;
+			}
+
+			size_t textMisses() const {
+				return m_text_misses;
+			}
+
+		private:
+			std::vector<Entry> m_entries;
+			unsigned m_shift;
+			size_t m_hits = 0;
+			size_t m_misses = 0;
+			size_t m_text_hits = 0;
+			size_t m_text_misses = 0;
+	};
+} /* namespace Disassembler */
+
+#endif /* SRC_LIBDISASSEMBLY_ARM_ARMDECODECACHE_H_ */
@@ -6,6 +6,7 @@
  */
 
 #include "arm/ARMDisassembler.h"
+#include "arm/ARMDecodeCache.h"
 #include "arm/ARMUtilities.h"
 #include "arm/ARMArch.h"
 #include "arm/gen/ARMDecodingTable.h"
@@ -14,12 +15,153 @@
 using namespace Disassembler;
 
 namespace Disassembler {
+    std::string ARMInstruction::toString() const {
+        switch (m_status) {
+            case eStatusUnpredictable:
+                return std::string("UnpredictableInstruction: ") + m_reason;
+            case eStatusUndefined:
+                return std::string("UndefinedInstruction: ") + m_reason;
+            case eStatusSee:
+                return m_reason;
+            case eStatusUnknown:
+                return "UNKNOWN";
+            default:
+                break;
+        }
+
+        ARMToStringFunction to_string = m_decoder < n_arm_decoder_info ? arm_decoder_info[m_decoder].to_string : nullptr;
+        return to_string ? to_string(this).str() : "invalid";
+    }
+
+    size_t ARMInstruction::format(char *buffer, size_t size) const {
+        if (!size)
+            return 0;
+
+        int written;
+        switch (m_status) {
+            case eStatusUnpredictable:
+                written = snprintf(buffer, size, "UnpredictableInstruction: %s", m_reason);
+                break;
+            case eStatusUndefined:
+                written = snprintf(buffer, size, "UndefinedInstruction: %s", m_reason);
+                break;
+            case eStatusSee:
+                written = snprintf(buffer, size, "%s", m_reason);
+                break;
+            case eStatusUnknown:
+                written = snprintf(buffer, size, "UNKNOWN");
+                break;
+            default: {
+                // The text already has its length, it only needs to be copied.
+                ARMToStringFunction to_string = m_decoder < n_arm_decoder_info ? arm_decoder_info[m_decoder].to_string : nullptr;
+                ARMText text = to_string ? to_string(this) : ARMText("invalid");
+                size_t length = std::min(text.size(), size - 1);
+                memcpy(buffer, text.c_str(), length);
+                buffer[length] = '\0';
+                return length;
+            }
+        }
+
+        return written < 0 ? 0 : std::min(static_cast<size_t>(written), size - 1);
+    }
+
+    const char *ARMInstruction::decoderName() const {
+        return m_decoder < n_arm_decoder_info ? arm_decoder_info[m_decoder].name : nullptr;
+    }
+
     ARMDisassembler::ARMDisassembler(ARMVariants variant) :
-        m_variant(variant) {
-        m_decoder = new ARMDecoder(m_variant);
+        m_decoder(std::make_shared<const ARMDecoder>(variant)) {
+    }
+
+    ARMDisassembler::ARMDisassembler(std::shared_ptr<const ARMDecoder> decoder) :
+        m_decoder(std::move(decoder)) {
+    }
+
+    ARMInstruction ARMDisassembler::disassemble(uint32_t op_code, ARMMode mode) const {
+        return m_decoder->decode(ARMDecoderContext(mode), op_code);
+    }
+
+    ARMInstruction ARMDisassembler::disassemble(const ARMDecoderContext &ctx, uint32_t op_code) const {
+        return m_decoder->decode(ctx, op_code);
+    }
+
+    size_t ARMDisassembler::disassemble(const uint8_t *buffer, size_t size, uint32_t address, ARMMode mode,
+            ARMInstruction *instructions, size_t count, ARMDecodeCache *cache, ARMText *texts) const {
+        // Regions are assumed to start outside of an IT block.
+        return disassemble(buffer, size, address, ARMDecoderContext(mode), instructions, count, cache, texts);
     }
 
-    ARMInstruction ARMDisassembler::disassemble(uint32_t op_code, ARMMode mode) {
-        return m_decoder->decode(op_code, mode);
+    size_t ARMDisassembler::disassemble(const uint8_t *buffer, size_t size, uint32_t address,
+            const ARMDecoderContext &start, ARMInstruction *instructions, size_t count, ARMDecodeCache *cache,
+            ARMText *texts) const {
+        ARMDecoderContext ctx = start;
+        ARMMode mode = ctx.mode;
+
+        size_t offset = 0;
+        size_t n_decoded = 0;
+        while (n_decoded < count) {
+            uint32_t op_code;
+            size_t width;
+
+            if (mode == ARMMode_Thumb) {
+                if (offset + 2 > size)
+                    break;
+
+                uint16_t halfword = buffer[offset] | (buffer[offset + 1] << 8);
+                if (IsThumb32(halfword)) {
+                    if (offset + 4 > size)
+                        break;
+
+                    op_code = (halfword << 16) | buffer[offset + 2] | (buffer[offset + 3] << 8);
+                    width = 4;
+                } else {
+                    op_code = halfword;
+                    width = 2;
+                }
+            } else {
+                if (offset + 4 > size)
+                    break;
+
+                op_code = buffer[offset] | (buffer[offset + 1] << 8) | (buffer[offset + 2] << 16) | (buffer[offset + 3] << 24);
+                width = 4;
+            }
+
+            ARMInstruction &ins = instructions[n_decoded];
+            if (cache) {
+                const ARMDecodeCache::Entry &entry = cache->decode(*this, ctx, op_code);
+                ins = entry.ins;
+                if (texts)
+                    texts[n_decoded] = cache->text(entry);
+            } else {
+                ins = m_decoder->decode(ctx, op_code);
+                if (texts) {
+                    char text[sizeof(ARMText)];
+                    ins.format(text, sizeof(text));
+                    texts[n_decoded] = text;
+                }
+            }
+
+            ins.address = address + offset;
+            n_decoded++;
+
+            // Instructions that failed to decode still occupy their slot.
+            if (ins.m_status != eStatusValid) {
+                ins.opcode = op_code;
+                ins.ins_size = width == 4 ? eSize32 : eSize16;
+            }
+
+            // The instructions that follow an IT are decoded inside its block.
+            if (mode == ARMMode_Thumb) {
+                if (ins.m_status == eStatusValid && ins.id == it) {
+                    ctx.it_session.InitIT(Concatenate(ins.firstcond, ins.mask, 4));
+                } else if (ctx.it_session.InITBlock()) {
+                    ctx.it_session.ITAdvance();
+                }
+            }
+
+            offset += width;
+        }
+
+        return n_decoded;
     }
 } /* namespace Disassembler */
@@ -8,12 +8,15 @@
 #ifndef ARMDISASSEMBLER_H_
 #define ARMDISASSEMBLER_H_
 
-#include <functional>
+#include <type_traits>
 #include <iostream>
+#include <memory>
 #include <cassert>
+#include <cstdint>
 #include <string>
 
 #include "ARMArch.h"
+#include "FixedString.h"
 // #include "gen/ARMInstructionFields.h"
 
 class ARMDecoder;
@@ -232,40 +235,58 @@ namespace Disassembler {
 		return "INVALID";
 	}
 
-	typedef enum ARMInstrSize {
+	typedef enum ARMInstrSize : uint8_t {
 		eSize16 = 16, eSize32 = 32
 	} ARMInstrSize;
 
+	// Result of decoding an opcode.
+	typedef enum ARMInstrStatus : uint8_t {
+		eStatusValid,
+		eStatusUnpredictable,
+		eStatusUndefined,
+		eStatusSee,
+		eStatusUnknown
+	} ARMInstrStatus;
+
+	class ARMInstruction;
+
+	// Instruction text, formatted without touching the heap.
+	typedef FixedString<256> ARMText;
+	typedef ARMText (*ARMToStringFunction)(const ARMInstruction *);
+
+	// Decoded instruction. It is trivially copyable and only refers to static data so
+	// large code regions can be decoded into plain arrays without touching the heap.
 	class ARMInstruction {
 		public:
 			static ARMInstruction create() {
 				return ARMInstruction {};
 			}
 
-			virtual ~ARMInstruction() {
-			}
+			// The text and the decoder name are looked up from 'm_decoder' only when requested.
+			std::string toString() const;
+
+			// Write the text of the instruction to 'buffer' without allocating. The text is
+			// truncated to 'size' - 1 characters and always NUL terminated. Returns the length
+			// of the (possibly truncated) text.
+			size_t format(char *buffer, size_t size) const;
+			const char *decoderName() const;
 
 			// All the instructions share these fields.
-			std::function<std::string(ARMInstruction *)> m_to_string;
+			const char *m_reason;
+			uint32_t opcode;
+			uint32_t address;
+			uint16_t id;
+			uint16_t m_decoder;
 			ARMEncoding encoding;
-			unsigned opcode;
-			unsigned id;
 			ARMInstrSize ins_size;
-			std::string m_decoded_by;
+			ARMInstrStatus m_status;
 			bool m_skip;
 
-			// Big union with all the fields of the different instructions.
-			// ARMInstructionFields m_fields;
-
 			// Maybe this should be a union.
 			uint32_t imm12;
 			uint32_t imm32;
 			uint64_t imm64;
 
-			virtual std::string toString() {
-				return m_to_string ? m_to_string(this) : "invalid";
-			}
-
 			bool UnalignedAllowed;
 			bool add;
 			bool advsimd;
@@ -342,119 +363,148 @@ namespace Disassembler {
 			uint8_t saturate_to;
 			uint8_t shift_amount;
 
-			unsigned B;
-			unsigned CRd;
-			unsigned CRm;
-			unsigned CRn;
-			unsigned D;
-			unsigned E;
-			unsigned I1;
-			unsigned I2;
-			unsigned P;
-			unsigned Q;
-			unsigned SYSm;
-			unsigned T;
-			unsigned U;
-			unsigned W;
-			unsigned a;
-			unsigned affectA;
-			unsigned affectF;
-			unsigned affectI;
-			unsigned changemode;
-			unsigned cmode;
-			unsigned coproc;
-			unsigned d2;
-			unsigned d3;
-			unsigned d4;
-			unsigned d;
-			unsigned dHi;
-			unsigned dLo;
-			unsigned disable;
-			unsigned enable;
-			unsigned firstcond;
-			unsigned increment;
-			unsigned m;
-			unsigned mask;
-			unsigned mode;
-			unsigned n;
-			unsigned op;
-			unsigned opc1;
-			unsigned opc2;
-			unsigned opcode_;
-			unsigned option;
-			unsigned read_spsr;
-			unsigned reg;
-			unsigned reverse_mask;
-			unsigned s;
-			unsigned shift_n;
-			unsigned shift_t;
-			unsigned size;
-			unsigned t2;
-			unsigned t;
-			unsigned targetInstrSet;
-			unsigned type;
-			unsigned widthminus1;
-			unsigned wordhigher;
-			unsigned write_spsr;
+			// Register numbers and small opcode fields.
+			uint8_t B;
+			uint8_t CRd;
+			uint8_t CRm;
+			uint8_t CRn;
+			uint8_t D;
+			uint8_t E;
+			uint8_t I1;
+			uint8_t I2;
+			uint8_t P;
+			uint8_t Q;
+			uint8_t SYSm;
+			uint8_t T;
+			uint8_t U;
+			uint8_t W;
+			uint8_t a;
+			uint8_t affectA;
+			uint8_t affectF;
+			uint8_t affectI;
+			uint8_t changemode;
+			uint8_t cmode;
+			uint8_t coproc;
+			uint8_t d2;
+			uint8_t d3;
+			uint8_t d4;
+			uint8_t d;
+			uint8_t dHi;
+			uint8_t dLo;
+			uint8_t disable;
+			uint8_t enable;
+			uint8_t firstcond;
+			uint8_t increment;
+			uint8_t m;
+			uint8_t mask;
+			uint8_t mode;
+			uint8_t n;
+			uint8_t op;
+			uint8_t opc1;
+			uint8_t opc2;
+			uint8_t opcode_;
+			uint8_t option;
+			uint8_t read_spsr;
+			uint8_t reg;
+			uint8_t reverse_mask;
+			uint8_t s;
+			uint8_t shift_n;
+			uint8_t shift_t;
+			uint8_t size;
+			uint8_t t2;
+			uint8_t t;
+			uint8_t targetInstrSet;
+			uint8_t type;
+			uint8_t widthminus1;
+			uint8_t wordhigher;
+			uint8_t write_spsr;
 	};
 
+	// The following helpers only set the status of the instruction, they do not add any
+	// state so returning them as an ARMInstruction does not lose information.
 	class UnpredictableInstruction: public ARMInstruction {
-		private:
-			std::string m_reason;
-
 		public:
-			UnpredictableInstruction(std::string reason) : m_reason(reason) {
-				m_skip = false;
-			}
-
-			std::string toString() override {
-				return "UnpredictableInstruction: " + m_reason;
+			UnpredictableInstruction(const char *reason) : ARMInstruction() {
+				m_status = eStatusUnpredictable;
+				m_reason = reason;
 			}
 	};
 
 	class UndefinedInstruction: public ARMInstruction {
-		private:
-			std::string m_reason;
-
 		public:
-			UndefinedInstruction(std::string reason) : m_reason(reason) {
-				m_skip = false;
-			}
-
-			std::string toString() override {
-				return "UndefinedInstruction: " + m_reason;
+			UndefinedInstruction(const char *reason) : ARMInstruction() {
+				m_status = eStatusUndefined;
+				m_reason = reason;
 			}
 	};
 
 	class SeeInstruction: public ARMInstruction {
 		public:
-			SeeInstruction(const char *message) : m_see_message(message) {
+			SeeInstruction(const char *message) : ARMInstruction() {
+				m_status = eStatusSee;
+				m_reason = message;
 				m_skip = true;
 			}
-
-			std::string toString() override {
-				return m_see_message;
-			}
-
-		private:
-			std::string m_see_message;
 	};
 
 	class UnknownInstruction: public ARMInstruction {
 		public:
-			std::string toString() override {
-				return "UNKNOWN";
+			UnknownInstruction() : ARMInstruction() {
+				m_status = eStatusUnknown;
 			}
 	};
 
+	static_assert(std::is_trivially_copyable<ARMInstruction>::value, "ARMInstruction must be trivially copyable");
+
+	// Returns true if 'halfword' is the first halfword of a 32 bit Thumb instruction.
+	static inline bool IsThumb32(uint16_t halfword) {
+		return (halfword & 0xe000) == 0xe000 && (halfword & 0x1800) != 0;
+	}
+
+	class ARMDecodeCache;
+
+	// Decoding state that changes from one instruction to the next. It is owned by the caller
+	// so a single decoder can be shared between threads.
+	struct ARMDecoderContext {
+		ARMDecoderContext(ARMMode mode = ARMMode_ARM) :
+				mode(mode), hyp_mode(false) {
+		}
+
+		ARMMode mode;
+		ITSession it_session;
+		bool hyp_mode;
+	};
+
 	class ARMDisassembler {
 		public:
 			ARMDisassembler(ARMVariants variant = ARMvAll);
-			ARMInstruction disassemble(uint32_t opcode, ARMMode mode = ARMMode_ARM);
+			ARMDisassembler(std::shared_ptr<const ARMDecoder> decoder);
+
+			ARMInstruction disassemble(uint32_t opcode, ARMMode mode = ARMMode_ARM) const;
+			ARMInstruction disassemble(const ARMDecoderContext &ctx, uint32_t opcode) const;
+
+			// Decode the code in 'buffer' (loaded at 'address') into at most 'count' instructions.
+			// Thumb instruction widths and IT blocks are handled here, decoding stops at the first
+			// incomplete instruction. Each instruction gets its address and size set so the caller
+			// can continue from the end of the last one. Returns the number of instructions decoded.
+			// Repeated encodings are served from 'cache' when one is given. When 'texts' is given
+			// the text of every instruction is written there too, from the cache when possible.
+			size_t disassemble(const uint8_t *buffer, size_t size, uint32_t address, ARMMode mode,
+					ARMInstruction *instructions, size_t count, ARMDecodeCache *cache = nullptr,
+					ARMText *texts = nullptr) const;
+
+			// Same, for regions that start in the decoding state 'start', like in the middle of
+			// an IT block.
+			size_t disassemble(const uint8_t *buffer, size_t size, uint32_t address, const ARMDecoderContext &start,
+					ARMInstruction *instructions, size_t count, ARMDecodeCache *cache = nullptr,
+					ARMText *texts = nullptr) const;
+
+			const std::shared_ptr<const ARMDecoder> &getDecoder() const {
+				return m_decoder;
+			}
 
 		private:
-			ARMVariants m_variant;
-			ARMDecoder *m_decoder;
+			std::shared_ptr<const ARMDecoder> m_decoder;
 	};
 } /* namespace Disassembler */
 
@@ -0,0 +1,236 @@
+/*
+ * ARMParallelDisassembler.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#include <algorithm>
+#include <cstdio>
+
+#include "arm/ARMParallelDisassembler.h"
+#include "macho/MachoBinary.h"
+#include "abstract/Segment.h"
+
+namespace Disassembler {
+    ARMParallelDisassembler::ARMParallelDisassembler(ARMVariants variant, unsigned n_threads, size_t cache_entries) :
+        m_pool(n_threads), m_disassembler(variant) {
+        if (cache_entries) {
+            for (unsigned i = 0; i < m_pool.size(); i++) {
+                m_caches.emplace_back(new ARMDecodeCache(cache_entries));
+            }
+        }
+    }
+
+    // Length of the Thumb code in 'data' up to the first instruction boundary at or past 'limit'
+    // that is not inside an IT block. Thumb instructions are two or four bytes long and their
+    // first halfword tells which, so the boundaries are found without decoding.
+    static size_t ThumbBoundary(const uint8_t *data, size_t size, size_t limit) {
+        size_t offset = 0;
+        unsigned it_remaining = 0;
+        while (offset + 2 <= size && (offset < limit || it_remaining)) {
+            uint16_t halfword = data[offset] | (data[offset + 1] << 8);
+            if (it_remaining) {
+                it_remaining--;
+            } else if ((halfword & 0xff00) == 0xbf00 && (halfword & 0xf)) {
+                it_remaining = 4 - __builtin_ctz(halfword & 0xf);
+            }
+
+            offset += (halfword >> 11) >= 0x1d ? 4 : 2;
+        }
+
+        return std::min(offset, size);
+    }
+
+    std::vector<ARMCodeChunk> ARMParallelDisassembler::split(const MachoBinary &binary, ARMMode mode, size_t max_chunk_size) {
+        std::vector<ARMCodeChunk> chunks;
+        std::vector<uint64_t> starts = binary.getFunctionStarts();
+        std::sort(starts.begin(), starts.end());
+
+        // The low bit of the starts only tells the modes apart if the linker set it somewhere.
+        bool thumb_bits = std::any_of(starts.begin(), starts.end(), [](uint64_t start) {
+            return start & 1;
+        });
+
+        for (const auto &segment : binary.getSegments()) {
+            if (!segment.isExecutable() || !segment.getData())
+                continue;
+
+            uint64_t segment_start = segment.getAddress();
+            uint64_t segment_end = segment_start + std::min<uint64_t>(segment.getSize(), segment.getInFileSize());
+
+            // Chunk boundaries: the segment limits plus every function start inside it, with the
+            // mode of the code that follows them.
+            std::vector<std::pair<uint64_t, ARMMode>> bounds { { segment_start, mode } };
+            for (auto it = std::lower_bound(starts.begin(), starts.end(), segment_start); it != starts.end(); ++it) {
+                uint64_t address = *it & ~1ULL;
+                if (address >= segment_end) {
+                    break;
+                }
+
+                ARMMode function_mode = !thumb_bits ? mode : (*it & 1) ? ARMMode_Thumb : ARMMode_ARM;
+                if (address == bounds.back().first) {
+                    bounds.back().second = function_mode;
+                } else {
+                    bounds.push_back({ address, function_mode });
+                }
+            }
+
+            bounds.push_back({ segment_end, mode });
+
+            for (size_t i = 0; i + 1 < bounds.size(); i++) {
+                uint64_t start = bounds[i].first;
+                uint64_t end = bounds[i + 1].first;
+                ARMMode chunk_mode = bounds[i].second;
+
+                while (end - start > max_chunk_size) {
+                    const uint8_t *data = segment.getData() + (start - segment_start);
+
+                    // Thumb chunks are cut at an instruction boundary, a 32 bit instruction could
+                    // straddle any other halfword.
+                    size_t size = chunk_mode == ARMMode_ARM ? max_chunk_size :
+                        ThumbBoundary(data, end - start, max_chunk_size);
+
+                    chunks.push_back({ data, size, static_cast<uint32_t>(start), chunk_mode });
+                    start += size;
+                }
+
+                if (end > start) {
+                    chunks.push_back({ segment.getData() + (start - segment_start), static_cast<size_t>(end - start),
+                        static_cast<uint32_t>(start), chunk_mode });
+                }
+            }
+        }
+
+        return chunks;
+    }
+
+    std::vector<ARMInstruction> ARMParallelDisassembler::disassemble(const std::vector<ARMCodeChunk> &chunks) {
+        std::vector<std::vector<ARMInstruction>> results(chunks.size());
+
+        m_pool.run(chunks.size(), [&](size_t task, unsigned worker) {
+            const ARMCodeChunk &chunk = chunks[task];
+            std::vector<ARMInstruction> &result = results[task];
+
+            // Every instruction takes at least two (Thumb) or four (ARM) bytes.
+            result.resize(chunk.size / (chunk.mode == ARMMode_Thumb ? 2 : 4));
+            size_t count = m_disassembler.disassemble(chunk.data, chunk.size, chunk.address, chunk.mode,
+                result.data(), result.size(), m_caches.empty() ? nullptr : m_caches[worker].get());
+
+            result.resize(count);
+        });
+
+        // Chunks do not overlap, so ordering them by address is enough to sort the output.
+        std::vector<size_t> order(chunks.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return chunks[a].address < chunks[b].address;
+        });
+
+        size_t total = 0;
+        for (const auto &result : results) {
+            total += result.size();
+        }
+
+        std::vector<ARMInstruction> instructions;
+        instructions.reserve(total);
+        for (auto i : order) {
+            instructions.insert(instructions.end(), results[i].begin(), results[i].end());
+        }
+
+        return instructions;
+    }
+
+    std::vector<ARMInstruction> ARMParallelDisassembler::disassemble(const MachoBinary &binary, ARMMode mode) {
+        return disassemble(split(binary, mode));
+    }
+
+    size_t ARMParallelDisassembler::list(const std::vector<ARMCodeChunk> &chunks, std::string &listing) {
+        std::vector<std::string> results(chunks.size());
+        std::vector<size_t> counts(chunks.size());
+
+        // Decoding buffers, reused by all the chunks a worker runs.
+        std::vector<std::vector<ARMInstruction>> instructions(m_pool.size());
+        std::vector<std::vector<ARMText>> texts(m_pool.size());
+
+        m_pool.run(chunks.size(), [&](size_t task, unsigned worker) {
+            const ARMCodeChunk &chunk = chunks[task];
+            size_t capacity = chunk.size / (chunk.mode == ARMMode_Thumb ? 2 : 4);
+            if (instructions[worker].size() < capacity) {
+                instructions[worker].resize(capacity);
+                texts[worker].resize(capacity);
+            }
+
+            size_t count = m_disassembler.disassemble(chunk.data, chunk.size, chunk.address, chunk.mode,
+                instructions[worker].data(), capacity, m_caches.empty() ? nullptr : m_caches[worker].get(),
+                texts[worker].data());
+
+            std::string &result = results[task];
+            char address[16];
+            for (size_t i = 0; i < count; i++) {
+                snprintf(address, sizeof(address), "0x%.8x: ", instructions[worker][i].address);
+                result.append(address);
+                result.append(texts[worker][i].c_str(), texts[worker][i].size());
+                result.push_back('\n');
+            }
+
+            counts[task] = count;
+        });
+
+        std::vector<size_t> order(chunks.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return chunks[a].address < chunks[b].address;
+        });
+
+        size_t total = 0;
+        for (auto i : order) {
+            listing += results[i];
+            total += counts[i];
+        }
+
+        return total;
+    }
+
+    size_t ARMParallelDisassembler::cacheHits() const {
+        size_t hits = 0;
+        for (const auto &cache : m_caches) {
+            hits += cache->hits();
+        }
+
+        return hits;
+    }
+
+    size_t ARMParallelDisassembler::cacheMisses() const {
+        size_t misses = 0;
+        for (const auto &cache : m_caches) {
+            misses += cache->misses();
+        }
+
+        return misses;
+    }
+
+    size_t ARMParallelDisassembler::cacheTextHits() const {
+        size_t hits = 0;
+        for (const auto &cache : m_caches) {
+            hits += cache->textHits();
+        }
+
+        return hits;
+    }
+
+    size_t ARMParallelDisassembler::cacheTextMisses() const {
+        size_t misses = 0;
+        for (const auto &cache : m_caches) {
+            misses += cache->textMisses();
+        }
+
+        return misses;
+    }
+} /* namespace Disassembler */
@@ -0,0 +1,70 @@
+/*
+ * ARMParallelDisassembler.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_LIBDISASSEMBLY_ARM_ARMPARALLELDISASSEMBLER_H_
+#define SRC_LIBDISASSEMBLY_ARM_ARMPARALLELDISASSEMBLER_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arm/ARMArch.h"
+#include "arm/ARMDisassembler.h"
+#include "arm/ARMDecodeCache.h"
+#include "ThreadPool.h"
+
+class MachoBinary;
+
+namespace Disassembler {
+	// Contiguous range of code that is decoded as a single unit of work.
+	struct ARMCodeChunk {
+		const uint8_t *data;
+		size_t size;
+		uint32_t address;
+		ARMMode mode;
+	};
+
+	// Disassembles whole binaries by splitting their code in chunks that are decoded in
+	// parallel. The decoder is stateless so all the worker threads share it. When
+	// 'cache_entries' is not zero every worker also keeps a decode cache of that size.
+	class ARMParallelDisassembler {
+		public:
+			ARMParallelDisassembler(ARMVariants variant = ARMvAll, unsigned n_threads = 0, size_t cache_entries = 0);
+
+			// Split the executable segments of 'binary' at the functions listed in its function
+			// starts. Every function is decoded in the mode given by the Thumb bit of its start,
+			// 'mode' is used for the code before the first one and when no start has the bit set.
+			// Chunks longer than 'max_chunk_size' are split further, Thumb ones at the first
+			// instruction boundary past that size.
+			static std::vector<ARMCodeChunk> split(const MachoBinary &binary, ARMMode mode, size_t max_chunk_size = 0x4000);
+
+			// Decode all the chunks. The result is sorted by address.
+			std::vector<ARMInstruction> disassemble(const std::vector<ARMCodeChunk> &chunks);
+
+			// Decode all the executable code of 'binary'.
+			std::vector<ARMInstruction> disassemble(const MachoBinary &binary, ARMMode mode);
+
+			// Decode all the chunks into 'listing', one "0x<address>: <text>" line per instruction
+			// sorted by address. The workers format the text, taking it from their decode cache
+			// when there is one. Returns the number of instructions.
+			size_t list(const std::vector<ARMCodeChunk> &chunks, std::string &listing);
+
+			// Decode cache statistics summed over all the workers.
+			size_t cacheHits() const;
+			size_t cacheMisses() const;
+			size_t cacheTextHits() const;
+			size_t cacheTextMisses() const;
+
+		private:
+			ThreadPool m_pool;
+			ARMDisassembler m_disassembler;
+			std::vector<std::unique_ptr<ARMDecodeCache>> m_caches;
+	};
+} /* namespace Disassembler */
+
+#endif /* SRC_LIBDISASSEMBLY_ARM_ARMPARALLELDISASSEMBLER_H_ */
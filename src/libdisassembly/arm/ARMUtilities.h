@@ -30,7 +30,7 @@ inline bool EncodingIsThumb(ARMEncoding e) {
 // Implementation of: (bits(N), bit) LSL_C(bits(N) x, integer shift)
 inline uint32_t LSL_C(uint32_t x, uint32_t shift, uint32_t &carry_out) {
 	carry_out = shift <= 32 ? get_bit(x, 32 - shift) : 0;
-	return x << shift;
+	return shift < 32 ? x << shift : 0;
 }
 
 // Implementation of: bits(N) LSL(bits(N) x, integer shift)
@@ -45,7 +45,7 @@ inline uint32_t LSL(uint32_t x, uint32_t shift) {
 // Implementation of: (bits(N), bit) LSR_C(bits(N) x, integer shift)
 inline uint32_t LSR_C(uint32_t value, uint32_t amount, uint32_t &carry_out) {
 	carry_out = amount <= 32 ? get_bit(value, amount - 1) : 0;
-	return value >> amount;
+	return amount < 32 ? value >> amount : 0;
 }
 
 // Implementation of: bits(N) LSR(bits(N) x, integer shift)
@@ -86,7 +86,7 @@ inline uint32_t ROR_C(uint32_t value, uint32_t amount, uint32_t &carry_out) {
 
 	uint32_t amt = amount % 32;
 	uint32_t result = Rotr32(value, amt);
-	carry_out = get_bit(value, 31);
+	carry_out = get_bit(result, 31);
 	return result;
 }
 
@@ -3,325 +3,325 @@
 
 #include "arm/ARMDisassembler.h"
 
-std::string decode_it_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldc_ldc2_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldc_ldc2_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldc_ldc2_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldc_ldc2_immediate_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldc_ldc2_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldc_ldc2_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldc_ldc2_literal_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldc_ldc2_literal_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldm_ldmia_ldmfd_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_immediate_thumb_t4_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldr_register_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrb_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrb_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrb_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrd_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrd_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrd_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrh_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrh_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrh_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsb_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsb_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsb_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsh_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsh_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_ldrsh_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pkh_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pkh_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_pli_immediate_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stc_stc2_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stc_stc2_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stc_stc2_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_stc_stc2_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_str_immediate_thumb_t4_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_str_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_str_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strb_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strb_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strb_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strd_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strd_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strd_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strh_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strh_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_strh_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vaba_vabal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vaba_vabal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vaba_vabal_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vaba_vabal_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabd_vabdl_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabd_vabdl_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabd_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabd_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabs_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabs_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabs_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vabs_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vacge_vacgt_vacle_vaclt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vacge_vacgt_vacle_vaclt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vadd_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vadd_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vadd_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vadd_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vadd_floating_point_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vadd_floating_point_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vaddl_vaddw_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vaddl_vaddw_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vand_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vand_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vbic_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vbic_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vbic_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vbic_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vbif_vbit_vbsl_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vbif_vbit_vbsl_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vceq_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vceq_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vceq_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vceq_register_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vceq_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vceq_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcge_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcge_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcge_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcge_register_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcge_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcge_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcgt_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcgt_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcgt_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcgt_register_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcgt_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcgt_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcle_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcle_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcls_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcls_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vclt_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vclt_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vclz_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vclz_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcmp_vcmpe_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcmp_vcmpe_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcmp_vcmpe_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcmp_vcmpe_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcnt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcnt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_floating_point_and_integer_advancedsimd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_floating_point_and_integer_advancedsimd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_vcvtr_between_floating_point_and_integer_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_vcvtr_between_floating_point_and_integer_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_floating_point_and_fixed_point_advancedsimd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_floating_point_and_fixed_point_advancedsimd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_floating_point_and_fixed_point_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_floating_point_and_fixed_point_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_double_precision_and_single_precision_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_double_precision_and_single_precision_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_half_precision_and_single_precision_advancedsimd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvt_between_half_precision_and_single_precision_advancedsimd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvtb_vcvtt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vcvtb_vcvtt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vdiv_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vdiv_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vdup_scalar_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vdup_scalar_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vdup_arm_core_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vdup_arm_core_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_veor_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_veor_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vext_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vext_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vfma_vfms_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vfma_vfms_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vfma_vfms_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vfma_vfms_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vfnma_vfnms_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vfnma_vfnms_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vhadd_vhsub_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vhadd_vhsub_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld1_multiple_single_elements_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld1_multiple_single_elements_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld1_single_element_to_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld1_single_element_to_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld1_single_element_to_all_lanes_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld1_single_element_to_all_lanes_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld2_multiple_2_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld2_multiple_2_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld2_single_2_element_structure_to_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld2_single_2_element_structure_to_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld2_single_2_element_structure_to_all_lanes_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld2_single_2_element_structure_to_all_lanes_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld3_multiple_3_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld3_multiple_3_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld3_single_3_element_structure_to_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld3_single_3_element_structure_to_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld3_single_3_element_structure_to_all_lanes_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld3_single_3_element_structure_to_all_lanes_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld4_multiple_4_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld4_multiple_4_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld4_single_4_element_structure_to_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld4_single_4_element_structure_to_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld4_single_4_element_structure_to_all_lanes_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vld4_single_4_element_structure_to_all_lanes_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldr_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldr_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldr_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vldr_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmax_vmin_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmax_vmin_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmax_vmin_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmax_vmin_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmlal_vmls_vmlsl_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmlal_vmls_vmlsl_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmlal_vmls_vmlsl_integer_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmlal_vmls_vmlsl_integer_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmls_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmls_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmls_floating_point_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmls_floating_point_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmlal_vmls_vmlsl_by_scalar_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmlal_vmls_vmlsl_by_scalar_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmlal_vmls_vmlsl_by_scalar_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmla_vmlal_vmls_vmlsl_by_scalar_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_immediate_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_register_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_register_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_between_arm_core_register_and_single_precision_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_between_arm_core_register_and_single_precision_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_between_two_arm_core_registers_and_two_single_precision_registers_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_between_two_arm_core_registers_and_two_single_precision_registers_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_between_two_arm_core_registers_and_a_doubleword_extension_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmov_between_two_arm_core_registers_and_a_doubleword_extension_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_vmull_integer_and_polynomial_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_vmull_integer_and_polynomial_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_floating_point_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_floating_point_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_vmull_by_scalar_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmul_vmull_by_scalar_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmvn_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmvn_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmvn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vmvn_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vneg_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vneg_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vneg_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vneg_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vnmla_vnmls_vnmul_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vnmla_vnmls_vnmul_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vnmla_vnmls_vnmul_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vnmla_vnmls_vnmul_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vorn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vorn_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vorr_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vorr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vorr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vorr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpadal_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpadal_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpaddl_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vpaddl_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqabs_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqabs_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqadd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqadd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmulh_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmulh_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmulh_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqdmulh_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqneg_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqneg_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqrdmulh_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqrdmulh_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqrdmulh_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqrdmulh_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqrshl_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqrshl_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqshl_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqshl_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqshl_vqshlu_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqshl_vqshlu_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqsub_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vqsub_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrecpe_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrecpe_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrecps_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrecps_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrev16_vrev32_vrev64_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrev16_vrev32_vrev64_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrhadd_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrhadd_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrshl_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrshl_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrshr_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrshr_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrsqrte_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrsqrte_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrsqrts_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrsqrts_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrsra_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vrsra_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshl_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshl_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshl_register_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshl_register_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshr_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vshr_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsli_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsli_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsqrt_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsqrt_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsra_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsra_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsri_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsri_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst1_multiple_single_elements_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst1_multiple_single_elements_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst1_single_element_from_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst1_single_element_from_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst2_multiple_2_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst2_multiple_2_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst2_single_2_element_structure_from_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst2_single_2_element_structure_from_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst3_multiple_3_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst3_multiple_3_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst3_single_3_element_structure_from_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst3_single_3_element_structure_from_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst4_multiple_4_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst4_multiple_4_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst4_single_4_element_structure_from_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vst4_single_4_element_structure_from_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsub_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsub_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsub_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsub_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsub_floating_point_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsub_floating_point_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsubl_vsubw_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vsubl_vsubw_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vswp_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vswp_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vtrn_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vtrn_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vtst_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vtst_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vuzp_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vuzp_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vzip_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_vzip_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_subs_pc_lr_and_related_instructions_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_subs_pc_lr_and_related_instructions_arm_a2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cps_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cps_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
-std::string decode_cps_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_it_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldc_ldc2_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldc_ldc2_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldc_ldc2_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldc_ldc2_immediate_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldc_ldc2_literal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldc_ldc2_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldc_ldc2_literal_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldc_ldc2_literal_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldm_ldmia_ldmfd_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_immediate_thumb_t4_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldr_register_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrb_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrb_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrb_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrd_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrd_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrd_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrh_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrh_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrh_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsb_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsb_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsb_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsh_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsh_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_ldrsh_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pkh_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pkh_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_pli_immediate_literal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stc_stc2_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stc_stc2_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stc_stc2_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_stc_stc2_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_str_immediate_thumb_t4_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_str_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_str_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strb_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strb_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strb_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strd_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strd_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strd_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strh_immediate_thumb_t3_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strh_immediate_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_strh_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vaba_vabal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vaba_vabal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vaba_vabal_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vaba_vabal_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabd_vabdl_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabd_vabdl_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabd_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabd_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabs_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabs_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabs_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vabs_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vacge_vacgt_vacle_vaclt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vacge_vacgt_vacle_vaclt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vadd_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vadd_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vadd_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vadd_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vadd_floating_point_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vadd_floating_point_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vaddl_vaddw_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vaddl_vaddw_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vand_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vand_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vbic_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vbic_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vbic_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vbic_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vbif_vbit_vbsl_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vbif_vbit_vbsl_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vceq_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vceq_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vceq_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vceq_register_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vceq_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vceq_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcge_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcge_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcge_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcge_register_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcge_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcge_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcgt_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcgt_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcgt_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcgt_register_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcgt_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcgt_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcle_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcle_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcls_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcls_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vclt_immediate_0_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vclt_immediate_0_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vclz_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vclz_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcmp_vcmpe_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcmp_vcmpe_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcmp_vcmpe_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcmp_vcmpe_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcnt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcnt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_floating_point_and_integer_advancedsimd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_floating_point_and_integer_advancedsimd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_vcvtr_between_floating_point_and_integer_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_vcvtr_between_floating_point_and_integer_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_floating_point_and_fixed_point_advancedsimd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_floating_point_and_fixed_point_advancedsimd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_floating_point_and_fixed_point_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_floating_point_and_fixed_point_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_double_precision_and_single_precision_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_double_precision_and_single_precision_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_half_precision_and_single_precision_advancedsimd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvt_between_half_precision_and_single_precision_advancedsimd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvtb_vcvtt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vcvtb_vcvtt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vdiv_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vdiv_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vdup_scalar_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vdup_scalar_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vdup_arm_core_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vdup_arm_core_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_veor_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_veor_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vext_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vext_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vfma_vfms_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vfma_vfms_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vfma_vfms_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vfma_vfms_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vfnma_vfnms_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vfnma_vfnms_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vhadd_vhsub_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vhadd_vhsub_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld1_multiple_single_elements_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld1_multiple_single_elements_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld1_single_element_to_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld1_single_element_to_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld1_single_element_to_all_lanes_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld1_single_element_to_all_lanes_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld2_multiple_2_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld2_multiple_2_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld2_single_2_element_structure_to_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld2_single_2_element_structure_to_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld2_single_2_element_structure_to_all_lanes_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld2_single_2_element_structure_to_all_lanes_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld3_multiple_3_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld3_multiple_3_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld3_single_3_element_structure_to_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld3_single_3_element_structure_to_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld3_single_3_element_structure_to_all_lanes_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld3_single_3_element_structure_to_all_lanes_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld4_multiple_4_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld4_multiple_4_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld4_single_4_element_structure_to_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld4_single_4_element_structure_to_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld4_single_4_element_structure_to_all_lanes_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vld4_single_4_element_structure_to_all_lanes_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldr_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldr_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldr_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vldr_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmax_vmin_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmax_vmin_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmax_vmin_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmax_vmin_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmlal_vmls_vmlsl_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmlal_vmls_vmlsl_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmlal_vmls_vmlsl_integer_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmlal_vmls_vmlsl_integer_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmls_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmls_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmls_floating_point_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmls_floating_point_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmlal_vmls_vmlsl_by_scalar_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmlal_vmls_vmlsl_by_scalar_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmlal_vmls_vmlsl_by_scalar_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmla_vmlal_vmls_vmlsl_by_scalar_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_immediate_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_immediate_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_register_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_register_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_between_arm_core_register_and_single_precision_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_between_arm_core_register_and_single_precision_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_between_two_arm_core_registers_and_two_single_precision_registers_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_between_two_arm_core_registers_and_two_single_precision_registers_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_between_two_arm_core_registers_and_a_doubleword_extension_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmov_between_two_arm_core_registers_and_a_doubleword_extension_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_vmull_integer_and_polynomial_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_vmull_integer_and_polynomial_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_floating_point_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_floating_point_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_vmull_by_scalar_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmul_vmull_by_scalar_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmvn_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmvn_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmvn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vmvn_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vneg_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vneg_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vneg_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vneg_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vnmla_vnmls_vnmul_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vnmla_vnmls_vnmul_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vnmla_vnmls_vnmul_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vnmla_vnmls_vnmul_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vorn_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vorn_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vorr_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vorr_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vorr_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vorr_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpadal_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpadal_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpaddl_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vpaddl_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqabs_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqabs_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqadd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqadd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmulh_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmulh_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmulh_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqdmulh_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqneg_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqneg_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqrdmulh_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqrdmulh_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqrdmulh_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqrdmulh_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqrshl_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqrshl_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqshl_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqshl_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqshl_vqshlu_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqshl_vqshlu_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqsub_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vqsub_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrecpe_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrecpe_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrecps_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrecps_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrev16_vrev32_vrev64_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrev16_vrev32_vrev64_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrhadd_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrhadd_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrshl_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrshl_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrshr_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrshr_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrsqrte_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrsqrte_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrsqrts_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrsqrts_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrsra_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vrsra_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshl_immediate_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshl_immediate_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshl_register_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshl_register_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshr_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vshr_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsli_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsli_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsqrt_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsqrt_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsra_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsra_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsri_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsri_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst1_multiple_single_elements_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst1_multiple_single_elements_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst1_single_element_from_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst1_single_element_from_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst2_multiple_2_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst2_multiple_2_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst2_single_2_element_structure_from_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst2_single_2_element_structure_from_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst3_multiple_3_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst3_multiple_3_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst3_single_3_element_structure_from_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst3_single_3_element_structure_from_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst4_multiple_4_element_structures_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst4_multiple_4_element_structures_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst4_single_4_element_structure_from_one_lane_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vst4_single_4_element_structure_from_one_lane_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsub_integer_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsub_integer_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsub_floating_point_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsub_floating_point_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsub_floating_point_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsub_floating_point_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsubl_vsubw_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vsubl_vsubw_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vswp_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vswp_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vtrn_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vtrn_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vtst_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vtst_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vuzp_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vuzp_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vzip_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_vzip_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_subs_pc_lr_and_related_instructions_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_subs_pc_lr_and_related_instructions_arm_a2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cps_thumb_t1_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cps_thumb_t2_to_string(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText decode_cps_arm_a1_to_string(const Disassembler::ARMInstruction *ins);
@@ -0,0 +1,221 @@
+/*
+ * ARMBlockCache.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#include "ARMBlockCache.h"
+#include "arm/ARMUtilities.h"
+#include "arm/gen/ARMDecodingTable.h"
+#include "debug.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace Disassembler;
+
+namespace Emulator {
+    // Returns true if the instruction may write the PC, the block cannot continue past it.
+    static bool EndsBlock(const ARMInstruction &ins) {
+        if (ins.m_status != eStatusValid) {
+            return true;
+        }
+
+        switch (ins.id) {
+            case ARMInstructionId::b:
+            case ARMInstructionId::bl_blx_immediate:
+            case ARMInstructionId::blx_register:
+            case ARMInstructionId::bx:
+            case ARMInstructionId::bxj:
+            case ARMInstructionId::cbnz_cbz:
+            case ARMInstructionId::tbb:
+            case ARMInstructionId::tbh:
+            case ARMInstructionId::bkpt:
+            case ARMInstructionId::svc:
+            case ARMInstructionId::hvc:
+            case ARMInstructionId::smc_previously_smi:
+            case ARMInstructionId::udf:
+            case ARMInstructionId::eret:
+            case ARMInstructionId::rfe:
+            case ARMInstructionId::subs_pc_lr_and_related_instructions_arm:
+            case ARMInstructionId::subs_pc_lr_thumb:
+                return true;
+
+            default:
+                break;
+        }
+
+        // Data processing and loads into the PC, including pop and ldm with the PC in the list.
+        return ins.d == 15 || ins.t == 15 || (ins.registers & 0x8000);
+    }
+
+    // Follow the IT blocks the same way the decoder does.
+    static void ITStep(ITSession &session, const ARMInstruction &ins) {
+        if (ins.m_status == eStatusValid && ins.id == ARMInstructionId::it) {
+            session.InitIT(Concatenate(ins.firstcond, ins.mask, 4));
+        } else if (session.InITBlock()) {
+            session.ITAdvance();
+        }
+    }
+
+    uint8_t ARMBasicBlock::itStateAt(size_t index) const {
+        ITSession session;
+        session.SetITState(itstate);
+        for (size_t i = 0; i < index && i < instructions.size(); i++) {
+            ITStep(session, instructions[i]);
+        }
+
+        return session.GetITState();
+    }
+
+    ARMBlockCache::ARMBlockCache(Memory::AbstractMemory &memory) :
+        m_memory(memory) {
+        m_subscription = m_memory.subscribe([this] (uintptr_t address, size_t size) {
+            invalidate(address, size);
+        });
+    }
+
+    ARMBlockCache::~ARMBlockCache() {
+        m_memory.unsubscribe(m_subscription);
+        clear();
+    }
+
+    ARMBasicBlock *ARMBlockCache::translate(const ARMDisassembler &dis, uint32_t address, ARMMode mode, uint8_t itstate) {
+        // Nothing is executing at this point so the dropped blocks can go.
+        m_retired.clear();
+
+        // Blocks do not cross pages unless the first instruction does.
+        uint8_t buffer[MAX_INSTRUCTIONS * 4];
+        uintptr_t page_end = (address & ~PAGE_MASK) + PAGE_SIZE;
+        size_t size = min<size_t>(sizeof(buffer), page_end - address);
+        if (m_memory.fetch(address, buffer, size) != size) {
+            return nullptr;
+        }
+
+        // A 32 bit Thumb instruction in the last halfword of the page continues on the next one.
+        if (size == 2 && mode == ARMMode_Thumb && IsThumb32(buffer[0] | (buffer[1] << 8))) {
+            if (m_memory.fetch(address + 2, buffer + 2, 2) != 2) {
+                return nullptr;
+            }
+
+            size = 4;
+        }
+
+        unique_ptr<ARMBasicBlock> block { new ARMBasicBlock };
+        block->address = address;
+        block->mode = mode;
+        block->itstate = mode == ARMMode_Thumb ? itstate : 0;
+        block->instructions.resize(MAX_INSTRUCTIONS);
+
+        // An IT block can be cut anywhere, the block that follows is decoded from the ITSTATE it
+        // is entered with.
+        ARMDecoderContext ctx(mode);
+        ctx.it_session.SetITState(block->itstate);
+        size_t count = dis.disassemble(buffer, size, address, ctx, block->instructions.data(), MAX_INSTRUCTIONS);
+
+        // Cut the block after the first control flow instruction.
+        bool has_it = block->itstate != 0;
+        for (size_t i = 0; i < count; i++) {
+            const ARMInstruction &ins = block->instructions[i];
+            has_it |= ins.m_status == eStatusValid && ins.id == ARMInstructionId::it;
+
+            if (EndsBlock(ins)) {
+                count = i + 1;
+                break;
+            }
+        }
+
+        block->has_it = mode == ARMMode_Thumb && has_it;
+
+        if (!count) {
+            return nullptr;
+        }
+
+        block->instructions.resize(count);
+        block->instructions.shrink_to_fit();
+
+        block->handlers.reserve(count);
+        for (const auto &ins : block->instructions) {
+            block->handlers.push_back(ARMInterpreter::getHandler(ins));
+        }
+
+        const ARMInstruction &last = block->instructions.back();
+        block->end = last.address + last.ins_size / 8;
+
+        uint64_t block_key = key(address, mode, block->itstate);
+        for (uintptr_t page = address / PAGE_SIZE; page <= (block->end - 1) / PAGE_SIZE; page++) {
+            auto &keys = m_pages[page];
+            if (keys.empty()) {
+                m_memory.markCode(page * PAGE_SIZE, PAGE_SIZE);
+            }
+
+            keys.push_back(block_key);
+        }
+
+        ARMBasicBlock *ret = block.get();
+        m_blocks[block_key] = move(block);
+        return ret;
+    }
+
+    void ARMBlockCache::invalidate(uintptr_t address, size_t size) {
+        if (m_pages.empty() || !size) {
+            return;
+        }
+
+        uintptr_t end = address + size;
+        for (uintptr_t page = address / PAGE_SIZE; page <= (end - 1) / PAGE_SIZE; page++) {
+            for (bool found = true; found;) {
+                found = false;
+
+                auto it = m_pages.find(page);
+                if (it == m_pages.end()) {
+                    break;
+                }
+
+                for (uint64_t block_key : it->second) {
+                    const ARMBasicBlock &block = *m_blocks[block_key];
+                    if (block.address < end && address < block.end) {
+                        remove(block_key);
+                        found = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    void ARMBlockCache::remove(uint64_t block_key) {
+        auto it = m_blocks.find(block_key);
+        const ARMBasicBlock &block = *it->second;
+
+        for (uintptr_t page = block.address / PAGE_SIZE; page <= (block.end - 1) / PAGE_SIZE; page++) {
+            auto &keys = m_pages[page];
+            keys.erase(std::remove(keys.begin(), keys.end(), block_key), keys.end());
+            if (keys.empty()) {
+                m_pages.erase(page);
+                m_memory.unmarkCode(page * PAGE_SIZE, PAGE_SIZE);
+            }
+        }
+
+        LOG_DEBUG("Dropping block 0x%.8x-0x%.8x", block.address, block.end);
+
+        m_retired.push_back(move(it->second));
+        m_blocks.erase(it);
+        m_generation++;
+    }
+
+    void ARMBlockCache::clear() {
+        for (auto &it : m_blocks) {
+            m_retired.push_back(move(it.second));
+        }
+
+        for (const auto &it : m_pages) {
+            m_memory.unmarkCode(it.first * PAGE_SIZE, PAGE_SIZE);
+        }
+
+        m_blocks.clear();
+        m_pages.clear();
+        m_generation++;
+    }
+}
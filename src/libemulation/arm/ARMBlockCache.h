@@ -0,0 +1,134 @@
+/*
+ * ARMBlockCache.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_LIBEMULATION_ARM_ARMBLOCKCACHE_H_
+#define SRC_LIBEMULATION_ARM_ARMBLOCKCACHE_H_
+
+#include "arm/ARMArch.h"
+#include "arm/ARMDisassembler.h"
+#include "arm/gen/ARMInterpreter.h"
+#include "memory/Memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Emulator {
+	struct ARMJITFrame;
+
+	// Entry point of a block compiled by ARMJIT. Runs at most 'limit' instructions, leaves the
+	// address of the next one in regs[15] and returns how many instructions ran.
+	typedef uint32_t (*ARMNativeCode)(uint32_t *regs, uint32_t *cpsr, ARMJITFrame *frame, uint32_t limit);
+
+	// Straight line run of decoded instructions. A block ends after the first instruction that
+	// may change the control flow, at the end of a page or after MAX_INSTRUCTIONS. The handler
+	// of every instruction is resolved when the block is decoded so executing the block goes
+	// straight from one handler to the next.
+	struct ARMBasicBlock {
+		uint32_t address;
+		uint32_t end;
+		ARMMode mode;
+		std::vector<Disassembler::ARMInstruction> instructions;
+		std::vector<ARMInterpreter::Handler> handlers;
+
+		// ITSTATE the block was decoded with and whether any of its instructions is in an IT
+		// block. A block entered in the middle of an IT block is a different block.
+		uint8_t itstate = 0;
+		bool has_it = false;
+
+		// ITSTATE before the instruction at 'index', or after the last one.
+		uint8_t itStateAt(size_t index) const;
+
+		// Native code for the first 'n_native' instructions, see ARMJIT. It is only valid while
+		// 'native_epoch' matches the epoch of the JIT code buffer.
+		unsigned executions = 0;
+		ARMNativeCode native = nullptr;
+		size_t n_native = 0;
+		size_t native_epoch = 0;
+	};
+
+	// Translation cache of decoded basic blocks keyed by (address, mode, ITSTATE). Code that
+	// runs more than once skips both the fetch and the decode. The pages blocks are decoded from
+	// are marked as code in the memory, and blocks are dropped as soon as a write overlaps the
+	// bytes they were decoded from.
+	class ARMBlockCache {
+	public:
+		static constexpr size_t MAX_INSTRUCTIONS = 64;
+
+		// The memory has to outlive the cache.
+		explicit ARMBlockCache(Memory::AbstractMemory &memory);
+		~ARMBlockCache();
+
+		ARMBlockCache(const ARMBlockCache &) = delete;
+		ARMBlockCache &operator=(const ARMBlockCache &) = delete;
+
+		// Return the cached block that starts at 'address' or nullptr.
+		ARMBasicBlock *lookup(uint32_t address, ARMMode mode, uint8_t itstate = 0) {
+			auto it = m_blocks.find(key(address, mode, itstate));
+			if (it == m_blocks.end()) {
+				m_misses++;
+				return nullptr;
+			}
+
+			m_hits++;
+			return it->second.get();
+		}
+
+		// Fetch and decode the block that starts at 'address', inside the IT block described by
+		// 'itstate' if it is not zero. Returns nullptr if the memory at 'address' cannot be read.
+		ARMBasicBlock *translate(const Disassembler::ARMDisassembler &dis, uint32_t address, ARMMode mode,
+			uint8_t itstate = 0);
+
+		// Drop every block decoded from bytes in [address, address + size).
+		void invalidate(uintptr_t address, size_t size);
+
+		void clear();
+
+		// Incremented every time a block is dropped, so a running block can tell it went stale.
+		size_t generation() const {
+			return m_generation;
+		}
+
+		size_t size() const {
+			return m_blocks.size();
+		}
+
+		size_t hits() const {
+			return m_hits;
+		}
+
+		size_t misses() const {
+			return m_misses;
+		}
+
+	private:
+		static uint64_t key(uint32_t address, ARMMode mode, uint8_t itstate) {
+			return (static_cast<uint64_t>(itstate) << 34) | (static_cast<uint64_t>(address) << 2) | mode;
+		}
+
+		void remove(uint64_t key);
+
+		Memory::AbstractMemory &m_memory;
+		size_t m_subscription;
+
+		std::unordered_map<uint64_t, std::unique_ptr<ARMBasicBlock>> m_blocks;
+
+		// Keys of the blocks decoded from each page, every page in it is marked as code.
+		std::unordered_map<uintptr_t, std::vector<uint64_t>> m_pages;
+
+		// Dropped blocks may still be executing, they are freed on the next translation.
+		std::vector<std::unique_ptr<ARMBasicBlock>> m_retired;
+
+		size_t m_generation = 0;
+		size_t m_hits = 0;
+		size_t m_misses = 0;
+	};
+}
+
+#endif /* SRC_LIBEMULATION_ARM_ARMBLOCKCACHE_H_ */
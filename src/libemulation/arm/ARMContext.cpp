@@ -10,6 +10,7 @@
 
 #include <tuple>
 #include <cassert>
+#include <cinttypes>
 
 template<typename T> const T& Max(const T& a, const T& b) {
     return (a < b) ? b : a;
@@ -222,15 +223,15 @@ void ARMContext::writeQuadRegister(unsigned regno, uint64_t value) {
     setRegister(static_cast<Register::Quad>(regno), value);
 }
 
-uint32_t ARMContext::read_MemA(uintptr_t address, unsigned size) const {
+uint64_t ARMContext::read_MemA(uintptr_t address, unsigned size) const {
     return read_MemA_with_priv(address, size, CurrentModeIsNotUser());
 }
 
-uint32_t ARMContext::read_MemA_unpriv(uintptr_t address, unsigned size) const {
+uint64_t ARMContext::read_MemA_unpriv(uintptr_t address, unsigned size) const {
     return read_MemA_with_priv(address, size, false);
 }
 
-uint32_t ARMContext::read_MemA_with_priv(uintptr_t address, unsigned size, bool privileged) const {
+uint64_t ARMContext::read_MemA_with_priv(uintptr_t address, unsigned size, bool privileged) const {
     if (address != Align(address, size)) {
         if (SCTLR.A && SCTLR.U) {
             AlignmentFault(address, false);
@@ -239,7 +240,7 @@ uint32_t ARMContext::read_MemA_with_priv(uintptr_t address, unsigned size, bool
         address = Align(address, size);
     }
 
-    uint32_t value = readMemory(address, size);
+    uint64_t value = readMemory(address, size);
     if (CPSR.E) {
         BigEndianReverse(value, size);
     }
@@ -247,29 +248,28 @@ uint32_t ARMContext::read_MemA_with_priv(uintptr_t address, unsigned size, bool
     return value;
 }
 
-uint32_t ARMContext::read_MemU(uintptr_t address, unsigned size) const {
+uint64_t ARMContext::read_MemU(uintptr_t address, unsigned size) const {
     return read_MemU_with_priv(address, size, CurrentModeIsNotUser());
 }
 
-uint32_t ARMContext::read_MemU_unpriv(uintptr_t address, unsigned size) const {
+uint64_t ARMContext::read_MemU_unpriv(uintptr_t address, unsigned size) const {
     return read_MemU_with_priv(address, size, false);
 }
 
-uint32_t ARMContext::read_MemU_with_priv(uintptr_t address, unsigned size, bool privileged) const {
+uint64_t ARMContext::read_MemU_with_priv(uintptr_t address, unsigned size, bool privileged) const {
     if (SCTLR.A == 0 && SCTLR.U == 0) {
         address = Align(address, size);
     }
 
-    uint32_t value;
+    uint64_t value = 0;
     if (address == Align(address, size)) {
         value = read_MemA_with_priv(address, size, privileged);
     } else if (SCTLR.A) {
         AlignmentFault(address, false);
     } else {
-        for (unsigned i = 0; i < size; i++) {
-            reinterpret_cast<uint8_t *>(&value)[i] = read_MemA_with_priv(address + i, 1, privileged);
-        }
-
+        // The bytes are assembled in little endian order, the memory does it with a single
+        // access unless the range crosses into another mapping.
+        value = readMemory(address, size);
         if (CPSR.E) {
             BigEndianReverse(value, size);
         }
@@ -278,18 +278,18 @@ uint32_t ARMContext::read_MemU_with_priv(uintptr_t address, unsigned size, bool
     return value;
 }
 
-void ARMContext::write_MemA(uint32_t value, uintptr_t address, unsigned size) {
-    write_MemA_with_priv(value, address, size, CurrentModeIsNotUser());
+void ARMContext::write_MemA(uintptr_t address, unsigned size, uint64_t value) {
+    write_MemA_with_priv(address, size, value, CurrentModeIsNotUser());
 }
 
-void ARMContext::write_MemA_unpriv(uint32_t value, uintptr_t address, unsigned size) {
-    write_MemA_with_priv(value, address, size, false);
+void ARMContext::write_MemA_unpriv(uintptr_t address, unsigned size, uint64_t value) {
+    write_MemA_with_priv(address, size, value, false);
 }
 
-void ARMContext::write_MemA_with_priv(uint32_t value, uintptr_t address, unsigned size, bool privileged) {
+void ARMContext::write_MemA_with_priv(uintptr_t address, unsigned size, uint64_t value, bool privileged) {
     if (address != Align(address, size)) {
         if (SCTLR.A && SCTLR.U) {
-            AlignmentFault(address, false);
+            AlignmentFault(address, true);
         }
 
         address = Align(address, size);
@@ -302,21 +302,21 @@ void ARMContext::write_MemA_with_priv(uint32_t value, uintptr_t address, unsigne
     writeMemory(address, size, value);
 }
 
-void ARMContext::write_MemU(uint32_t value, uintptr_t address, unsigned size) {
-    return write_MemU_with_priv(value, address, size, CurrentModeIsNotUser());
+void ARMContext::write_MemU(uintptr_t address, unsigned size, uint64_t value) {
+    return write_MemU_with_priv(address, size, value, CurrentModeIsNotUser());
 }
 
-void ARMContext::write_MemU_unpriv(uint32_t value, uintptr_t address, unsigned size) {
-    return write_MemU_with_priv(value, address, size, false);
+void ARMContext::write_MemU_unpriv(uintptr_t address, unsigned size, uint64_t value) {
+    return write_MemU_with_priv(address, size, value, false);
 }
 
-void ARMContext::write_MemU_with_priv(uint32_t value, uintptr_t address, unsigned size, bool privileged) {
+void ARMContext::write_MemU_with_priv(uintptr_t address, unsigned size, uint64_t value, bool privileged) {
     if (SCTLR.A == 0 && SCTLR.U == 0) {
         address = Align(address, size);
     }
 
     if (address == Align(address, size)) {
-        write_MemA_with_priv(value, address, size, privileged);
+        write_MemA_with_priv(address, size, value, privileged);
     } else if (SCTLR.A) {
         AlignmentFault(address, true);
     } else {
@@ -324,22 +324,37 @@ void ARMContext::write_MemU_with_priv(uint32_t value, uintptr_t address, unsigne
             BigEndianReverse(value, size);
         }
 
-        for (unsigned i = 0; i < size; i++) {
-            write_MemA_with_priv(reinterpret_cast<uint8_t *>(&value)[i], address + i, 1, privileged);
-        }
+        writeMemory(address, size, value);
     }
 }
 
-uint32_t ARMContext::readMemory(uintptr_t address, unsigned size) const {
+uint64_t ARMContext::readMemory(uintptr_t address, unsigned size) const {
     LOG_DEBUG("address=0x%.8x, size=0x%.8x", address, size);
     uint64_t value = 0;
-    m_memory->read(address, &value, size);
+    if (unlikely(!m_memory->readSized(address, size, value))) {
+        m_memory_fault = true;
+    }
+
+    if (m_observer) {
+        m_observer->onMemoryRead(address, size, value);
+    }
+
     return value;
 }
 
-uint32_t ARMContext::writeMemory(uintptr_t address, unsigned size, uintptr_t value) {
-    LOG_DEBUG("address=0x%.8x, size=0x%.8x, value=0x%.8x", address, size, value);
-    return 0;
+bool ARMContext::writeMemory(uintptr_t address, unsigned size, uint64_t value) {
+    LOG_DEBUG("address=0x%.8x, size=0x%.8x, value=0x%.8" PRIx64, address, size, value);
+
+    if (m_observer) {
+        m_observer->onMemoryWrite(address, size, value);
+    }
+
+    if (unlikely(!m_memory->writeSized(address, size, value))) {
+        m_memory_fault = true;
+        return false;
+    }
+
+    return true;
 }
 
 uint32_t ARMContext::readElement(uintptr_t address, uintptr_t value, unsigned size) const {
@@ -735,25 +750,25 @@ bool ARMContext::ConditionPassed() const {
     // Evaluate base condition.
     switch (get_bits(cond, 3, 1)) {
         case 0:
-            result = (APSR.Z == 1);
+            result = (flagZ() == 1);
             break;
         case 1:
-            result = (APSR.C == 1);
+            result = (flagC() == 1);
             break;
         case 2:
-            result = (APSR.N == 1);
+            result = (flagN() == 1);
             break;
         case 3:
-            result = (APSR.V == 1);
+            result = (flagV() == 1);
             break;
         case 4:
-            result = (APSR.C == 1) && (APSR.Z == 0);
+            result = (flagC() == 1) && (flagZ() == 0);
             break;
         case 5:
-            result = (APSR.N == APSR.V);
+            result = (flagN() == flagV());
             break;
         case 6:
-            result = (APSR.N == APSR.V) && (APSR.Z == 0);
+            result = (flagN() == flagV()) && (flagZ() == 0);
             break;
         case 7:
             result = true;
@@ -807,6 +822,7 @@ void ARMContext::EnterHypMode(uint32_t new_spsr_value, uint32_t preferred_except
 
 void ARMContext::TakeHypTrapException() {
     uint32_t preferred_exceptn_return = PC() - ((CPSR.T == 1) ? 4 : 8);
+    syncFlags();
     uint32_t new_spsr_value = CPSR;
     EnterHypMode(new_spsr_value, preferred_exceptn_return, 20);
 }
@@ -814,6 +830,7 @@ void ARMContext::TakeHypTrapException() {
 void ARMContext::TakeSMCException() {
     m_it_session.ITAdvance();
     uint32_t new_lr_value = (CPSR.T == 1) ? PC() : (PC() - 4);
+    syncFlags();
     uint32_t new_spsr_value = CPSR;
     uint32_t vect_offset = 8;
     if (CPSR.M == 2)
@@ -893,6 +910,8 @@ void ARMContext::CPSRWriteByInstr(unsigned value, unsigned byte_mask, bool is_ex
     bool privileged = CurrentModeIsNotUser();
     bool nmfi = SCTLR.NMFI == 1;
 
+    syncFlags();
+
     if (get_bit(byte_mask, 3) == 1) {
         set_bits(CPSR, 31, 27, get_bits(value, 31, 27));
         if (is_exception_return) {
@@ -9,6 +9,7 @@
 #define SRC_LIBDISASSEMBLY_ARM_ARMCONTEXT_H_
 
 #include "arm/ARMArch.h"
+#include "arm/ARMObserver.h"
 #include "memory/Memory.h"
 
 #include <cstdint>
@@ -66,6 +67,91 @@ public:
         return m_double_regs;
     }
 
+    // Receives every data access, nullptr when nobody is listening.
+    void setObserver(Emulator::ARMObserver *observer) {
+        m_observer = observer;
+    }
+
+    // Set when a data access of the current instruction faulted, the memory describes the
+    // fault with getFault(). The emulator checks it after every instruction.
+    bool hasMemoryFault() const {
+        return m_memory_fault;
+    }
+
+    void clearMemoryFault() {
+        m_memory_fault = false;
+    }
+
+    // Raw views of the core registers and the CPSR for code generated at run time.
+    uint32_t *getCoreRegisterFile() {
+        return m_core_regs.data();
+    }
+
+    uint32_t *getCPSRWord() {
+        syncFlags();
+        return &static_cast<unsigned &>(CPSR);
+    }
+
+    // Lazy condition flags. Flag setting instructions record the result and the carry and
+    // overflow they computed, the APSR bits are only updated when the whole CPSR is needed.
+    // Individual flags are read through flagN(), flagZ(), flagC() and flagV().
+    void setFlagsNZ(uint32_t result) {
+        m_flags_result = result;
+        m_flags_pending |= Flag_N | Flag_Z;
+    }
+
+    void setFlagsNZC(uint32_t result, unsigned carry) {
+        m_flags_result = result;
+        m_flags_carry = carry & 1;
+        m_flags_pending |= Flag_N | Flag_Z | Flag_C;
+    }
+
+    void setFlagsNZCV(uint32_t result, unsigned carry, unsigned overflow) {
+        m_flags_result = result;
+        m_flags_carry = carry & 1;
+        m_flags_overflow = overflow & 1;
+        m_flags_pending = Flag_N | Flag_Z | Flag_C | Flag_V;
+    }
+
+    unsigned flagN() const {
+        return (m_flags_pending & Flag_N) ? m_flags_result >> 31 : APSR.N;
+    }
+
+    unsigned flagZ() const {
+        return (m_flags_pending & Flag_Z) ? m_flags_result == 0 : APSR.Z;
+    }
+
+    unsigned flagC() const {
+        return (m_flags_pending & Flag_C) ? m_flags_carry : APSR.C;
+    }
+
+    unsigned flagV() const {
+        return (m_flags_pending & Flag_V) ? m_flags_overflow : APSR.V;
+    }
+
+    // Fold the pending flags into the APSR. Must be called before the CPSR is read or written
+    // as a whole.
+    void syncFlags() {
+        if (!m_flags_pending) {
+            return;
+        }
+
+        if (m_flags_pending & Flag_N) {
+            APSR.N = flagN();
+            APSR.Z = flagZ();
+        }
+
+        if (m_flags_pending & Flag_C) {
+            APSR.C = m_flags_carry;
+        }
+
+        if (m_flags_pending & Flag_V) {
+            APSR.V = m_flags_overflow;
+        }
+
+        m_flags_pending = 0;
+    }
+
     void setCoreRegisters(std::array<uint32_t, Register::ARM_REG_CORE_MAX> registers) {
         m_core_regs = registers;
     }
@@ -97,23 +183,25 @@ public:
 	void writeDoubleRegister(unsigned regno, double value);
 	void writeQuadRegister(unsigned regno, uint64_t value);
 
-    // Implementation of memory access routines from the manual.
-    uint32_t read_MemA(uintptr_t address, unsigned size) const;
-    uint32_t read_MemA_unpriv(uintptr_t address, unsigned size) const;
-    uint32_t read_MemA_with_priv(uintptr_t address, unsigned size, bool privileged) const;
-    uint32_t read_MemU(uintptr_t address, unsigned size) const;
-    uint32_t read_MemU_unpriv(uintptr_t address, unsigned size) const;
-    uint32_t read_MemU_with_priv(uintptr_t address, unsigned size, bool privileged) const;
-
-    void write_MemA(uint32_t value, uintptr_t address, unsigned size);
-    void write_MemA_unpriv(uint32_t value, uintptr_t address, unsigned size);
-    void write_MemA_with_priv(uint32_t value, uintptr_t address, unsigned size, bool privileged);
-    void write_MemU(uint32_t value, uintptr_t address, unsigned size);
-    void write_MemU_unpriv(uint32_t value, uintptr_t address, unsigned size);
-    void write_MemU_with_priv(uint32_t value, uintptr_t address, unsigned size, bool privileged);
-
-    uint32_t readMemory(uintptr_t address, unsigned size) const;
-	uint32_t writeMemory(uintptr_t address, unsigned size, uintptr_t value);
+    // Implementation of memory access routines from the manual. The arguments follow the
+    // MemA[address, size] = value form of the pseudocode.
+    uint64_t read_MemA(uintptr_t address, unsigned size) const;
+    uint64_t read_MemA_unpriv(uintptr_t address, unsigned size) const;
+    uint64_t read_MemA_with_priv(uintptr_t address, unsigned size, bool privileged) const;
+    uint64_t read_MemU(uintptr_t address, unsigned size) const;
+    uint64_t read_MemU_unpriv(uintptr_t address, unsigned size) const;
+    uint64_t read_MemU_with_priv(uintptr_t address, unsigned size, bool privileged) const;
+
+    void write_MemA(uintptr_t address, unsigned size, uint64_t value);
+    void write_MemA_unpriv(uintptr_t address, unsigned size, uint64_t value);
+    void write_MemA_with_priv(uintptr_t address, unsigned size, uint64_t value, bool privileged);
+    void write_MemU(uintptr_t address, unsigned size, uint64_t value);
+    void write_MemU_unpriv(uintptr_t address, unsigned size, uint64_t value);
+    void write_MemU_with_priv(uintptr_t address, unsigned size, uint64_t value, bool privileged);
+
+    // Accesses of 1, 2, 4 or 8 bytes, little endian.
+    uint64_t readMemory(uintptr_t address, unsigned size) const;
+	bool writeMemory(uintptr_t address, unsigned size, uint64_t value);
 	uint32_t readElement(uintptr_t address, uintptr_t value, unsigned size) const;
 	uint32_t writeElement(uintptr_t address, unsigned size, uintptr_t value, unsigned what);
 
@@ -355,46 +443,62 @@ public:
         }
     }
 
-    // Processor special registers / status variables.
-    fpexc_t FPEXC;
-    hcptr_t HCPTR;
-    cpacr_t CPACR;
-    hsr_t HSR;
-    sctlr_t SCTLR;
-    hsctlr_t HSCTLR;
+    // Processor special registers / status variables, zeroed so alignment checking and the
+    // other SCTLR controls start disabled.
+    fpexc_t FPEXC {};
+    hcptr_t HCPTR {};
+    cpacr_t CPACR {};
+    hsr_t HSR {};
+    sctlr_t SCTLR {};
+    hsctlr_t HSCTLR {};
 
     // APSR is an alias for CPSR in ARMv7.
     union {
-        cpsr_t APSR;
+        cpsr_t APSR {};
         cpsr_t CPSR;
     };
 
-    fpscr_t FPSCR;
-    hcr_t HCR;
-    hstr_t HSTR;
-    itstate_t ITSTATE;
-    jmcr_t JMCR;
-    nsacr_t NSACR;
-    scr_t SCR;
-    spsr_t SPSR;
-    spsr_t SPSR_abt;
-    spsr_t SPSR_fiq;
-    spsr_t SPSR_hyp;
-    spsr_t SPSR_irq;
-    spsr_t SPSR_mon;
-    spsr_t SPSR_svc;
-    spsr_t SPSR_und;
+    fpscr_t FPSCR {};
+    hcr_t HCR {};
+    hstr_t HSTR {};
+    itstate_t ITSTATE {};
+    jmcr_t JMCR {};
+    nsacr_t NSACR {};
+    scr_t SCR {};
+    spsr_t SPSR {};
+    spsr_t SPSR_abt {};
+    spsr_t SPSR_fiq {};
+    spsr_t SPSR_hyp {};
+    spsr_t SPSR_irq {};
+    spsr_t SPSR_mon {};
+    spsr_t SPSR_svc {};
+    spsr_t SPSR_und {};
     uint32_t MVBAR = 0;
     uint32_t HVBAR = 0;
     uint32_t TEEHBR = 0;
     uint32_t ELR_hyp = 0;
 
 private:
+    enum Flag {
+        Flag_N = 1 << 0,
+        Flag_Z = 1 << 1,
+        Flag_C = 1 << 2,
+        Flag_V = 1 << 3
+    };
+
     Memory::AbstractMemory *m_memory;
+    Emulator::ARMObserver *m_observer = nullptr;
+    mutable bool m_memory_fault = false;
+
+    // Condition flags not yet written to the APSR, see syncFlags().
+    unsigned m_flags_pending = 0;
+    uint32_t m_flags_result = 0;
+    unsigned m_flags_carry = 0;
+    unsigned m_flags_overflow = 0;
     bool m_hyp_mode = false;
     ITSession m_it_session;
-    ARMMode m_opcode_mode;
-    ARMVariants m_arm_isa;
+    ARMMode m_opcode_mode = InstrSet_ARM;
+    ARMVariants m_arm_isa = ARMv7;
 
     // Event register used by WFE, SEV, etc.
     unsigned m_event_register = 0;
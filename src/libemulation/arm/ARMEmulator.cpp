@@ -15,45 +15,231 @@ using namespace Disassembler;
 
 namespace Emulator {
     ARMEmulator::ARMEmulator(ARMContext *context, Memory::AbstractMemory *memory, ARMMode mode, ARMVariants variant) :
-        m_mode{mode}, m_contex{context}, m_memory{memory} {
-            m_dis = new ARMDisassembler(variant);
-            m_interpreter = new ARMInterpreter(*m_contex);
+        m_mode{mode}, m_contex{context}, m_interpreter{new ARMInterpreter(*context)},
+        m_dis{new ARMDisassembler(variant)}, m_memory{memory}, m_cache{*memory} {
     }
 
     ARMEmulator::~ARMEmulator() {
+        m_contex->setObserver(nullptr);
+    }
+
+    void ARMEmulator::addObserver(ARMObserver *observer) {
+        m_observers.add(observer);
+        m_contex->setObserver(&m_observers);
+    }
+
+    void ARMEmulator::removeObserver(ARMObserver *observer) {
+        m_observers.remove(observer);
+        if (m_observers.empty()) {
+            m_contex->setObserver(nullptr);
+        }
+    }
+
+    bool ARMEmulator::snapshot() {
+        if (!m_memory->snapshot()) {
+            LOG_ERR("Failed to take a snapshot of the memory");
+            return false;
+        }
+
+        m_contex->syncFlags();
+        m_saved_context = *m_contex;
+        m_saved_mode = m_mode;
+        m_has_snapshot = true;
+        return true;
+    }
+
+    bool ARMEmulator::restore() {
+        if (!m_has_snapshot) {
+            LOG_ERR("Cannot restore without a snapshot");
+            return false;
+        }
+
+        // Restored pages are reported like writes, so blocks decoded from them are dropped.
+        if (!m_memory->restore()) {
+            LOG_ERR("Failed to restore the memory");
+            return false;
+        }
+
+        // Observers may have changed since the snapshot, they are not part of it.
+        *m_contex = m_saved_context;
+        m_contex->setObserver(m_observers.empty() ? nullptr : &m_observers);
+        m_mode = m_saved_mode;
+        return true;
+    }
+
+    void ARMEmulator::enableJIT(unsigned threshold) {
+        if (!m_jit) {
+            m_jit.reset(new ARMJIT());
+        }
+
+        m_jit_threshold = threshold;
+    }
+
+    // Run the native code of 'block', translating it first if it became hot. Returns the number
+    // of instructions executed, zero if the block has to be interpreted.
+    size_t ARMEmulator::runNative(ARMBasicBlock &block, size_t budget) {
+        if (block.native_epoch != m_jit->epoch()) {
+            if (++block.executions < m_jit_threshold) {
+                return 0;
+            }
+
+            m_jit->translate(block);
+        }
+
+        if (!block.native || m_contex->CurrentInstrSet() != InstrSet_ARM) {
+            return 0;
+        }
+
+        ARMJITFrame frame { m_contex, &m_cache, m_cache.generation() };
+        return block.native(m_contex->getCoreRegisterFile(), m_contex->getCPSRWord(), &frame,
+            min<size_t>(budget, block.n_native));
     }
 
     void ARMEmulator::start(unsigned count) {
-        bool stop = false;
-        unsigned n_executed = 0;
+        run(count, nullptr, nullptr);
+    }
 
-        uint32_t cur_pc = 0;
-        uint32_t cur_opcode = 0;
-        ARMMode cur_mode = m_mode;
+    ARMStopReason ARMEmulator::runUntil(const set<uint32_t> &addresses, uint64_t max_instructions) {
+        return run(max_instructions, &addresses, nullptr);
+    }
 
-        // Get the correct PC value of the current instruction.
-        cur_pc = m_contex->getCurrentInstructionAddress();
+    ARMStopReason ARMEmulator::runFor(uint64_t instructions) {
+        return run(instructions, nullptr, nullptr);
+    }
+
+    ARMStopReason ARMEmulator::runFor(chrono::nanoseconds duration) {
+        auto deadline = chrono::steady_clock::now() + duration;
+        return run(UINT64_MAX, nullptr, &deadline);
+    }
+
+    // Stop addresses and the deadline are only checked when a block is entered, the instruction
+    // budget is exact.
+    ARMStopReason ARMEmulator::run(uint64_t count, const set<uint32_t> *stops,
+            const chrono::steady_clock::time_point *deadline) {
+        ARMStopReason reason = StopReason_Count;
+        m_executed = 0;
+        m_contex->clearMemoryFault();
+
+        while (m_executed < count) {
+            // Get the correct PC value of the current instruction.
+            uint32_t cur_pc = m_contex->getCurrentInstructionAddress();
+            ARMMode cur_mode = m_mode;
+            uint8_t cur_itstate = cur_mode == ARMMode_Thumb ? m_contex->ITSTATE.IT : 0;
+
+            if (stops && stops->count(cur_pc)) {
+                reason = StopReason_Address;
+                break;
+            }
+
+            if (deadline && chrono::steady_clock::now() >= *deadline) {
+                reason = StopReason_Time;
+                break;
+            }
+
+            // 1. Look for the block in the cache, fetch and decode it otherwise.
+            ARMBasicBlock *block = m_cache.lookup(cur_pc, cur_mode, cur_itstate);
+            if (!block) {
+                m_memory->clearFault();
+                if (!(block = m_cache.translate(*m_dis, cur_pc, cur_mode, cur_itstate))) {
+                    m_fault = m_memory->getFault();
+                    if (m_fault.reason != Memory::FaultReason_None) {
+                        reason = StopReason_Fault;
+                        break;
+                    }
+
+                    LOG_ERR("Failed to fetch instructions at 0x%.8x", cur_pc);
+                    reason = StopReason_Error;
+                    break;
+                }
+            }
+
+            // Run the block up to the first stop address inside it, the next iteration stops there.
+            size_t end = block->instructions.size();
+            if (stops) {
+                auto it = stops->upper_bound(block->address);
+                if (it != stops->end() && *it < block->end) {
+                    while (block->instructions[end - 1].address >= *it) {
+                        end--;
+                    }
+                }
+            }
 
-        while (!stop && n_executed < count) {
-            // 1. Fetch an instruction from main memory.
-            m_memory->read_value(cur_pc, cur_opcode);
+            size_t generation = m_cache.generation();
+            size_t first = 0;
 
-            // 2. Decode it.
-            ARMInstruction ins = m_dis->disassemble(cur_opcode, cur_mode);
+            // Observers are checked once per block so an emulator without them pays nothing.
+            bool observed = !m_observers.empty();
+            if (observed) {
+                m_observers.onBlockEntry(*m_contex, *block);
+            }
+
+            // 2. Hot blocks run natively, the interpreter picks up wherever the native code stopped.
+            // Native code cannot report single instructions so observed runs are interpreted.
+            if (m_jit && !observed && (first = runNative(*block, min<uint64_t>(count - m_executed, end)))) {
+                m_executed += first;
+
+                if (first == end || m_executed == count || m_cache.generation() != generation) {
+                    continue;
+                }
+
+                cur_pc = block->instructions[first].address;
+            }
+
+            size_t done = first;
+            for (size_t i = first; i < end; i++) {
+                const ARMInstruction &ins = block->instructions[i];
+                uint32_t next_pc = ins.address + ins.ins_size / 8;
+
+                if (observed) {
+                    m_observers.onPreInstruction(*m_contex, ins);
+                }
 
-            // 3. Execute the instruction.
-            m_interpreter->execute(ins);
+                // 3. Execute the instruction through its pre-resolved handler.
+                m_interpreter->execute(block->handlers[i], ins);
 
-            // 4. Print the status of the registers.
-            m_contex->dump();
+                if (unlikely(m_contex->hasMemoryFault())) {
+                    m_contex->clearMemoryFault();
+                    m_contex->setCurrentInstructionAddress(ins.address);
+                    m_fault = m_memory->getFault();
+                    reason = StopReason_Fault;
+                    break;
+                }
 
-            // 5. Increment PC in case the instruction does not modify it.
-            if (cur_pc == m_contex->getCurrentInstructionAddress()) {
-                cur_pc += ins.ins_size / 8;
-                m_contex->setCurrentInstructionAddress(cur_pc);
+                m_executed++;
+                done = i + 1;
+
+                // 4. Increment PC in case the instruction does not modify it.
+                bool branched = m_contex->getCurrentInstructionAddress() != cur_pc;
+                if (!branched) {
+                    cur_pc = next_pc;
+                    m_contex->setCurrentInstructionAddress(cur_pc);
+                }
+
+                if (observed) {
+                    m_contex->syncFlags();
+                    m_observers.onPostInstruction(*m_contex, ins);
+                }
+
+                // 5. Leave the block if the instruction modified the PC. The rest of the block
+                // may also have been overwritten by the instruction.
+                if (branched || m_executed == count || m_cache.generation() != generation) {
+                    break;
+                }
             }
 
-            n_executed++;
+            // Wherever the block was left, a stop, a fault or a write to its code included, the
+            // next one continues the IT block from there.
+            if (block->has_it) {
+                m_contex->ITSTATE.IT = block->itStateAt(done);
+            }
+
+            if (reason == StopReason_Fault) {
+                break;
+            }
         }
+
+        // Instructions leave the condition flags pending, fold them so callers see the CPSR.
+        m_contex->syncFlags();
+        return reason;
     }
 }
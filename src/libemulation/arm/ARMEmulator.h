@@ -9,30 +9,111 @@
 #define SRC_LIBEMULATION_ARM_ARMEMULATOR_H_
 
 #include "arm/ARMArch.h"
+#include "arm/ARMBlockCache.h"
 #include "arm/ARMContext.h"
+#include "arm/ARMJIT.h"
+#include "arm/ARMObserver.h"
 #include "arm/ARMDisassembler.h"
-#include "arm/gen/ARMInterpreter.h"
 #include "memory/Memory.h"
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <set>
+
 namespace Emulator {
+	// Why a run returned.
+	enum ARMStopReason {
+		StopReason_Count,
+		StopReason_Address,
+		StopReason_Time,
+		StopReason_Error,
+
+		// A memory access faulted, see ARMEmulator::getFault().
+		StopReason_Fault
+	};
+
 	class ARMEmulator {
 	private:
 		ARMMode m_mode;
 		ARMContext *m_contex;
-		ARMInterpreter *m_interpreter;
-		Disassembler::ARMDisassembler *m_dis;
+		std::unique_ptr<ARMInterpreter> m_interpreter;
+		std::unique_ptr<Disassembler::ARMDisassembler> m_dis;
 		Memory::AbstractMemory *m_memory;
+		ARMBlockCache m_cache;
+		std::unique_ptr<ARMJIT> m_jit;
+		unsigned m_jit_threshold = 0;
+		ARMObserverList m_observers;
+		uint64_t m_executed = 0;
+		Memory::Fault m_fault;
+
+		// State saved by snapshot().
+		ARMContext m_saved_context;
+		ARMMode m_saved_mode;
+		bool m_has_snapshot = false;
+
+		size_t runNative(ARMBasicBlock &block, size_t budget);
+		ARMStopReason run(uint64_t count, const std::set<uint32_t> *stops,
+			const std::chrono::steady_clock::time_point *deadline);
 
 	public:
 		ARMEmulator(ARMContext *context, Memory::AbstractMemory *memory, ARMMode mode = ARMMode_ARM, ARMVariants = ARMv7);
 		virtual ~ARMEmulator();
 
+		ARMEmulator(const ARMEmulator &) = delete;
+		ARMEmulator &operator=(const ARMEmulator &) = delete;
+
 		void start(unsigned count = 0);
 
+		// Run until the PC reaches one of 'addresses' or 'max_instructions' ran. An address in
+		// the middle of a block is honored, the block is cut short before it.
+		ARMStopReason runUntil(const std::set<uint32_t> &addresses, uint64_t max_instructions = UINT64_MAX);
+
+		// Run exactly 'instructions' instructions unless an error stops the emulation first.
+		ARMStopReason runFor(uint64_t instructions);
+
+		// Run until 'duration' elapsed. The clock is read once per block so the run may go
+		// over by one block.
+		ARMStopReason runFor(std::chrono::nanoseconds duration);
+
+		// Number of instructions executed by the last run.
+		uint64_t getExecutedCount() const {
+			return m_executed;
+		}
+
+		// Access that stopped the last run with StopReason_Fault. The PC is left at the faulting
+		// instruction, which is not counted as executed, and the base register and the registers
+		// it would have loaded keep their values so it can run again once the fault is handled.
+		// Like on hardware, a load multiple may have loaded the registers before the faulting
+		// word and a store multiple may have stored the words before it.
+		const Memory::Fault &getFault() const {
+			return m_fault;
+		}
+
+		// Observers are not owned and have to outlive the emulator or be removed first.
+		void addObserver(ARMObserver *observer);
+		void removeObserver(ARMObserver *observer);
+
+		// Save the registers and the memory contents. restore() goes back to them as many times
+		// as needed, copying only the memory pages written in between.
+		bool snapshot();
+		bool restore();
+
+		// Compile blocks to native code once they have been entered 'threshold' times.
+		void enableJIT(unsigned threshold = 16);
+
 		ARMContext &getContext() const {
 			return *m_contex;
 		}
 
+		Memory::AbstractMemory &getMemory() const {
+			return *m_memory;
+		}
+
+		ARMBlockCache &getBlockCache() {
+			return m_cache;
+		}
+
 		void setMode(ARMMode mode) {
 			m_mode = mode;
 		}
@@ -0,0 +1,801 @@
+/*
+ * ARMJIT.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#include "ARMJIT.h"
+#include "arm/ARMUtilities.h"
+#include "arm/gen/ARMDecodingTable.h"
+#include "debug.h"
+
+#include <cstring>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace Disassembler;
+
+namespace Emulator {
+#if defined(__x86_64__)
+    namespace {
+        enum X86Reg {
+            RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8, R9, R10, R11, R12, R13, R14, R15
+        };
+
+        enum X86Cond {
+            CC_O = 0x0, CC_B = 0x2, CC_AE = 0x3, CC_E = 0x4, CC_A = 0x7, CC_S = 0x8
+        };
+
+        // Group 1 arithmetic operations, the value is the /digit of the immediate forms.
+        enum X86Alu {
+            ALU_ADD = 0, ALU_OR = 1, ALU_AND = 4, ALU_SUB = 5, ALU_XOR = 6, ALU_CMP = 7
+        };
+
+        enum X86Shift {
+            SHIFT_ROR = 1, SHIFT_SHL = 4, SHIFT_SHR = 5, SHIFT_SAR = 7
+        };
+
+        // Just enough of an x86-64 assembler for the translator. All the operations are 32 bit
+        // unless the name says otherwise and memory operands are always [base + disp8].
+        class X86Emitter {
+        public:
+            vector<uint8_t> code;
+
+            size_t size() const {
+                return code.size();
+            }
+
+            void byte(uint8_t value) {
+                code.push_back(value);
+            }
+
+            void dword(uint32_t value) {
+                for (unsigned i = 0; i < 4; i++) {
+                    byte(value >> (i * 8));
+                }
+            }
+
+            void load(unsigned reg, unsigned base, int8_t disp) {
+                rex(false, reg, base);
+                byte(0x8b);
+                memory(reg, base, disp);
+            }
+
+            void store(unsigned base, int8_t disp, unsigned reg) {
+                rex(false, reg, base);
+                byte(0x89);
+                memory(reg, base, disp);
+            }
+
+            void store_imm(unsigned base, int8_t disp, uint32_t imm) {
+                rex(false, 0, base);
+                byte(0xc7);
+                memory(0, base, disp);
+                dword(imm);
+            }
+
+            void mov(unsigned dst, unsigned src) {
+                rex(false, src, dst);
+                byte(0x89);
+                direct(src, dst);
+            }
+
+            void mov64(unsigned dst, unsigned src) {
+                rex(true, src, dst);
+                byte(0x89);
+                direct(src, dst);
+            }
+
+            void mov_imm(unsigned dst, uint32_t imm) {
+                rex(false, 0, dst);
+                byte(0xb8 + (dst & 7));
+                dword(imm);
+            }
+
+            void mov64_imm(unsigned dst, uint64_t imm) {
+                rex(true, 0, dst);
+                byte(0xb8 + (dst & 7));
+                dword(imm);
+                dword(imm >> 32);
+            }
+
+            void alu(X86Alu op, unsigned dst, unsigned src) {
+                rex(false, src, dst);
+                byte((op << 3) | 1);
+                direct(src, dst);
+            }
+
+            void alu_imm(X86Alu op, unsigned dst, uint32_t imm) {
+                rex(false, 0, dst);
+                byte(0x81);
+                direct(op, dst);
+                dword(imm);
+            }
+
+            void alu64_imm8(X86Alu op, unsigned dst, int8_t imm) {
+                rex(true, 0, dst);
+                byte(0x83);
+                direct(op, dst);
+                byte(imm);
+            }
+
+            void cmp_imm8(unsigned dst, int8_t imm) {
+                rex(false, 0, dst);
+                byte(0x83);
+                direct(ALU_CMP, dst);
+                byte(imm);
+            }
+
+            void test(unsigned dst, unsigned src) {
+                rex(false, src, dst);
+                byte(0x85);
+                direct(src, dst);
+            }
+
+            void not_(unsigned dst) {
+                rex(false, 0, dst);
+                byte(0xf7);
+                direct(2, dst);
+            }
+
+            void shift(X86Shift op, unsigned dst, uint8_t amount) {
+                rex(false, 0, dst);
+                byte(0xc1);
+                direct(op, dst);
+                byte(amount);
+            }
+
+            // Byte registers 4 to 7 would need a REX prefix, the translator never uses them.
+            void setcc(X86Cond cond, unsigned dst) {
+                rex(false, 0, dst);
+                byte(0x0f);
+                byte(0x90 | cond);
+                direct(0, dst);
+            }
+
+            void movzx8(unsigned dst, unsigned src) {
+                rex(false, dst, src);
+                byte(0x0f);
+                byte(0xb6);
+                direct(dst, src);
+            }
+
+            void push(unsigned reg) {
+                rex(false, 0, reg);
+                byte(0x50 + (reg & 7));
+            }
+
+            void pop(unsigned reg) {
+                rex(false, 0, reg);
+                byte(0x58 + (reg & 7));
+            }
+
+            void call(unsigned reg) {
+                rex(false, 0, reg);
+                byte(0xff);
+                direct(2, reg);
+            }
+
+            void ret() {
+                byte(0xc3);
+            }
+
+            // Jumps are emitted with an empty displacement, the returned offset is patched
+            // once the target is known.
+            size_t jcc8(X86Cond cond) {
+                byte(0x70 | cond);
+                byte(0);
+                return size() - 1;
+            }
+
+            size_t jmp32() {
+                byte(0xe9);
+                dword(0);
+                return size() - 4;
+            }
+
+            void patch8(size_t offset) {
+                code[offset] = static_cast<uint8_t>(size() - offset - 1);
+            }
+
+            void patch32(size_t offset) {
+                uint32_t rel = size() - offset - 4;
+                memcpy(&code[offset], &rel, sizeof(rel));
+            }
+
+        private:
+            void rex(bool wide, unsigned reg, unsigned rm) {
+                uint8_t prefix = 0x40 | (wide << 3) | ((reg >> 3) << 2) | (rm >> 3);
+                if (prefix != 0x40) {
+                    byte(prefix);
+                }
+            }
+
+            void direct(unsigned reg, unsigned rm) {
+                byte(0xc0 | ((reg & 7) << 3) | (rm & 7));
+            }
+
+            void memory(unsigned reg, unsigned base, int8_t disp) {
+                byte(0x40 | ((reg & 7) << 3) | (base & 7));
+                byte(disp);
+            }
+        };
+
+        const uint32_t FLAG_N = 1u << 31;
+        const uint32_t FLAG_Z = 1u << 30;
+        const uint32_t FLAG_C = 1u << 29;
+        const uint32_t FLAG_V = 1u << 28;
+
+        // Where the carry flag of a flag setting instruction comes from.
+        enum CarrySource {
+            CARRY_KEEP, CARRY_CLEAR, CARRY_SET, CARRY_X86, CARRY_X86_INVERTED, CARRY_SHIFTER
+        };
+
+        enum DataProcessingOp {
+            OP_AND, OP_EOR, OP_SUB, OP_RSB, OP_ADD, OP_TST, OP_TEQ, OP_CMP, OP_CMN, OP_ORR, OP_MOV, OP_BIC, OP_MVN
+        };
+
+        // Register allocation of the native code:
+        //   rbx: ARM core registers, rbp: CPSR, r12: ARMJITFrame, r13d: instruction limit.
+        // eax, ecx, edx, esi, edi and r8-r10 are scratch and die at every instruction boundary.
+        class ARMTranslator {
+        public:
+            X86Emitter as;
+
+            void prologue() {
+                as.push(RBX);
+                as.push(RBP);
+                as.push(R12);
+                as.push(R13);
+                as.alu64_imm8(ALU_SUB, RSP, 8);
+                as.mov64(RBX, RDI);
+                as.mov64(RBP, RSI);
+                as.mov64(R12, RDX);
+                as.mov(R13, RCX);
+            }
+
+            void epilogue() {
+                for (auto offset : m_exits) {
+                    as.patch32(offset);
+                }
+
+                as.alu64_imm8(ALU_ADD, RSP, 8);
+                as.pop(R13);
+                as.pop(R12);
+                as.pop(RBP);
+                as.pop(RBX);
+                as.ret();
+            }
+
+            // Return to the emulator once 'count' instructions ran and the next one is at 'pc'.
+            void exit(size_t count, uint32_t pc) {
+                as.store_imm(RBX, reg(15), pc);
+                as.mov_imm(RAX, count);
+                m_exits.push_back(as.jmp32());
+            }
+
+            // Leave before instruction number 'count' if the caller asked for fewer.
+            void check_limit(size_t count, uint32_t pc) {
+                as.cmp_imm8(R13, count);
+                size_t skip = as.jcc8(CC_A);
+                exit(count, pc);
+                as.patch8(skip);
+            }
+
+            // Forget everything emitted past 'offset'.
+            void rollback(size_t offset) {
+                as.code.resize(offset);
+                while (!m_exits.empty() && m_exits.back() >= offset) {
+                    m_exits.pop_back();
+                }
+            }
+
+            // Emit instruction number 'index' of the block. Sets 'branch' if it wrote the PC.
+            bool instruction(const ARMInstruction &ins, size_t index, bool &branch);
+
+        private:
+            static int8_t reg(unsigned n) {
+                return static_cast<int8_t>(n * 4);
+            }
+
+            bool shifted_register(unsigned m, unsigned type, unsigned amount, bool carry, CarrySource &source);
+            void flags(CarrySource carry, bool overflow);
+            bool data_processing(const ARMInstruction &ins, DataProcessingOp op, bool immediate, unsigned type);
+            bool load_store(const ARMInstruction &ins, size_t index, bool load, unsigned size);
+
+            vector<size_t> m_exits;
+        };
+
+        // Result of a memory access made by native code, returned in rax and rdx.
+        struct JITAccess {
+            uint64_t value;
+            uint64_t fault;
+        };
+
+        JITAccess jit_read(ARMJITFrame *frame, uint32_t address, uint32_t size) {
+            uint32_t data = frame->context->read_MemU(address, size);
+
+            // Without UnalignedSupport() an unaligned LDR rotates the aligned word.
+            if (size == 4 && (address & 3)) {
+                data = ROR(data, 8 * (address & 3));
+            }
+
+            return { data, frame->context->hasMemoryFault() };
+        }
+
+        // The value is non zero if the store dropped a block, the native code has to stop then.
+        JITAccess jit_write(ARMJITFrame *frame, uint32_t address, uint32_t value, uint32_t size) {
+            frame->context->write_MemU(address, size, value);
+            return { frame->cache->generation() != frame->generation, frame->context->hasMemoryFault() };
+        }
+
+        // Load R[m] shifted by a constant into ecx. If 'carry' is set the shifter carry out
+        // is left in r10b.
+        bool ARMTranslator::shifted_register(unsigned m, unsigned type, unsigned amount, bool carry,
+                CarrySource &source) {
+            source = CARRY_KEEP;
+            as.load(RCX, RBX, reg(m));
+
+            if (type == SRType_LSL && amount == 0) {
+                return true;
+            }
+
+            // LSR #32 and ASR #32 do not exist on x86 and are rare enough to leave with flags.
+            if (amount == 32) {
+                if (carry) {
+                    return false;
+                }
+
+                if (type == SRType_LSR) {
+                    as.mov_imm(RCX, 0);
+                    return true;
+                }
+
+                if (type == SRType_ASR) {
+                    as.shift(SHIFT_SAR, RCX, 31);
+                    return true;
+                }
+
+                return false;
+            }
+
+            switch (type) {
+                case SRType_LSL:
+                    as.shift(SHIFT_SHL, RCX, amount);
+                    break;
+                case SRType_LSR:
+                    as.shift(SHIFT_SHR, RCX, amount);
+                    break;
+                case SRType_ASR:
+                    as.shift(SHIFT_SAR, RCX, amount);
+                    break;
+                case SRType_ROR:
+                    as.shift(SHIFT_ROR, RCX, amount);
+                    break;
+                default:
+                    return false;
+            }
+
+            // The x86 carry is the last bit shifted out, same as Shift_C.
+            if (carry) {
+                as.setcc(CC_B, R10);
+                source = CARRY_SHIFTER;
+            }
+
+            return true;
+        }
+
+        // Fold the x86 flags of the last operation into the CPSR. N and Z are always updated,
+        // C comes from 'carry' and V from the x86 overflow flag if 'overflow' is set.
+        void ARMTranslator::flags(CarrySource carry, bool overflow) {
+            uint32_t keep = ~(FLAG_N | FLAG_Z);
+
+            as.setcc(CC_S, RCX);
+            as.setcc(CC_E, RDX);
+            if (carry == CARRY_X86 || carry == CARRY_X86_INVERTED) {
+                // x86 subtraction sets the carry on borrow, ARM on no borrow.
+                as.setcc(carry == CARRY_X86 ? CC_B : CC_AE, R8);
+            }
+
+            if (overflow) {
+                as.setcc(CC_O, R9);
+            }
+
+            as.movzx8(RCX, RCX);
+            as.shift(SHIFT_SHL, RCX, 31);
+            as.movzx8(RDX, RDX);
+            as.shift(SHIFT_SHL, RDX, 30);
+            as.alu(ALU_OR, RCX, RDX);
+
+            switch (carry) {
+                case CARRY_X86:
+                case CARRY_X86_INVERTED:
+                case CARRY_SHIFTER:
+                    as.movzx8(RDX, carry == CARRY_SHIFTER ? R10 : R8);
+                    as.shift(SHIFT_SHL, RDX, 29);
+                    as.alu(ALU_OR, RCX, RDX);
+                    keep &= ~FLAG_C;
+                    break;
+                case CARRY_SET:
+                    as.alu_imm(ALU_OR, RCX, FLAG_C);
+                    keep &= ~FLAG_C;
+                    break;
+                case CARRY_CLEAR:
+                    keep &= ~FLAG_C;
+                    break;
+                case CARRY_KEEP:
+                    break;
+            }
+
+            if (overflow) {
+                as.movzx8(RDX, R9);
+                as.shift(SHIFT_SHL, RDX, 28);
+                as.alu(ALU_OR, RCX, RDX);
+                keep &= ~FLAG_V;
+            }
+
+            as.load(RDX, RBP, 0);
+            as.alu_imm(ALU_AND, RDX, keep);
+            as.alu(ALU_OR, RDX, RCX);
+            as.store(RBP, 0, RDX);
+        }
+
+        bool ARMTranslator::data_processing(const ARMInstruction &ins, DataProcessingOp op, bool immediate,
+                unsigned type) {
+            bool compare = op == OP_TST || op == OP_TEQ || op == OP_CMP || op == OP_CMN;
+            bool arithmetic = op == OP_SUB || op == OP_RSB || op == OP_ADD || op == OP_CMP || op == OP_CMN;
+            bool has_n = op != OP_MOV && op != OP_MVN;
+            bool setflags = compare || ins.setflags;
+
+            if ((!compare && ins.d == 15) || (has_n && ins.n == 15) || (!immediate && ins.m == 15)) {
+                return false;
+            }
+
+            // The second operand goes to ecx.
+            CarrySource carry = CARRY_KEEP;
+            if (immediate) {
+                as.mov_imm(RCX, ins.imm32);
+
+                // ARMExpandImm_C only changes the carry if the constant is rotated.
+                if ((ins.imm12 >> 8) & 0xf) {
+                    carry = (ins.imm32 >> 31) ? CARRY_SET : CARRY_CLEAR;
+                }
+            } else if (!shifted_register(ins.m, type, ins.shift_n, setflags && !arithmetic, carry)) {
+                return false;
+            }
+
+            if (has_n) {
+                as.load(RAX, RBX, reg(ins.n));
+            }
+
+            switch (op) {
+                case OP_AND:
+                case OP_TST:
+                    as.alu(ALU_AND, RAX, RCX);
+                    break;
+                case OP_EOR:
+                case OP_TEQ:
+                    as.alu(ALU_XOR, RAX, RCX);
+                    break;
+                case OP_ORR:
+                    as.alu(ALU_OR, RAX, RCX);
+                    break;
+                case OP_BIC:
+                    as.not_(RCX);
+                    as.alu(ALU_AND, RAX, RCX);
+                    break;
+                case OP_ADD:
+                case OP_CMN:
+                    as.alu(ALU_ADD, RAX, RCX);
+                    break;
+                case OP_SUB:
+                case OP_CMP:
+                    as.alu(ALU_SUB, RAX, RCX);
+                    break;
+                case OP_RSB:
+                    as.alu(ALU_SUB, RCX, RAX);
+                    as.mov(RAX, RCX);
+                    break;
+                case OP_MOV:
+                case OP_MVN:
+                    as.mov(RAX, RCX);
+                    if (op == OP_MVN) {
+                        as.not_(RAX);
+                    }
+
+                    if (setflags) {
+                        as.test(RAX, RAX);
+                    }
+                    break;
+            }
+
+            // mov leaves the x86 flags alone.
+            if (!compare) {
+                as.store(RBX, reg(ins.d), RAX);
+            }
+
+            if (setflags) {
+                if (arithmetic) {
+                    flags(op == OP_ADD || op == OP_CMN ? CARRY_X86 : CARRY_X86_INVERTED, true);
+                } else {
+                    flags(carry, false);
+                }
+            }
+
+            return true;
+        }
+
+        bool ARMTranslator::load_store(const ARMInstruction &ins, size_t index, bool load, unsigned size) {
+            if (ins.n == 15 || ins.t == 15 || (ins.wback && ins.n == ins.t)) {
+                return false;
+            }
+
+            X86Alu offset = ins.add ? ALU_ADD : ALU_SUB;
+
+            // jit_read(frame, address, size) or jit_write(frame, address, value, size).
+            as.mov64(RDI, R12);
+            as.load(RSI, RBX, reg(ins.n));
+            if (ins.index) {
+                as.alu_imm(offset, RSI, ins.imm32);
+            }
+
+            if (load) {
+                as.mov_imm(RDX, size);
+                as.mov64_imm(RAX, reinterpret_cast<uintptr_t>(&jit_read));
+            } else {
+                as.load(RDX, RBX, reg(ins.t));
+                as.mov_imm(RCX, size);
+                as.mov64_imm(RAX, reinterpret_cast<uintptr_t>(&jit_write));
+            }
+
+            as.call(RAX);
+
+            // A faulting access leaves before the instruction, which the interpreter then runs
+            // again to report the fault.
+            as.test(RDX, RDX);
+            size_t done = as.jcc8(CC_E);
+            exit(index, ins.address);
+            as.patch8(done);
+
+            if (load) {
+                as.store(RBX, reg(ins.t), RAX);
+            }
+
+            if (ins.wback) {
+                as.load(RCX, RBX, reg(ins.n));
+                as.alu_imm(offset, RCX, ins.imm32);
+                as.store(RBX, reg(ins.n), RCX);
+            }
+
+            if (!load) {
+                as.test(RAX, RAX);
+                size_t skip = as.jcc8(CC_E);
+                exit(index + 1, ins.address + 4);
+                as.patch8(skip);
+            }
+
+            return true;
+        }
+
+        bool ARMTranslator::instruction(const ARMInstruction &ins, size_t index, bool &branch) {
+            // Only unconditional instructions, flags are never tested by native code.
+            if (ins.m_status != eStatusValid || (ins.opcode >> 28) != 0xe) {
+                return false;
+            }
+
+            switch (ins.id) {
+                case ARMInstructionId::and_immediate:
+                    return data_processing(ins, OP_AND, true, 0);
+                case ARMInstructionId::eor_immediate:
+                    return data_processing(ins, OP_EOR, true, 0);
+                case ARMInstructionId::sub_immediate_arm:
+                    return data_processing(ins, OP_SUB, true, 0);
+                case ARMInstructionId::rsb_immediate:
+                    return data_processing(ins, OP_RSB, true, 0);
+                case ARMInstructionId::add_immediate_arm:
+                    return data_processing(ins, OP_ADD, true, 0);
+                case ARMInstructionId::tst_immediate:
+                    return data_processing(ins, OP_TST, true, 0);
+                case ARMInstructionId::teq_immediate:
+                    return data_processing(ins, OP_TEQ, true, 0);
+                case ARMInstructionId::cmp_immediate:
+                    return data_processing(ins, OP_CMP, true, 0);
+                case ARMInstructionId::cmn_immediate:
+                    return data_processing(ins, OP_CMN, true, 0);
+                case ARMInstructionId::orr_immediate:
+                    return data_processing(ins, OP_ORR, true, 0);
+                case ARMInstructionId::mov_immediate:
+                    return data_processing(ins, OP_MOV, true, 0);
+                case ARMInstructionId::bic_immediate:
+                    return data_processing(ins, OP_BIC, true, 0);
+                case ARMInstructionId::mvn_immediate:
+                    return data_processing(ins, OP_MVN, true, 0);
+
+                case ARMInstructionId::and_register:
+                    return data_processing(ins, OP_AND, false, ins.shift_t);
+                case ARMInstructionId::eor_register:
+                    return data_processing(ins, OP_EOR, false, ins.shift_t);
+                case ARMInstructionId::sub_register:
+                    return data_processing(ins, OP_SUB, false, ins.shift_t);
+                case ARMInstructionId::rsb_register:
+                    return data_processing(ins, OP_RSB, false, ins.shift_t);
+                case ARMInstructionId::add_register_arm:
+                    return data_processing(ins, OP_ADD, false, ins.shift_t);
+                case ARMInstructionId::tst_register:
+                    return data_processing(ins, OP_TST, false, ins.shift_t);
+                case ARMInstructionId::teq_register:
+                    return data_processing(ins, OP_TEQ, false, ins.shift_t);
+                case ARMInstructionId::cmp_register:
+                    return data_processing(ins, OP_CMP, false, ins.shift_t);
+                case ARMInstructionId::cmn_register:
+                    return data_processing(ins, OP_CMN, false, ins.shift_t);
+                case ARMInstructionId::orr_register:
+                    return data_processing(ins, OP_ORR, false, ins.shift_t);
+                case ARMInstructionId::bic_register:
+                    return data_processing(ins, OP_BIC, false, ins.shift_t);
+                case ARMInstructionId::mvn_register:
+                    return data_processing(ins, OP_MVN, false, ins.shift_t);
+                case ARMInstructionId::mov_register_arm:
+                    return data_processing(ins, OP_MOV, false, SRType_LSL);
+                case ARMInstructionId::lsl_immediate:
+                    return data_processing(ins, OP_MOV, false, SRType_LSL);
+                case ARMInstructionId::lsr_immediate:
+                    return data_processing(ins, OP_MOV, false, SRType_LSR);
+                case ARMInstructionId::asr_immediate:
+                    return data_processing(ins, OP_MOV, false, SRType_ASR);
+                case ARMInstructionId::ror_immediate:
+                    return data_processing(ins, OP_MOV, false, SRType_ROR);
+
+                case ARMInstructionId::ldr_immediate_arm:
+                    return load_store(ins, index, true, 4);
+                case ARMInstructionId::ldrb_immediate_arm:
+                    return load_store(ins, index, true, 1);
+                case ARMInstructionId::str_immediate_arm:
+                    return load_store(ins, index, false, 4);
+                case ARMInstructionId::strb_immediate_arm:
+                    return load_store(ins, index, false, 1);
+
+                case ARMInstructionId::b:
+                    as.store_imm(RBX, reg(15), (ins.address + 8 + ins.imm32) & ~3);
+                    branch = true;
+                    return true;
+
+                case ARMInstructionId::bl_blx_immediate:
+                    // BLX switches to Thumb, leave it to the interpreter.
+                    if (ins.targetInstrSet != InstrSet_ARM) {
+                        return false;
+                    }
+
+                    as.store_imm(RBX, reg(14), ins.address + 4);
+                    as.store_imm(RBX, reg(15), (((ins.address + 8) & ~3) + ins.imm32) & ~3);
+                    branch = true;
+                    return true;
+
+                default:
+                    return false;
+            }
+        }
+    }
+
+    ARMJIT::ARMJIT(size_t size) {
+        void *buffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (buffer == MAP_FAILED) {
+            LOG_ERR("Could not allocate %zu bytes for the JIT, falling back to the interpreter", size);
+            return;
+        }
+
+        m_buffer = static_cast<uint8_t *>(buffer);
+        m_size = size;
+        m_page_size = sysconf(_SC_PAGESIZE);
+    }
+
+    ARMJIT::~ARMJIT() {
+        if (m_buffer) {
+            munmap(m_buffer, m_size);
+        }
+    }
+
+    bool ARMJIT::translate(ARMBasicBlock &block) {
+        block.native = nullptr;
+        block.n_native = 0;
+        block.native_epoch = m_epoch;
+
+        if (!m_buffer || block.mode != ARMMode_ARM) {
+            return false;
+        }
+
+        ARMTranslator translator;
+        translator.prologue();
+
+        size_t count = 0;
+        bool branch = false;
+        for (const auto &ins : block.instructions) {
+            if (count) {
+                translator.check_limit(count, ins.address);
+            }
+
+            size_t offset = translator.as.size();
+            if (!translator.instruction(ins, count, branch)) {
+                translator.rollback(offset);
+                break;
+            }
+
+            count++;
+            if (branch) {
+                break;
+            }
+        }
+
+        if (!count) {
+            return false;
+        }
+
+        if (!branch) {
+            translator.as.store_imm(RBX, 15 * 4, block.instructions[count - 1].address + 4);
+        }
+
+        translator.as.mov_imm(RAX, count);
+        translator.epilogue();
+
+        const vector<uint8_t> &code = translator.as.code;
+        if (code.size() > m_size) {
+            return false;
+        }
+
+        // Out of space, drop every translation at once. Nothing runs the old code anymore so the
+        // whole buffer goes back to writable.
+        if (m_used + code.size() > m_size) {
+            LOG_DEBUG("JIT buffer full, flushing %zu bytes", m_used);
+            mprotect(m_buffer, m_size, PROT_READ | PROT_WRITE);
+            m_used = 0;
+            block.native_epoch = ++m_epoch;
+        }
+
+        // Native code only runs between translations, so the pages shared with earlier blocks
+        // can be writable while the new code is copied next to them.
+        size_t page_mask = m_page_size - 1;
+        uint8_t *first_page = m_buffer + (m_used & ~page_mask);
+        size_t length = ((m_used + code.size() + page_mask) & ~page_mask) - (m_used & ~page_mask);
+        if (mprotect(first_page, length, PROT_READ | PROT_WRITE)) {
+            LOG_ERR("Could not make the JIT buffer writable");
+            return false;
+        }
+
+        memcpy(m_buffer + m_used, code.data(), code.size());
+
+        if (mprotect(first_page, length, PROT_READ | PROT_EXEC)) {
+            LOG_ERR("Could not make the JIT buffer executable");
+            return false;
+        }
+
+        block.native = reinterpret_cast<ARMNativeCode>(m_buffer + m_used);
+        block.n_native = count;
+
+        // Keep every entry point 16 byte aligned.
+        m_used = (m_used + code.size() + 15) & ~static_cast<size_t>(15);
+
+        LOG_DEBUG("Translated %zu of %zu instructions at 0x%.8x into %zu bytes", count, block.instructions.size(),
+            block.address, code.size());
+
+        return true;
+    }
+#else
+    ARMJIT::ARMJIT(size_t size) {
+        LOG_DEBUG("The JIT needs an x86-64 host, falling back to the interpreter");
+    }
+
+    ARMJIT::~ARMJIT() {
+    }
+
+    bool ARMJIT::translate(ARMBasicBlock &block) {
+        block.native = nullptr;
+        block.n_native = 0;
+        block.native_epoch = m_epoch;
+        return false;
+    }
+#endif
+}
@@ -0,0 +1,70 @@
+/*
+ * ARMJIT.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_LIBEMULATION_ARM_ARMJIT_H_
+#define SRC_LIBEMULATION_ARM_ARMJIT_H_
+
+#include "arm/ARMBlockCache.h"
+#include "arm/ARMContext.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Emulator {
+	// State shared between the emulator and the native code of a block.
+	struct ARMJITFrame {
+		ARMContext *context;
+		ARMBlockCache *cache;
+
+		// Generation of the block cache when the native code was entered. A store that drops
+		// a block makes the native code return to the emulator.
+		size_t generation;
+	};
+
+	// Compiles hot ARM basic blocks to x86-64. Only the common unconditional integer subset
+	// is translated: data processing with immediate or immediate shifted register operands,
+	// word and byte loads and stores with an immediate offset and direct branches. A block is
+	// translated up to its first unsupported instruction and the interpreter runs the rest.
+	//
+	// Native code lives in a single buffer that is never writable and executable at the same
+	// time: the pages a translation is copied to are writable only while it is copied. When it
+	// fills up the whole buffer is dropped at once, made writable again and the epoch is
+	// incremented, which invalidates every translation.
+	class ARMJIT {
+	public:
+		static constexpr size_t BUFFER_SIZE = 16 * 1024 * 1024;
+
+		ARMJIT(size_t size = BUFFER_SIZE);
+		~ARMJIT();
+
+		// False if the host is not x86-64 or the code buffer could not be allocated.
+		bool available() const {
+			return m_buffer != nullptr;
+		}
+
+		// Translate the longest supported prefix of 'block'. Returns false if not even the
+		// first instruction could be translated.
+		bool translate(ARMBasicBlock &block);
+
+		size_t epoch() const {
+			return m_epoch;
+		}
+
+		size_t used() const {
+			return m_used;
+		}
+
+	private:
+		uint8_t *m_buffer = nullptr;
+		size_t m_size = 0;
+		size_t m_used = 0;
+		size_t m_epoch = 1;
+		size_t m_page_size = 0;
+	};
+}
+
+#endif /* SRC_LIBEMULATION_ARM_ARMJIT_H_ */
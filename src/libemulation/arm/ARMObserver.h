@@ -0,0 +1,101 @@
+/*
+ * ARMObserver.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_LIBEMULATION_ARM_ARMOBSERVER_H_
+#define SRC_LIBEMULATION_ARM_ARMOBSERVER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+class ARMContext;
+
+namespace Disassembler {
+	class ARMInstruction;
+}
+
+namespace Emulator {
+	struct ARMBasicBlock;
+
+	// Interface for tools that want to follow the execution: tracers, coverage, profilers.
+	// Every callback defaults to doing nothing so observers only override what they need.
+	class ARMObserver {
+	public:
+		virtual ~ARMObserver() = default;
+
+		// A block is about to run, from its first instruction.
+		virtual void onBlockEntry(const ARMContext &context, const ARMBasicBlock &block) {
+		}
+
+		virtual void onPreInstruction(const ARMContext &context, const Disassembler::ARMInstruction &ins) {
+		}
+
+		virtual void onPostInstruction(const ARMContext &context, const Disassembler::ARMInstruction &ins) {
+		}
+
+		// Data accesses done by instructions, as they reach the memory. The value holds the whole
+		// access, up to the 8 bytes of an LDRD, STRD or VLDR.
+		virtual void onMemoryRead(uintptr_t address, unsigned size, uint64_t value) {
+		}
+
+		virtual void onMemoryWrite(uintptr_t address, unsigned size, uint64_t value) {
+		}
+	};
+
+	// Forwards every event to a list of observers.
+	class ARMObserverList: public ARMObserver {
+	public:
+		void add(ARMObserver *observer) {
+			if (std::find(m_observers.begin(), m_observers.end(), observer) == m_observers.end()) {
+				m_observers.push_back(observer);
+			}
+		}
+
+		void remove(ARMObserver *observer) {
+			m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+		}
+
+		bool empty() const {
+			return m_observers.empty();
+		}
+
+		void onBlockEntry(const ARMContext &context, const ARMBasicBlock &block) override {
+			for (auto observer : m_observers) {
+				observer->onBlockEntry(context, block);
+			}
+		}
+
+		void onPreInstruction(const ARMContext &context, const Disassembler::ARMInstruction &ins) override {
+			for (auto observer : m_observers) {
+				observer->onPreInstruction(context, ins);
+			}
+		}
+
+		void onPostInstruction(const ARMContext &context, const Disassembler::ARMInstruction &ins) override {
+			for (auto observer : m_observers) {
+				observer->onPostInstruction(context, ins);
+			}
+		}
+
+		void onMemoryRead(uintptr_t address, unsigned size, uint64_t value) override {
+			for (auto observer : m_observers) {
+				observer->onMemoryRead(address, size, value);
+			}
+		}
+
+		void onMemoryWrite(uintptr_t address, unsigned size, uint64_t value) override {
+			for (auto observer : m_observers) {
+				observer->onMemoryWrite(address, size, value);
+			}
+		}
+
+	private:
+		std::vector<ARMObserver *> m_observers;
+	};
+}
+
+#endif /* SRC_LIBEMULATION_ARM_ARMOBSERVER_H_ */
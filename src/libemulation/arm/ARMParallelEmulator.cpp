@@ -0,0 +1,153 @@
+/*
+ * ARMParallelEmulator.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#include "ARMParallelEmulator.h"
+#include "debug.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <unistd.h>
+
+using namespace std;
+using namespace Memory;
+
+namespace Emulator {
+    static size_t RoundUpToPage(size_t size) {
+        return (size + PAGE_MASK) & ~static_cast<size_t>(PAGE_MASK);
+    }
+
+    ARMParallelEmulator::ARMParallelEmulator(unsigned n_threads, ARMMode mode, ARMVariants variant) :
+        m_pool(n_threads), m_mode(mode), m_variant(variant) {
+    }
+
+    ARMParallelEmulator::~ARMParallelEmulator() {
+        // The instances unmap their copies of the image before the file goes away.
+        m_instances.clear();
+
+        if (m_image_fd >= 0) {
+            close(m_image_fd);
+        }
+    }
+
+    bool ARMParallelEmulator::addImage(uintptr_t address, const void *data, size_t size, unsigned prot,
+            size_t memory_size) {
+        if (!m_instances.empty()) {
+            LOG_ERR("Cannot add to the image once the instances are created");
+            return false;
+        }
+
+        if (!PAGE_ALIGNED(address)) {
+            LOG_ERR("Cannot add a non page aligned range at 0x%.8lx to the image", address);
+            return false;
+        }
+
+        if (m_image_fd < 0) {
+            char path[] = "/tmp/retools-image-XXXXXX";
+            m_image_fd = mkstemp(path);
+            if (m_image_fd < 0) {
+                LOG_ERR("Could not create the image file");
+                return false;
+            }
+
+            // The file lives as long as the descriptor and the mappings.
+            unlink(path);
+        }
+
+        memory_size = RoundUpToPage(max(size, memory_size));
+        if (!memory_size) {
+            LOG_ERR("Cannot add an empty range to the image");
+            return false;
+        }
+
+        // The file is extended with zeros first, only the initialized bytes are written.
+        if (ftruncate(m_image_fd, m_image_size + memory_size) != 0) {
+            LOG_ERR("Could not grow the image file");
+            return false;
+        }
+
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        for (size_t done = 0; done < size; ) {
+            ssize_t ret = pwrite(m_image_fd, bytes + done, size - done, m_image_size + done);
+            if (ret <= 0) {
+                LOG_ERR("Could not write the image file");
+                return false;
+            }
+
+            done += ret;
+        }
+
+        m_image.push_back({ address, memory_size, prot, m_image_size });
+        m_image_size += memory_size;
+        return true;
+    }
+
+    bool ARMParallelEmulator::addImage(const AbstractBinary &binary) {
+        if (!m_instances.empty()) {
+            LOG_ERR("Cannot add to the image once the instances are created");
+            return false;
+        }
+
+        m_binaries.emplace_back(new BinaryLoader(binary));
+        return true;
+    }
+
+    bool ARMParallelEmulator::initialize(const Setup &setup) {
+        if (!m_instances.empty()) {
+            return true;
+        }
+
+        m_instances.resize(m_pool.size());
+        for (auto &instance : m_instances) {
+            instance.memory.reset(new ConcreteMemory());
+            for (const auto &range : m_image) {
+                if (!instance.memory->map(range.address, range.size, range.prot, m_image_fd, range.offset)) {
+                    LOG_ERR("Could not map the image at 0x%.8lx", range.address);
+                    m_instances.clear();
+                    return false;
+                }
+            }
+
+            for (const auto &loader : m_binaries) {
+                if (!loader->load(*instance.memory)) {
+                    m_instances.clear();
+                    return false;
+                }
+            }
+
+            instance.context.reset(new ARMContext(instance.memory.get()));
+            instance.context->SelectInstrSet(m_mode);
+            instance.emulator.reset(new ARMEmulator(instance.context.get(), instance.memory.get(), m_mode, m_variant));
+
+            if (setup && !setup(*instance.emulator, *instance.memory)) {
+                LOG_ERR("Failed to set up an emulator instance");
+                m_instances.clear();
+                return false;
+            }
+
+            if (!instance.emulator->snapshot()) {
+                m_instances.clear();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ARMParallelEmulator::run(size_t n_tasks, const Task &body) {
+        if (!initialize()) {
+            return false;
+        }
+
+        m_pool.run(n_tasks, [&](size_t task, unsigned worker) {
+            Instance &instance = m_instances[worker];
+            body(task, *instance.emulator, *instance.memory);
+            instance.emulator->restore();
+        });
+
+        return true;
+    }
+}
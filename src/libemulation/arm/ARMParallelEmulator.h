@@ -0,0 +1,95 @@
+/*
+ * ARMParallelEmulator.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_LIBEMULATION_ARM_ARMPARALLELEMULATOR_H_
+#define SRC_LIBEMULATION_ARM_ARMPARALLELEMULATOR_H_
+
+#include "arm/ARMArch.h"
+#include "arm/ARMContext.h"
+#include "arm/ARMEmulator.h"
+#include "memory/BinaryLoader.h"
+#include "memory/Memory.h"
+#include "ThreadPool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+class AbstractBinary;
+
+namespace Emulator {
+	// Runs many independent emulations across a thread pool. Every worker owns one instance,
+	// an ARMEmulator with its own ARMContext and ConcreteMemory, and runs its tasks one after
+	// the other on it, restoring the instance to its clean state between tasks.
+	//
+	// The image, code and data added with addImage(), is written once to a temporary file that
+	// every instance maps privately, binaries are mapped from their own file. Pages an instance
+	// never writes are shared by all of them.
+	class ARMParallelEmulator {
+	public:
+		// Prepares an instance once its image is mapped, for example mapping a stack. The state
+		// left by it is the clean state of the instance.
+		using Setup = std::function<bool(ARMEmulator &emulator, Memory::ConcreteMemory &memory)>;
+
+		// Body of a task, receives the task index and the instance of the worker running it.
+		using Task = std::function<void(size_t task, ARMEmulator &emulator, Memory::ConcreteMemory &memory)>;
+
+		ARMParallelEmulator(unsigned n_threads = 0, ARMMode mode = ARMMode_ARM, ARMVariants variant = ARMv7);
+		~ARMParallelEmulator();
+
+		ARMParallelEmulator(const ARMParallelEmulator &) = delete;
+		ARMParallelEmulator &operator=(const ARMParallelEmulator &) = delete;
+
+		// Add 'size' bytes of 'data' at the page aligned 'address', followed by zeros up to
+		// 'memory_size' if it is larger. Must be called before initialize().
+		bool addImage(uintptr_t address, const void *data, size_t size, unsigned prot, size_t memory_size = 0);
+
+		// Add every segment of a loaded binary. They are mapped from the file of the binary, so
+		// the instances share them with every other process that maps it.
+		bool addImage(const AbstractBinary &binary);
+
+		// Create the instances, mapping the image and running 'setup' on each of them.
+		bool initialize(const Setup &setup = nullptr);
+
+		// Run 'body' for every task in [0, n_tasks) and wait for all of them to finish.
+		bool run(size_t n_tasks, const Task &body);
+
+		unsigned size() const {
+			return m_pool.size();
+		}
+
+	private:
+		struct ImageRange {
+			uintptr_t address;
+			size_t size;
+			unsigned prot;
+			off_t offset;
+		};
+
+		struct Instance {
+			std::unique_ptr<Memory::ConcreteMemory> memory;
+			std::unique_ptr<ARMContext> context;
+			std::unique_ptr<ARMEmulator> emulator;
+		};
+
+		ThreadPool m_pool;
+		ARMMode m_mode;
+		ARMVariants m_variant;
+
+		// Temporary file with the contents of the image.
+		int m_image_fd = -1;
+		off_t m_image_size = 0;
+		std::vector<ImageRange> m_image;
+		std::vector<std::unique_ptr<Memory::BinaryLoader>> m_binaries;
+
+		std::vector<Instance> m_instances;
+	};
+}
+
+#endif /* SRC_LIBEMULATION_ARM_ARMPARALLELEMULATOR_H_ */
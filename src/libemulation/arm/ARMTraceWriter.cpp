@@ -0,0 +1,127 @@
+/*
+ * ARMTraceWriter.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#include "ARMTraceWriter.h"
+#include "arm/ARMBlockCache.h"
+#include "arm/ARMContext.h"
+#include "debug.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace Disassembler;
+
+namespace Emulator {
+    ARMTraceWriter::~ARMTraceWriter() {
+        close();
+    }
+
+    bool ARMTraceWriter::open(const string &path) {
+        close();
+
+        m_file = fopen(path.c_str(), "wb");
+        if (!m_file) {
+            LOG_ERR("Could not open trace file '%s'", path.c_str());
+            return false;
+        }
+
+        m_buffer.reserve(BUFFER_SIZE + 128);
+        m_have_last = false;
+
+        for (char c : string("ARMTRACE")) {
+            put8(c);
+        }
+
+        put32(VERSION);
+        return true;
+    }
+
+    void ARMTraceWriter::close() {
+        if (!m_file) {
+            return;
+        }
+
+        flush();
+        fclose(m_file);
+        m_file = nullptr;
+    }
+
+    void ARMTraceWriter::flush() {
+        if (m_file && !m_buffer.empty() && fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) != m_buffer.size()) {
+            LOG_ERR("Could not write to the trace file");
+        }
+
+        m_buffer.clear();
+    }
+
+    void ARMTraceWriter::onBlockEntry(const ARMContext &context, const ARMBasicBlock &block) {
+        if (!m_file) {
+            return;
+        }
+
+        put8(TAG_BLOCK);
+        put32(block.address);
+        put8(block.mode);
+        flushIfFull();
+    }
+
+    void ARMTraceWriter::onPostInstruction(const ARMContext &context, const ARMInstruction &ins) {
+        if (!m_file) {
+            return;
+        }
+
+        array<uint32_t, 17> current;
+        auto registers = context.getCoreRegisters();
+        copy(registers.begin(), registers.end(), current.begin());
+        current[16] = context.CPSR;
+
+        uint32_t mask = 0;
+        for (unsigned i = 0; i < current.size(); i++) {
+            if (!m_have_last || current[i] != m_last[i]) {
+                mask |= 1 << i;
+            }
+        }
+
+        put8(TAG_STEP);
+        put32(ins.address);
+        put32(ins.opcode);
+        put32(mask);
+        for (unsigned i = 0; i < current.size(); i++) {
+            if (mask & (1 << i)) {
+                put32(current[i]);
+            }
+        }
+
+        m_last = current;
+        m_have_last = true;
+        flushIfFull();
+    }
+
+    void ARMTraceWriter::onMemoryRead(uintptr_t address, unsigned size, uint64_t value) {
+        if (!m_file) {
+            return;
+        }
+
+        put8(TAG_READ);
+        put32(address);
+        put8(size);
+        put64(value);
+        flushIfFull();
+    }
+
+    void ARMTraceWriter::onMemoryWrite(uintptr_t address, unsigned size, uint64_t value) {
+        if (!m_file) {
+            return;
+        }
+
+        put8(TAG_WRITE);
+        put32(address);
+        put8(size);
+        put64(value);
+        flushIfFull();
+    }
+}
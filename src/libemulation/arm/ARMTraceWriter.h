@@ -0,0 +1,87 @@
+/*
+ * ARMTraceWriter.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_LIBEMULATION_ARM_ARMTRACEWRITER_H_
+#define SRC_LIBEMULATION_ARM_ARMTRACEWRITER_H_
+
+#include "arm/ARMObserver.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace Emulator {
+	// Observer that writes a compact binary trace of the execution. All values are little
+	// endian. The file starts with the magic "ARMTRACE" and a 32 bit version, followed by
+	// records that start with a one byte tag:
+	//
+	//   TAG_BLOCK: u32 address, u8 mode
+	//   TAG_STEP:  u32 address, u32 opcode, u32 mask, then one u32 per bit set in mask.
+	//              Bits 0-15 are the core registers that changed, bit 16 is the CPSR. The
+	//              first step of a trace has every bit set.
+	//   TAG_READ:  u32 address, u8 size, u64 value
+	//   TAG_WRITE: u32 address, u8 size, u64 value
+	class ARMTraceWriter: public ARMObserver {
+	public:
+		static constexpr uint32_t VERSION = 2;
+
+		enum Tag : uint8_t {
+			TAG_BLOCK = 1,
+			TAG_STEP = 2,
+			TAG_READ = 3,
+			TAG_WRITE = 4
+		};
+
+		ARMTraceWriter() = default;
+		~ARMTraceWriter();
+
+		bool open(const std::string &path);
+		void close();
+
+		void onBlockEntry(const ARMContext &context, const ARMBasicBlock &block) override;
+		void onPostInstruction(const ARMContext &context, const Disassembler::ARMInstruction &ins) override;
+		void onMemoryRead(uintptr_t address, unsigned size, uint64_t value) override;
+		void onMemoryWrite(uintptr_t address, unsigned size, uint64_t value) override;
+
+	private:
+		static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+		void put8(uint8_t value) {
+			m_buffer.push_back(value);
+		}
+
+		void put32(uint32_t value) {
+			for (unsigned i = 0; i < 4; i++) {
+				m_buffer.push_back(value >> (i * 8));
+			}
+		}
+
+		void put64(uint64_t value) {
+			put32(value);
+			put32(value >> 32);
+		}
+
+		void flushIfFull() {
+			if (m_buffer.size() >= BUFFER_SIZE) {
+				flush();
+			}
+		}
+
+		void flush();
+
+		FILE *m_file = nullptr;
+		std::vector<uint8_t> m_buffer;
+
+		// Registers as of the last step, only the differences are written.
+		std::array<uint32_t, 17> m_last;
+		bool m_have_last = false;
+	};
+}
+
+#endif /* SRC_LIBEMULATION_ARM_ARMTRACEWRITER_H_ */
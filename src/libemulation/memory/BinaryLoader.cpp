@@ -0,0 +1,119 @@
+/*
+ * BinaryLoader.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#include "BinaryLoader.h"
+#include "AbstractBinary.h"
+#include "abstract/Segment.h"
+#include "debug.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace Memory {
+    BinaryLoader::BinaryLoader(const AbstractBinary &binary) {
+        if (!binary.getFilePath().empty()) {
+            m_fd = open(binary.getFilePath().c_str(), O_RDONLY);
+            if (m_fd < 0) {
+                LOG_ERR("Could not open file '%s', the segments will be copied", binary.getFilePath().c_str());
+            }
+        }
+
+        for (const auto &segment : binary.getSegments()) {
+            // Skip reservations like __PAGEZERO.
+            if (!segment.getPermission() || !segment.getInMemorySize()) {
+                continue;
+            }
+
+            Range range;
+            range.address = segment.getAddress();
+            range.size = segment.getInMemorySize();
+
+            // Segment permissions use the same bits as PROT_READ, PROT_WRITE and PROT_EXEC.
+            range.prot = segment.getPermission();
+
+            size_t size = segment.getData() ? min<uint64_t>(segment.getSize(), segment.getInFileSize()) : 0;
+            size = min(size, range.size);
+            off_t offset = binary.getFileOffset() + segment.getOffset();
+
+            // Only whole pages of the file can be mapped, the rest of the last one is copied.
+            range.file_size = 0;
+            range.file_offset = offset;
+            if (m_fd >= 0 && PAGE_ALIGNED(range.address) && PAGE_ALIGNED(offset)) {
+                range.file_size = size & ~static_cast<size_t>(PAGE_MASK);
+            }
+
+            range.data.assign(segment.getData() + range.file_size, segment.getData() + size);
+            m_ranges.push_back(move(range));
+        }
+    }
+
+    BinaryLoader::~BinaryLoader() {
+        if (m_fd >= 0) {
+            close(m_fd);
+        }
+    }
+
+    bool BinaryLoader::load(AbstractMemory &memory) const {
+        auto concrete = dynamic_cast<ConcreteMemory *>(&memory);
+        for (const auto &range : m_ranges) {
+            bool loaded = concrete && range.file_size ? loadConcrete(*concrete, range) :
+                loadCopy(memory, range, 0);
+
+            if (!loaded) {
+                LOG_ERR("Could not load the segment at 0x%.8lx", range.address);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool BinaryLoader::loadConcrete(ConcreteMemory &memory, const Range &range) const {
+        if (!memory.map(range.address, range.file_size, range.prot, m_fd, range.file_offset)) {
+            return false;
+        }
+
+        // The partial page and the zero fill go to anonymous memory.
+        if (range.size > range.file_size) {
+            return loadCopy(memory, range, range.file_size);
+        }
+
+        return true;
+    }
+
+    bool BinaryLoader::loadCopy(AbstractMemory &memory, const Range &range, size_t skip) const {
+        uintptr_t address = range.address + skip;
+        size_t size = range.size - skip;
+
+        // Writable until the contents are in place.
+        if (!memory.map(address, size, PROT_READ | PROT_WRITE)) {
+            return false;
+        }
+
+        // The part that would have been mapped is read from the file.
+        vector<uint8_t> buffer;
+        for (size_t done = skip; done < range.file_size; ) {
+            buffer.resize(min<size_t>(range.file_size - done, 1 << 20));
+            ssize_t ret = pread(m_fd, buffer.data(), buffer.size(), range.file_offset + done);
+            if (ret <= 0 || memory.write(range.address + done, buffer.data(), ret) != static_cast<size_t>(ret)) {
+                return false;
+            }
+
+            done += ret;
+        }
+
+        address = range.address + max(skip, range.file_size);
+        if (memory.write(address, range.data.data(), range.data.size()) != range.data.size()) {
+            return false;
+        }
+
+        return range.prot == (PROT_READ | PROT_WRITE) || memory.protect(range.address + skip, size, range.prot);
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * BinaryLoader.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_LIBEMULATION_MEMORY_BINARYLOADER_H_
+#define SRC_LIBEMULATION_MEMORY_BINARYLOADER_H_
+
+#include "memory/Memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class AbstractBinary;
+
+namespace Memory {
+	// Loads the segments of a binary at their addresses. With a ConcreteMemory the contents are
+	// not copied, every segment is mapped privately from the file the binary was loaded from,
+	// so loading is as fast as creating the mappings and every memory loaded from the same file
+	// shares its page cache. The memory past the size of a segment in the file is zero filled.
+	//
+	// Other memories, and binaries that do not come from a file, get their contents copied.
+	// The loader does not reference the binary, it can be unloaded once the loader is created.
+	class BinaryLoader {
+	public:
+		explicit BinaryLoader(const AbstractBinary &binary);
+		~BinaryLoader();
+
+		BinaryLoader(const BinaryLoader &) = delete;
+		BinaryLoader &operator=(const BinaryLoader &) = delete;
+
+		bool load(AbstractMemory &memory) const;
+
+	private:
+		struct Range {
+			uintptr_t address;
+			size_t size;
+			unsigned prot;
+
+			// Part of the range mapped from the file, page aligned, and its file offset.
+			size_t file_size;
+			off_t file_offset;
+
+			// Contents after the mapped part, a partial page when copying is avoided.
+			std::vector<uint8_t> data;
+		};
+
+		bool loadConcrete(ConcreteMemory &memory, const Range &range) const;
+		// Map and copy the range starting 'skip' bytes into it.
+		bool loadCopy(AbstractMemory &memory, const Range &range, size_t skip) const;
+
+		int m_fd = -1;
+		std::vector<Range> m_ranges;
+	};
+}
+
+#endif /* SRC_LIBEMULATION_MEMORY_BINARYLOADER_H_ */
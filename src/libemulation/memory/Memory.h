@@ -1,22 +1,51 @@
 #ifndef SRC_LIBEMULATION_MEMORY_MEMORY_H_
 #define SRC_LIBEMULATION_MEMORY_MEMORY_H_
 
-#include <list>
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <sys/mman.h>
 
 #include "debug.h"
+#include "Utilities.h"
 
-#define PAGE_SIZE 0x1000
+#define PAGE_SHIFT 12
+#define PAGE_SIZE (1 << PAGE_SHIFT)
 #define PAGE_MASK (PAGE_SIZE - 1)
 #define PAGE_ALIGNED(x) (((x) & PAGE_MASK) == 0)
-#define PAGE_ALIGN(x) (((x) + PAGE_SIZE - 1) & PAGE_MASK)
+#define PAGE_ALIGN(x) (((x) + PAGE_SIZE - 1) & ~static_cast<uintptr_t>(PAGE_MASK))
 
 namespace Memory {
 
+	// Kind of a CPU access, the bits are the protection that allows it.
+	enum Access {
+		Access_Read = PROT_READ,
+		Access_Write = PROT_WRITE,
+		Access_Execute = PROT_EXEC
+	};
+
+	enum FaultReason {
+		FaultReason_None,
+		FaultReason_Unmapped,
+		FaultReason_Protection
+	};
+
+	// Why a CPU access failed.
+	struct Fault {
+		FaultReason reason = FaultReason_None;
+		Access access = Access_Read;
+
+		// First byte of the access that could not be done, and the size of the whole access.
+		uintptr_t address = 0;
+		size_t size = 0;
+	};
+
 	struct Segment {
 		Segment() = default;
 
@@ -35,13 +64,12 @@ namespace Memory {
 
 		// Checks if the segment contains the whole range.
 		bool contains(uintptr_t address, size_t size) const {
-			return contains(address) && contains(address + size);
+			return contains(address) && size <= m_end - address;
 		}
 
 		// Check if the address range overlaps with the segment.
 		bool overlaps(uintptr_t address, size_t size) const {
-			return contains(address) || contains(address + size)
-					|| contains(address, size);
+			return address < m_end && m_start < address + size;
 		}
 
 		void *pointer(uintptr_t address) {
@@ -49,74 +77,273 @@ namespace Memory {
 			return reinterpret_cast<void *>(tmp);
 		}
 
-		void *m_data;
-		uintptr_t m_start;
-		uintptr_t m_end;
-		size_t m_size;
-		unsigned m_prot;
+		void *m_data = nullptr;
+		uintptr_t m_start = 0;
+		uintptr_t m_end = 0;
+		size_t m_size = 0;
+		unsigned m_prot = 0;
 	};
 
+	// Address ordered, non overlapping segments in a vector, looked up with a binary search.
+	// Every segment owns its own range of host memory, so splitting one only means unmapping
+	// or relabeling part of it, and neighbours that are contiguous in both the guest and the
+	// host with the same protection are merged back.
 	class SegmentManager {
 	private:
-		std::list<Segment> m_segments;
-		Segment m_lru_seg;
+		std::vector<Segment> m_segments;
+
+		// Direct mapped software TLB indexed by a hash of the guest page number. Each
+		// entry holds the value that added to a guest address of the page gives its host
+		// address, and the protection of the page. Any change to the mappings flushes it.
+		struct TLBEntry {
+			uintptr_t page = UINTPTR_MAX;
+			uintptr_t addend = 0;
+			unsigned prot = 0;
+		};
+
+		static constexpr size_t TLB_ENTRIES = 256;
+		std::array<TLBEntry, TLB_ENTRIES> m_tlb;
+
+		// Folding in the megabyte number keeps regions placed at round addresses, like a stack
+		// at 0x100000 and a heap at 0x200000, from sharing their entries.
+		static size_t index(uintptr_t page) {
+			return (page ^ (page >> 8)) & (TLB_ENTRIES - 1);
+		}
+
+		// Pages whose writes must not take the fast path, see setWriteTracked().
+		std::unordered_set<uintptr_t> m_tracked_pages;
+
+		// While clean pages are tracked only the pages marked written take the fast write path,
+		// see trackCleanPages().
+		bool m_track_clean = false;
+		std::unordered_set<uintptr_t> m_written_pages;
+
+		uint8_t *refill(uintptr_t address, unsigned access) {
+			const Segment *segment = find(address);
+			if (!segment) {
+				return nullptr;
+			}
+
+			TLBEntry &entry = m_tlb[index(address >> PAGE_SHIFT)];
+			entry.page = address >> PAGE_SHIFT;
+			entry.addend = reinterpret_cast<uintptr_t>(segment->m_data) - segment->m_start;
+			entry.prot = segment->m_prot;
+			if ((!m_tracked_pages.empty() && m_tracked_pages.count(entry.page))
+					|| (m_track_clean && !m_written_pages.count(entry.page))) {
+				entry.prot &= ~PROT_WRITE;
+			}
+
+			return entry.prot & access ? reinterpret_cast<uint8_t *>(entry.addend + address) : nullptr;
+		}
+
+		void flush() {
+			m_tlb.fill(TLBEntry());
+		}
+
+		void invalidate(uintptr_t page) {
+			TLBEntry &entry = m_tlb[index(page)];
+			if (entry.page == page) {
+				entry = TLBEntry();
+			}
+		}
+
+		// First segment that ends after 'address'.
+		std::vector<Segment>::iterator firstEndingAfter(uintptr_t address) {
+			return std::upper_bound(m_segments.begin(), m_segments.end(), address,
+				[] (uintptr_t value, const Segment &segment) {
+					return value < segment.m_end;
+				});
+		}
+
+		// Make 'address' a segment boundary, splitting the segment that contains it.
+		void split(uintptr_t address) {
+			auto it = firstEndingAfter(address);
+			if (it == m_segments.end() || it->m_start >= address) {
+				return;
+			}
+
+			Segment tail { address, it->m_end - address, it->m_prot, it->pointer(address) };
+			it->m_end = address;
+			it->m_size = address - it->m_start;
+			m_segments.insert(it + 1, tail);
+		}
+
+		// Merge the neighbours of the segments in [first, last] that are contiguous in both the
+		// guest and the host and have the same protection.
+		void merge(size_t first, size_t last) {
+			first = first ? first - 1 : 0;
+			last = std::min(last + 1, m_segments.size() - 1);
+
+			for (size_t i = last; i > first; i--) {
+				Segment &left = m_segments[i - 1];
+				const Segment &right = m_segments[i];
+				if (left.m_end == right.m_start && left.m_prot == right.m_prot
+						&& left.pointer(left.m_end) == right.m_data) {
+					left.m_end = right.m_end;
+					left.m_size += right.m_size;
+					m_segments.erase(m_segments.begin() + i);
+				}
+			}
+		}
 
 	public:
-		bool overlaps(unsigned address, size_t size) const {
-			bool ret = false;
+		SegmentManager() = default;
+
+		// The host memory of the segments is owned by the manager.
+		~SegmentManager() {
 			for (const auto &segment : m_segments) {
-				if (segment.overlaps(address, size)) {
-					ret = true;
-					break;
-				}
+				munmap(segment.m_data, segment.m_size);
 			}
+		}
+
+		SegmentManager(const SegmentManager &) = delete;
+		SegmentManager &operator=(const SegmentManager &) = delete;
 
-			return ret;
+		bool overlaps(uintptr_t address, size_t size) const {
+			auto it = std::upper_bound(m_segments.begin(), m_segments.end(), address,
+				[] (uintptr_t value, const Segment &segment) {
+					return value < segment.m_end;
+				});
+
+			return it != m_segments.end() && it->overlaps(address, size);
 		}
 
+		// Unmap the range, parts of it that are not mapped are ignored.
 		bool removeSegment(uintptr_t address, size_t size) {
-			// TODO: Implement.
+			split(address);
+			split(address + size);
+
+			auto first = firstEndingAfter(address);
+			auto last = first;
+			while (last != m_segments.end() && last->m_start < address + size) {
+				munmap(last->m_data, last->m_size);
+				++last;
+			}
+
+			m_segments.erase(first, last);
+
+			// A page mapped again is clean.
+			for (auto it = m_written_pages.begin(); it != m_written_pages.end(); ) {
+				if ((*it << PAGE_SHIFT) - address < size) {
+					it = m_written_pages.erase(it);
+				} else {
+					++it;
+				}
+			}
+
+			flush();
 			return true;
 		}
 
+		// Change the protection of the range, which has to be completely mapped.
 		bool protectSegment(uintptr_t address, size_t size, unsigned prot) {
-			// TODO: Implement.
+			uintptr_t end = address + size;
+			for (auto it = firstEndingAfter(address); address < end; ++it) {
+				if (it == m_segments.end() || it->m_start > address) {
+					LOG_ERR("Cannot protect unmapped memory at 0x%.8lx", address);
+					return false;
+				}
+
+				address = it->m_end;
+			}
+
+			address = end - size;
+			split(address);
+			split(end);
+
+			size_t first = firstEndingAfter(address) - m_segments.begin();
+			size_t last = first;
+			for (; last < m_segments.size() && m_segments[last].m_start < end; last++) {
+				m_segments[last].m_prot = prot;
+			}
+
+			merge(first, last - 1);
+			flush();
 			return true;
 		}
 
-		bool addSegment(uintptr_t address, size_t size, unsigned prot) {
-			prot = PROT_READ | PROT_WRITE;
-			void *data = mmap(nullptr, size, prot, MAP_ANON | MAP_PRIVATE, 0, 0);
+		// Backed by anonymous memory or, if 'fd' is valid, by a private copy-on-write mapping
+		// of the file at 'offset'. The host memory is always readable and writable, 'prot' is
+		// the protection seen by the guest.
+		bool addSegment(uintptr_t address, size_t size, unsigned prot, int fd = -1, off_t offset = 0) {
+			void *data = fd < 0 ?
+				mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0) :
+				mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, offset);
 			if (data == MAP_FAILED) {
 				LOG_ERR("Failed allocate memory with mmap");
 				return false;
 			}
 
-			Segment segment { address, size, prot, data };
-			m_segments.push_back(segment);
+			auto it = firstEndingAfter(address);
+			size_t position = m_segments.insert(it, Segment { address, size, prot, data }) - m_segments.begin();
+			merge(position, position);
+			flush();
 
 			return true;
 		}
 
-		bool getSegment(uintptr_t address, Segment &segment) {
-			if (m_lru_seg.contains(address)) {
-				segment = m_lru_seg;
-				return true;
+		// Host address of the guest 'address', nullptr if it is not mapped or its protection
+		// does not allow 'access'. The host memory is contiguous up to the end of the guest page.
+		uint8_t *translate(uintptr_t address, unsigned access) {
+			const TLBEntry &entry = m_tlb[index(address >> PAGE_SHIFT)];
+			if (likely(entry.page == address >> PAGE_SHIFT && (entry.prot & access))) {
+				return reinterpret_cast<uint8_t *>(entry.addend + address);
+			}
+
+			return refill(address, access);
+		}
+
+		// Writes to a tracked page miss the TLB, so the slow path can see them. The protection
+		// of the page does not change.
+		void setWriteTracked(uintptr_t page, bool tracked) {
+			if (tracked) {
+				m_tracked_pages.insert(page >> PAGE_SHIFT);
+			} else {
+				m_tracked_pages.erase(page >> PAGE_SHIFT);
 			}
 
-			auto it = std::find_if(m_segments.begin(), m_segments.end(),
-					[=] (const Segment &el) {
-						return el.contains(address);
-					});
+			invalidate(page >> PAGE_SHIFT);
+		}
 
-			if (it == m_segments.end()) {
+		// While enabled, the first write to every page misses the TLB until the page is marked
+		// written, so only that write pays for noticing it. Calling it again makes every page
+		// clean.
+		void trackCleanPages(bool track) {
+			m_track_clean = track;
+			m_written_pages.clear();
+			flush();
+		}
+
+		void setWritten(uintptr_t page) {
+			if (m_track_clean && m_written_pages.insert(page >> PAGE_SHIFT).second) {
+				invalidate(page >> PAGE_SHIFT);
+			}
+		}
+
+		// Segment that contains 'address', nullptr if there is none. Invalidated by any change
+		// to the mappings.
+		const Segment *find(uintptr_t address) const {
+			auto it = std::upper_bound(m_segments.begin(), m_segments.end(), address,
+				[] (uintptr_t value, const Segment &segment) {
+					return value < segment.m_end;
+				});
+
+			return it != m_segments.end() && it->contains(address) ? &*it : nullptr;
+		}
+
+		bool getSegment(uintptr_t address, Segment &segment) const {
+			const Segment *found = find(address);
+			if (!found) {
 				return false;
 			}
 
-			segment = *it;
-			m_lru_seg = segment;
+			segment = *found;
 			return true;
 		}
+
+		const std::vector<Segment> &segments() const {
+			return m_segments;
+		}
 	};
 
 	class AbstractMemory {
@@ -131,6 +358,33 @@ namespace Memory {
 		virtual size_t read(uintptr_t address, void *buffer, size_t size) = 0;
 		virtual size_t write(uintptr_t address, const void *buffer, size_t size) = 0;
 
+		// Single accesses of 1, 2, 4 or 8 bytes done by the CPU, little endian. Implementations
+		// can override them with a path that resolves the host memory once. Unlike read() and
+		// write(), which are meant for the host, CPU accesses honor the protection of the
+		// memory and a failed one is described by getFault().
+		virtual bool readSized(uintptr_t address, unsigned size, uint64_t &value) {
+			value = 0;
+			return read(address, &value, size) == size;
+		}
+
+		virtual bool writeSized(uintptr_t address, unsigned size, uint64_t value) {
+			return write(address, &value, size) == size;
+		}
+
+		// Instruction fetch by the CPU, needs execute permission.
+		virtual size_t fetch(uintptr_t address, void *buffer, size_t size) {
+			return read(address, buffer, size);
+		}
+
+		// Last CPU access that failed. Only valid right after the failure.
+		const Fault &getFault() const {
+			return m_last_fault;
+		}
+
+		void clearFault() {
+			m_last_fault = Fault();
+		}
+
 		template<typename T> size_t read_value(uintptr_t address, T &value) {
 			return read(address, reinterpret_cast<void *>(&value), sizeof(T));
 		}
@@ -138,12 +392,177 @@ namespace Memory {
 		template<typename T> size_t write_value(uintptr_t address, const T &value) {
 			return write(address, reinterpret_cast<const void *>(&value), sizeof(T));
 		}
+
+		// Caches of something derived from the memory contents, like decoded instructions, mark
+		// the pages they read as code and subscribe to the writes over them. A listener is only
+		// called with the range of writes that touch a code page, the rest of the writes do not
+		// pay for it.
+		typedef std::function<void(uintptr_t address, size_t size)> CodeWriteListener;
+
+		// Returns the id used to unsubscribe.
+		size_t subscribe(CodeWriteListener listener) {
+			m_code_listeners.emplace_back(++m_last_listener, listener);
+			return m_last_listener;
+		}
+
+		void unsubscribe(size_t id) {
+			m_code_listeners.erase(std::remove_if(m_code_listeners.begin(), m_code_listeners.end(),
+				[id] (const std::pair<size_t, CodeWriteListener> &entry) {
+					return entry.first == id;
+				}), m_code_listeners.end());
+		}
+
+		// Pages are counted, a page stays code until it is unmarked as many times as it was marked.
+		void markCode(uintptr_t address, size_t size) {
+			for (uintptr_t page = address >> PAGE_SHIFT; page <= (address + size - 1) >> PAGE_SHIFT; page++) {
+				if (m_code_pages[page]++ == 0) {
+					codePageChanged(page << PAGE_SHIFT, true);
+				}
+			}
+		}
+
+		void unmarkCode(uintptr_t address, size_t size) {
+			for (uintptr_t page = address >> PAGE_SHIFT; page <= (address + size - 1) >> PAGE_SHIFT; page++) {
+				auto it = m_code_pages.find(page);
+				if (it != m_code_pages.end() && --it->second == 0) {
+					m_code_pages.erase(it);
+					codePageChanged(page << PAGE_SHIFT, false);
+				}
+			}
+		}
+
+		bool containsCode(uintptr_t address, size_t size) const {
+			if (m_code_pages.empty() || !size) {
+				return false;
+			}
+
+			for (uintptr_t page = address >> PAGE_SHIFT; page <= (address + size - 1) >> PAGE_SHIFT; page++) {
+				if (m_code_pages.count(page)) {
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// Incremented by every write that touches a code page.
+		uint64_t getCodeGeneration() const {
+			return m_code_generation;
+		}
+
+		// Save the current contents so restore() can bring them back. Only one snapshot is
+		// kept, taking a new one replaces it. The set of mapped segments is not part of it.
+		virtual bool snapshot() {
+			LOG_ERR("Snapshots are not supported by this memory");
+			return false;
+		}
+
+		virtual bool restore() {
+			LOG_ERR("Snapshots are not supported by this memory");
+			return false;
+		}
+
+	protected:
+		// Called with the range of every write, and of anything else that changes the contents
+		// like an unmap or a restore.
+		void notifyWrite(uintptr_t address, size_t size) {
+			if (likely(!containsCode(address, size))) {
+				return;
+			}
+
+			m_code_generation++;
+
+			// Listeners drop their caches, which may unmark pages and unsubscribe.
+			auto listeners = m_code_listeners;
+			for (const auto &entry : listeners) {
+				entry.second(address, size);
+			}
+		}
+
+		// Lets an implementation with a fast write path send the writes to a page through
+		// notifyWrite() only while the page contains code.
+		virtual void codePageChanged(uintptr_t page, bool code) {
+		}
+
+		void setFault(FaultReason reason, Access access, uintptr_t address, size_t size) {
+			m_last_fault.reason = reason;
+			m_last_fault.access = access;
+			m_last_fault.address = address;
+			m_last_fault.size = size;
+		}
+
+	private:
+		Fault m_last_fault;
+
+		// Number of times each page number was marked as code.
+		std::unordered_map<uintptr_t, unsigned> m_code_pages;
+		uint64_t m_code_generation = 0;
+		std::vector<std::pair<size_t, CodeWriteListener>> m_code_listeners;
+		size_t m_last_listener = 0;
 	};
 
 	class ConcreteMemory: public AbstractMemory {
 	private:
 		SegmentManager m_segments;
 
+		// Copy-on-write snapshot state. The original contents of a page are saved the first
+		// time it is written after the snapshot, and the pages written since the last restore
+		// are listed so restoring only copies those back. Pages not written since then are
+		// write tracked in the TLB, later writes to a page take the fast path.
+		struct SavedPage {
+			std::vector<uint8_t> data;
+			bool dirty = false;
+		};
+
+		bool m_snapshot = false;
+		std::unordered_map<uintptr_t, SavedPage> m_saved_pages;
+		std::vector<uintptr_t> m_dirty_pages;
+
+		// Called before 'size' bytes at 'address' are modified.
+		void trackWrite(uintptr_t address, size_t size) {
+			uintptr_t end = address + size;
+			for (uintptr_t page = address & ~PAGE_MASK; page < end; page += PAGE_SIZE) {
+				SavedPage &saved = m_saved_pages[page];
+				if (saved.dirty) {
+					continue;
+				}
+
+				if (saved.data.empty()) {
+					Segment segment;
+					if (!m_segments.getSegment(page, segment)) {
+						continue;
+					}
+
+					auto data = reinterpret_cast<const uint8_t *>(segment.pointer(page));
+					saved.data.assign(data, data + PAGE_SIZE);
+				}
+
+				saved.dirty = true;
+				m_dirty_pages.push_back(page);
+				m_segments.setWritten(page);
+			}
+		}
+
+		void codePageChanged(uintptr_t page, bool code) override {
+			m_segments.setWriteTracked(page, code);
+		}
+
+		// Check that every byte of a CPU access is mapped with a protection that allows it,
+		// recording the fault otherwise.
+		bool checkAccess(uintptr_t address, size_t size, Access access) {
+			for (uintptr_t current = address; current - address < size; ) {
+				const Segment *segment = m_segments.find(current);
+				if (!segment || !(segment->m_prot & access)) {
+					setFault(segment ? FaultReason_Protection : FaultReason_Unmapped, access, current, size);
+					return false;
+				}
+
+				current = segment->m_end;
+			}
+
+			return true;
+		}
+
 	public:
 		ConcreteMemory() = default;
 		virtual ~ConcreteMemory() = default;
@@ -163,16 +582,46 @@ namespace Memory {
 				size = PAGE_ALIGN(size);
 			}
 
-			return true;
+			return m_segments.protectSegment(address, size, prot);
 		}
 
+		// Parts of the range that are not mapped are ignored, so a range can be unmapped from the
+		// middle of a segment or across several of them.
 		bool unmap(uintptr_t address, size_t size) override {
+			if (!PAGE_ALIGNED(address)) {
+			    LOG_ERR("Cannot unmap a non page aligned segment.");
+				return false;
+			}
+
+			size = PAGE_ALIGN(size);
+			if (!m_segments.removeSegment(address, size)) {
+				return false;
+			}
+
+			// A page mapped again later must not get the contents saved for this one back.
+			m_dirty_pages.erase(std::remove_if(m_dirty_pages.begin(), m_dirty_pages.end(),
+				[&] (uintptr_t page) {
+					return page >= address && page - address < size;
+				}), m_dirty_pages.end());
+
+			for (uintptr_t page = address; page - address < size; page += PAGE_SIZE) {
+				m_saved_pages.erase(page);
+			}
+
+			notifyWrite(address, size);
 			return true;
 		}
 
 		bool map(uintptr_t address, size_t size, unsigned prot) override {
-			LOG_DEBUG("address=0x%.8x size=0x%.8x prot=0x%.8x",
-					address, size, prot);
+			return map(address, size, prot, -1, 0);
+		}
+
+		// Map 'size' bytes of the file 'fd' starting at 'offset'. Writes stay private to this
+		// memory and the pages that are never written are shared with every other mapping of
+		// the file.
+		bool map(uintptr_t address, size_t size, unsigned prot, int fd, off_t offset) {
+			LOG_DEBUG("address=0x%.8x size=0x%.8x prot=0x%.8x fd=%d",
+					address, size, prot, fd);
 
 			if (!size) {
 			    LOG_ERR("Cannot map an empty segment.");
@@ -193,7 +642,7 @@ namespace Memory {
 				return false;
 			}
 
-			if (!m_segments.addSegment(address, size, prot)) {
+			if (!m_segments.addSegment(address, size, prot, fd, offset)) {
 			    LOG_ERR("Cannot map segment.");
 				return false;
 			}
@@ -201,31 +650,163 @@ namespace Memory {
 			return true;
 		}
 
+		// Accesses can span several segments as long as there are no holes between them.
 		size_t read(uintptr_t address, void *buffer, size_t size) override {
 			LOG_DEBUG("address=0x%.8x buffer=%p size=0x%.8x", address, buffer, size);
 
-			Segment segment;
-			if (!m_segments.getSegment(address, segment)) {
-			    LOG_ERR("Failed to read at address 0x%.8x", address);
-				return 0;
+			uint8_t *out = static_cast<uint8_t *>(buffer);
+			for (size_t done = 0; done < size; ) {
+				Segment segment;
+				if (!m_segments.getSegment(address + done, segment)) {
+					LOG_ERR("Failed to read at address 0x%.8x", address + done);
+					return done;
+				}
+
+				size_t chunk = std::min<size_t>(size - done, segment.m_end - (address + done));
+				memcpy(out + done, segment.pointer(address + done), chunk);
+				done += chunk;
 			}
 
-			memcpy(buffer, segment.pointer(address), size);
 			return size;
 		}
 
 		size_t write(uintptr_t address, const void *buffer, size_t size) override {
 			LOG_DEBUG("address=0x%.8x buffer=%p size=0x%.8x", address, buffer, size);
 
-			Segment segment;
-			if (!m_segments.getSegment(address, segment)) {
-			    LOG_ERR("Failed to write at address 0x%.8x", address);
-				return 0;
+			const uint8_t *in = static_cast<const uint8_t *>(buffer);
+			for (size_t done = 0; done < size; ) {
+				Segment segment;
+				if (!m_segments.getSegment(address + done, segment)) {
+					LOG_ERR("Failed to write at address 0x%.8x", address + done);
+					notifyWrite(address, done);
+					return done;
+				}
+
+				size_t chunk = std::min<size_t>(size - done, segment.m_end - (address + done));
+				if (m_snapshot) {
+					trackWrite(address + done, chunk);
+				}
+
+				memcpy(segment.pointer(address + done), in + done, chunk);
+				done += chunk;
 			}
 
-			memcpy(segment.pointer(address), buffer, size);
+			notifyWrite(address, size);
 			return size;
 		}
+
+		// A TLB lookup that also checks the protection and one bounds check, unaligned accesses
+		// included. Accesses that cross a page boundary and faults take the generic path.
+		bool readSized(uintptr_t address, unsigned size, uint64_t &value) override {
+			const uint8_t *data;
+			if (unlikely((address & PAGE_MASK) + size > PAGE_SIZE || !(data = m_segments.translate(address, Access_Read)))) {
+				value = 0;
+				return checkAccess(address, size, Access_Read) && AbstractMemory::readSized(address, size, value);
+			}
+
+			switch (size) {
+				case 1:
+					value = *static_cast<const uint8_t *>(data);
+					break;
+
+				case 2: {
+					uint16_t tmp;
+					memcpy(&tmp, data, sizeof(tmp));
+					value = tmp;
+					break;
+				}
+
+				case 4: {
+					uint32_t tmp;
+					memcpy(&tmp, data, sizeof(tmp));
+					value = tmp;
+					break;
+				}
+
+				case 8:
+					memcpy(&value, data, sizeof(value));
+					break;
+
+				default:
+					value = 0;
+					memcpy(&value, data, std::min<size_t>(size, sizeof(value)));
+					break;
+			}
+
+			return true;
+		}
+
+		// Writes to code pages, and to pages not written since the last snapshot or restore, miss
+		// the TLB. The generic path notifies the subscribers and saves the page.
+		bool writeSized(uintptr_t address, unsigned size, uint64_t value) override {
+			uint8_t *data;
+			if (unlikely((address & PAGE_MASK) + size > PAGE_SIZE || !(data = m_segments.translate(address, Access_Write)))) {
+				return checkAccess(address, size, Access_Write) && AbstractMemory::writeSized(address, size, value);
+			}
+
+			switch (size) {
+				case 1:
+					*static_cast<uint8_t *>(data) = value;
+					break;
+
+				case 2: {
+					uint16_t tmp = value;
+					memcpy(data, &tmp, sizeof(tmp));
+					break;
+				}
+
+				case 4: {
+					uint32_t tmp = value;
+					memcpy(data, &tmp, sizeof(tmp));
+					break;
+				}
+
+				default:
+					memcpy(data, &value, std::min<size_t>(size, sizeof(value)));
+					break;
+			}
+
+			// Code pages and clean pages never take this path, there is nothing else to do.
+			return true;
+		}
+
+		size_t fetch(uintptr_t address, void *buffer, size_t size) override {
+			return checkAccess(address, size, Access_Execute) ? read(address, buffer, size) : 0;
+		}
+
+		bool snapshot() override {
+			m_saved_pages.clear();
+			m_dirty_pages.clear();
+			m_snapshot = true;
+			m_segments.trackCleanPages(true);
+			return true;
+		}
+
+		// Copy back the pages written since the last snapshot or restore. The saved copies
+		// are kept, so a page rewritten after the restore is not copied again.
+		bool restore() override {
+			if (!m_snapshot) {
+				LOG_ERR("Cannot restore memory without a snapshot");
+				return false;
+			}
+
+			for (auto page : m_dirty_pages) {
+				SavedPage &saved = m_saved_pages[page];
+				saved.dirty = false;
+
+				Segment segment;
+				if (!m_segments.getSegment(page, segment)) {
+					continue;
+				}
+
+				memcpy(segment.pointer(page), saved.data.data(), PAGE_SIZE);
+				notifyWrite(page, PAGE_SIZE);
+			}
+
+			m_dirty_pages.clear();
+			m_segments.trackCleanPages(true);
+			return true;
+		}
 	};
 
 	class ZeroMemoryMap: public AbstractMemory {
@@ -253,6 +834,15 @@ namespace Memory {
 		size_t write(uintptr_t address, const void *buffer, size_t size) override {
 			return size;
 		}
+
+		// Always zero, there is nothing to save.
+		bool snapshot() override {
+			return true;
+		}
+
+		bool restore() override {
+			return true;
+		}
 	};
 }
 
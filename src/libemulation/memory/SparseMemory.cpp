@@ -0,0 +1,281 @@
+/*
+ * SparseMemory.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#include "SparseMemory.h"
+#include "debug.h"
+
+#include <array>
+#include <unistd.h>
+
+using namespace std;
+
+namespace Memory {
+    // Instances the signal handler looks faults up in.
+    static const size_t MAX_INSTANCES = 256;
+    static array<atomic<SparseMemory *>, MAX_INSTANCES> s_instances;
+
+    // Handler that was installed before ours, faults outside of every instance go to it.
+    static struct sigaction s_previous_handler;
+
+    SparseMemory::SparseMemory() {
+        if (getpagesize() != PAGE_SIZE) {
+            LOG_ERR("SparseMemory needs a host page size of 0x%x bytes", PAGE_SIZE);
+            return;
+        }
+
+        void *base = mmap(nullptr, ADDRESS_SPACE_SIZE, PROT_NONE, MAP_ANON | MAP_PRIVATE | MAP_NORESERVE, -1, 0);
+        if (base == MAP_FAILED) {
+            LOG_ERR("Could not reserve the guest address space");
+            return;
+        }
+
+        installHandler();
+
+        for (auto &slot : s_instances) {
+            SparseMemory *expected = nullptr;
+            if (slot.compare_exchange_strong(expected, this)) {
+                m_base = static_cast<uint8_t *>(base);
+                return;
+            }
+        }
+
+        LOG_ERR("Too many SparseMemory instances");
+        munmap(base, ADDRESS_SPACE_SIZE);
+    }
+
+    SparseMemory::~SparseMemory() {
+        if (!m_base) {
+            return;
+        }
+
+        for (auto &slot : s_instances) {
+            SparseMemory *expected = this;
+            if (slot.compare_exchange_strong(expected, nullptr)) {
+                break;
+            }
+        }
+
+        munmap(m_base, ADDRESS_SPACE_SIZE);
+    }
+
+    bool SparseMemory::protect(uintptr_t address, size_t size, unsigned prot) {
+        if (!valid()) {
+            LOG_ERR("Cannot protect memory without a reservation.");
+            return false;
+        }
+
+        if (!size || !PAGE_ALIGNED(address) || address + size > ADDRESS_SPACE_SIZE) {
+            LOG_ERR("Cannot protect an invalid range.");
+            return false;
+        }
+
+        size = PAGE_ALIGN(size);
+        for (uintptr_t page = address >> PAGE_SHIFT; page < (address + size) >> PAGE_SHIFT; page++) {
+            if (!(m_pages[page] & PageState_Mapped)) {
+                LOG_ERR("Cannot protect unmapped memory at 0x%.8lx", page << PAGE_SHIFT);
+                return false;
+            }
+        }
+
+        for (uintptr_t page = address >> PAGE_SHIFT; page < (address + size) >> PAGE_SHIFT; page++) {
+            m_pages[page] = (m_pages[page] & ~PageState_ProtMask) | (prot & PageState_ProtMask);
+        }
+
+        return true;
+    }
+
+    bool SparseMemory::unmap(uintptr_t address, size_t size) {
+        if (!valid()) {
+            LOG_ERR("Cannot unmap memory without a reservation.");
+            return false;
+        }
+
+        if (!PAGE_ALIGNED(address) || address + size > ADDRESS_SPACE_SIZE) {
+            LOG_ERR("Cannot unmap an invalid range.");
+            return false;
+        }
+
+        size = PAGE_ALIGN(size);
+
+        // Drop the contents and make the pages fault again on the next touch.
+        madvise(m_base + address, size, MADV_DONTNEED);
+        mprotect(m_base + address, size, PROT_NONE);
+        fill(m_pages.begin() + (address >> PAGE_SHIFT), m_pages.begin() + ((address + size) >> PAGE_SHIFT), 0);
+
+        notifyWrite(address, size);
+        return true;
+    }
+
+    bool SparseMemory::map(uintptr_t address, size_t size, unsigned prot) {
+        LOG_DEBUG("address=0x%.8x size=0x%.8x prot=0x%.8x", address, size, prot);
+
+        if (!valid()) {
+            LOG_ERR("Cannot map memory without a reservation.");
+            return false;
+        }
+
+        if (!size || !PAGE_ALIGNED(address) || address + size > ADDRESS_SPACE_SIZE) {
+            LOG_ERR("Cannot map an invalid range.");
+            return false;
+        }
+
+        size = PAGE_ALIGN(size);
+        auto first = m_pages.begin() + (address >> PAGE_SHIFT);
+        auto last = m_pages.begin() + ((address + size) >> PAGE_SHIFT);
+        if (any_of(first, last, [] (uint8_t state) { return state & PageState_Mapped; })) {
+            LOG_ERR("Cannot map segment that overlaps.");
+            return false;
+        }
+
+        // Nothing is allocated until the pages are touched.
+        fill(first, last, PageState_Mapped | (prot & PageState_ProtMask));
+        return true;
+    }
+
+    size_t SparseMemory::read(uintptr_t address, void *buffer, size_t size) {
+        LOG_DEBUG("address=0x%.8x buffer=%p size=0x%.8x", address, buffer, size);
+
+        if (!valid()) {
+            LOG_ERR("Cannot read memory without a reservation.");
+            return 0;
+        }
+
+        // Page by page, so a fault reports how much was read before it.
+        uint8_t *out = static_cast<uint8_t *>(buffer);
+        for (size_t done = 0; done < size; ) {
+            uintptr_t current = address + done;
+            size_t chunk = min<size_t>(size - done, PAGE_SIZE - (current & PAGE_MASK));
+            if (current >= ADDRESS_SPACE_SIZE) {
+                LOG_ERR("Failed to read at address 0x%.8lx", current);
+                return done;
+            }
+
+            memcpy(out + done, m_base + current, chunk);
+            if (faulted()) {
+                LOG_ERR("Failed to read at address 0x%.8lx", current);
+                discard(current, chunk);
+                return done;
+            }
+
+            done += chunk;
+        }
+
+        return size;
+    }
+
+    size_t SparseMemory::write(uintptr_t address, const void *buffer, size_t size) {
+        LOG_DEBUG("address=0x%.8x buffer=%p size=0x%.8x", address, buffer, size);
+
+        if (!valid()) {
+            LOG_ERR("Cannot write memory without a reservation.");
+            return 0;
+        }
+
+        const uint8_t *in = static_cast<const uint8_t *>(buffer);
+        for (size_t done = 0; done < size; ) {
+            uintptr_t current = address + done;
+            size_t chunk = min<size_t>(size - done, PAGE_SIZE - (current & PAGE_MASK));
+            if (current >= ADDRESS_SPACE_SIZE) {
+                LOG_ERR("Failed to write at address 0x%.8lx", current);
+                notifyWrite(address, done);
+                return done;
+            }
+
+            memcpy(m_base + current, in + done, chunk);
+            if (faulted()) {
+                LOG_ERR("Failed to write at address 0x%.8lx", current);
+                discard(current, chunk);
+                notifyWrite(address, done);
+                return done;
+            }
+
+            done += chunk;
+        }
+
+        notifyWrite(address, size);
+        return size;
+    }
+
+    size_t SparseMemory::fetch(uintptr_t address, void *buffer, size_t size) {
+        return checkRange(address, size, Access_Execute) ? read(address, buffer, size) : 0;
+    }
+
+    bool SparseMemory::checkRange(uintptr_t address, size_t size, Access access) {
+        for (uintptr_t current = address; current - address < size; current = (current & ~PAGE_MASK) + PAGE_SIZE) {
+            uint8_t state = current < ADDRESS_SPACE_SIZE ? m_pages[current >> PAGE_SHIFT] : 0;
+            if (!(state & access)) {
+                setFault(state & PageState_Mapped ? FaultReason_Protection : FaultReason_Unmapped, access, current, size);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void SparseMemory::discard(uintptr_t address, size_t size) {
+        for (uintptr_t page = address >> PAGE_SHIFT; page <= (address + size - 1) >> PAGE_SHIFT; page++) {
+            if (!(m_pages[page] & PageState_Mapped)) {
+                uint8_t *host = m_base + (page << PAGE_SHIFT);
+                madvise(host, PAGE_SIZE, MADV_DONTNEED);
+                mprotect(host, PAGE_SIZE, PROT_NONE);
+            }
+        }
+    }
+
+    bool SparseMemory::handleFault(uintptr_t host_address) {
+        uintptr_t base = reinterpret_cast<uintptr_t>(m_base);
+        if (host_address < base || host_address - base >= ADDRESS_SPACE_SIZE) {
+            return false;
+        }
+
+        // Unmapped pages are made accessible too, the access completes on a scratch page and
+        // the flag makes it fail.
+        uintptr_t page = (host_address - base) >> PAGE_SHIFT;
+        mprotect(m_base + (page << PAGE_SHIFT), PAGE_SIZE, PROT_READ | PROT_WRITE);
+        if (m_pages[page] & PageState_Mapped) {
+            m_pages[page] |= PageState_Committed;
+        } else {
+            m_fault = true;
+        }
+
+        return true;
+    }
+
+    void SparseMemory::signalHandler(int signal, siginfo_t *info, void *context) {
+        uintptr_t address = reinterpret_cast<uintptr_t>(info->si_addr);
+        for (auto &slot : s_instances) {
+            SparseMemory *memory = slot.load();
+            if (memory && memory->handleFault(address)) {
+                return;
+            }
+        }
+
+        if (s_previous_handler.sa_flags & SA_SIGINFO) {
+            s_previous_handler.sa_sigaction(signal, info, context);
+        } else if (s_previous_handler.sa_handler != SIG_DFL && s_previous_handler.sa_handler != SIG_IGN) {
+            s_previous_handler.sa_handler(signal);
+        } else {
+            // A real crash, let the access fault again with the default action.
+            sigaction(SIGSEGV, &s_previous_handler, nullptr);
+        }
+    }
+
+    void SparseMemory::installHandler() {
+        static bool installed = [] {
+            struct sigaction action;
+            memset(&action, 0, sizeof(action));
+            action.sa_sigaction = signalHandler;
+            action.sa_flags = SA_SIGINFO | SA_NODEFER;
+            sigemptyset(&action.sa_mask);
+            return sigaction(SIGSEGV, &action, &s_previous_handler) == 0;
+        }();
+
+        if (!installed) {
+            LOG_ERR("Could not install the SIGSEGV handler");
+        }
+    }
+}
@@ -0,0 +1,194 @@
+/*
+ * SparseMemory.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_LIBEMULATION_MEMORY_SPARSEMEMORY_H_
+#define SRC_LIBEMULATION_MEMORY_SPARSEMEMORY_H_
+
+#include "memory/Memory.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <signal.h>
+
+namespace Memory {
+	// The whole 32 bit guest address space reserved as a single inaccessible host region, so a
+	// guest address translates to the host with 'base + address' and no lookup. Mapping only
+	// records the pages, the host memory of a page is made accessible the first time it is
+	// touched, from a SIGSEGV handler.
+	//
+	// CPU accesses check the protection kept in the state byte of the pages they touch and
+	// report faults like the other memories do. Host accesses to unmapped pages also land in the
+	// handler, they are let through to a scratch page that is discarded right after. An
+	// instance must only be used by one thread at a time.
+	class SparseMemory: public AbstractMemory {
+	public:
+		static constexpr uint64_t ADDRESS_SPACE_SIZE = 1ULL << 32;
+
+		SparseMemory();
+		virtual ~SparseMemory();
+
+		SparseMemory(const SparseMemory &) = delete;
+		SparseMemory &operator=(const SparseMemory &) = delete;
+
+		// False if the host region could not be reserved. Nothing can be mapped then, and every
+		// access fails.
+		bool valid() const {
+			return m_base != nullptr;
+		}
+
+		// True once the host memory of the mapped page that holds 'address' has been touched.
+		bool isCommitted(uintptr_t address) const {
+			return address < ADDRESS_SPACE_SIZE && (m_pages[address >> PAGE_SHIFT] & PageState_Committed);
+		}
+
+		bool protect(uintptr_t address, size_t size, unsigned prot) override;
+		bool unmap(uintptr_t address, size_t size) override;
+		bool map(uintptr_t address, size_t size, unsigned prot) override;
+
+		size_t read(uintptr_t address, void *buffer, size_t size) override;
+		size_t write(uintptr_t address, const void *buffer, size_t size) override;
+		size_t fetch(uintptr_t address, void *buffer, size_t size) override;
+
+		bool readSized(uintptr_t address, unsigned size, uint64_t &value) override {
+			if (unlikely(!checkAccess(address, size, Access_Read))) {
+				value = 0;
+				return false;
+			}
+
+			const uint8_t *data = m_base + address;
+			switch (size) {
+				case 1:
+					value = *data;
+					break;
+
+				case 2: {
+					uint16_t tmp;
+					memcpy(&tmp, data, sizeof(tmp));
+					value = tmp;
+					break;
+				}
+
+				case 4: {
+					uint32_t tmp;
+					memcpy(&tmp, data, sizeof(tmp));
+					value = tmp;
+					break;
+				}
+
+				case 8:
+					memcpy(&value, data, sizeof(value));
+					break;
+
+				default:
+					value = 0;
+					memcpy(&value, data, std::min<size_t>(size, sizeof(value)));
+					break;
+			}
+
+			return true;
+		}
+
+		bool writeSized(uintptr_t address, unsigned size, uint64_t value) override {
+			if (unlikely(!checkAccess(address, size, Access_Write))) {
+				return false;
+			}
+
+			uint8_t *data = m_base + address;
+			switch (size) {
+				case 1:
+					*data = value;
+					break;
+
+				case 2: {
+					uint16_t tmp = value;
+					memcpy(data, &tmp, sizeof(tmp));
+					break;
+				}
+
+				case 4: {
+					uint32_t tmp = value;
+					memcpy(data, &tmp, sizeof(tmp));
+					break;
+				}
+
+				default:
+					memcpy(data, &value, std::min<size_t>(size, sizeof(value)));
+					break;
+			}
+
+			// One byte of page state per page touched instead of the code page lookup.
+			if (unlikely((m_pages[address >> PAGE_SHIFT] | m_pages[(address + size - 1) >> PAGE_SHIFT]) & PageState_Code)) {
+				notifyWrite(address, size);
+			}
+
+			return true;
+		}
+
+	private:
+		// Page states, the guest protection of mapped pages is kept in the low bits.
+		enum {
+			PageState_ProtMask = PROT_READ | PROT_WRITE | PROT_EXEC,
+			PageState_Code = 1 << 5,
+			PageState_Mapped = 1 << 6,
+			PageState_Committed = 1 << 7
+		};
+
+		uint8_t *m_base = nullptr;
+
+		// Allocated even without a reservation, where no page is ever mapped.
+		std::vector<uint8_t> m_pages = std::vector<uint8_t>(ADDRESS_SPACE_SIZE >> PAGE_SHIFT);
+
+		// Set by the signal handler when a host access touched an unmapped page.
+		volatile bool m_fault = false;
+
+		// A sized access touches at most two pages. The protection bits are only set on mapped
+		// pages, so they are enough to accept the access.
+		bool checkAccess(uintptr_t address, size_t size, Access access) {
+			if (likely(address + size <= ADDRESS_SPACE_SIZE &&
+				(m_pages[address >> PAGE_SHIFT] & m_pages[(address + size - 1) >> PAGE_SHIFT] & access))) {
+				return true;
+			}
+
+			return checkRange(address, size, access);
+		}
+
+		// Page by page check of any range, recording the fault.
+		bool checkRange(uintptr_t address, size_t size, Access access);
+
+		bool faulted() {
+			// The access above may have trapped, it has to happen before the flag is read.
+			std::atomic_signal_fence(std::memory_order_seq_cst);
+			if (likely(!m_fault)) {
+				return false;
+			}
+
+			m_fault = false;
+			return true;
+		}
+
+		void codePageChanged(uintptr_t page, bool code) override {
+			if (page < ADDRESS_SPACE_SIZE) {
+				m_pages[page >> PAGE_SHIFT] = code ? m_pages[page >> PAGE_SHIFT] | PageState_Code :
+					m_pages[page >> PAGE_SHIFT] & ~PageState_Code;
+			}
+		}
+
+		// Give back the scratch pages of a faulting access.
+		void discard(uintptr_t address, size_t size);
+
+		// Called from the signal handler, false if the fault is not in this memory.
+		bool handleFault(uintptr_t host_address);
+
+		static void signalHandler(int signal, siginfo_t *info, void *context);
+		static void installHandler();
+	};
+}
+
+#endif /* SRC_LIBEMULATION_MEMORY_SPARSEMEMORY_H_ */
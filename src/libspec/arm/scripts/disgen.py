@@ -96,28 +96,46 @@ decoder_header_cpp = \
 using namespace Disassembler;
 using namespace std;
 
-bool ARMDecoder::InITBlock() {
-    return CurrentInstrSet() == InstrSet_Thumb && m_it_session.InITBlock();
+bool ARMDecoder::InITBlock(const ARMDecoderContext &ctx) const {
+    return CurrentInstrSet(ctx) == InstrSet_Thumb && ctx.it_session.InITBlock();
 }
 
-bool ARMDecoder::LastInITBlock() {
-    return CurrentInstrSet() == InstrSet_Thumb && m_it_session.LastInITBlock();
+bool ARMDecoder::LastInITBlock(const ARMDecoderContext &ctx) const {
+    return CurrentInstrSet(ctx) == InstrSet_Thumb && ctx.it_session.LastInITBlock();
 }
 
-ARMMode ARMDecoder::CurrentInstrSet() {
-    return m_opcode_mode;
+ARMMode ARMDecoder::CurrentInstrSet(const ARMDecoderContext &ctx) const {
+    return ctx.mode;
 }
 
-bool ARMDecoder::CurrentModeIsHyp() {
-    return m_hyp_mode;
+bool ARMDecoder::CurrentModeIsHyp(const ARMDecoderContext &ctx) const {
+    return ctx.hyp_mode;
 }
 
-ARMVariants ARMDecoder::ArchVersion() {
+ARMVariants ARMDecoder::ArchVersion() const {
     return m_arm_isa;
 }
 
 '''
 
+# Pseudocode helpers that depend on the decoding state, they take the caller owned context.
+CONTEXT_HELPERS = re.compile(r"\b(InITBlock|LastInITBlock|CurrentInstrSet|CurrentModeIsHyp)\(\)")
+
+def pass_decoder_context(code):
+    """
+    Make the calls to the state dependent helpers in 'code' take the decoder context,
+    string literals (the reasons of UNPREDICTABLE instructions) are left untouched.
+    """
+    lines = []
+    for line in code.split("\n"):
+        parts = line.split('"')
+        for i in range(0, len(parts), 2):
+            parts[i] = CONTEXT_HELPERS.sub(r"\1(ctx)", parts[i])
+
+        lines.append('"'.join(parts))
+
+    return "\n".join(lines)
+
 def get_input_vars(input):
     input_vars = []
 
@@ -169,14 +187,147 @@ def __translate_bit_patterns__(bit_patterns):
 
             # print "  Extracting bits into %s from [%d-%d]" % (name, i, i - size + 1)
             if size == 1:
-                ret.append("int %5s = get_bit(opcode, %2d);" % (name, i))
+                ret.append("int %5s = Field<%2d, %2d>::get(opcode);" % (name, i, i))
             else:
-                ret.append("int %5s = get_bits(opcode, %2d, %2d);" % (name, i, i - size + 1))
+                ret.append("int %5s = Field<%2d, %2d>::get(opcode);" % (name, i, i - size + 1))
 
             i -= size
 
     return ret
 
+# Maximum number of opcode bits a single node of the decoding tree can switch on.
+DECODER_TREE_MAX_BITS = 8
+
+# Nodes with this many candidates (or less) are not split any further.
+DECODER_TREE_LEAF_SIZE = 4
+
+def build_decoder_tree(opcodes):
+    """
+    Build a decision tree over the (mask, value) pairs of an opcode table.
+
+    Each inner node selects a window of opcode bits and has one child for each possible
+    value of the window. Encodings that do not care about the selected bits are replicated
+    into every child. Leaves hold the list of candidate table indices that can still match,
+    in table order, so the first-match and SEE semantics of the linear scan are preserved.
+
+    Returns a list of nodes (shift, bits, count, index) and the list of candidates. For inner
+    nodes 'index' is the position of the first child, for leaves ('bits' == 0) it is the
+    position of the first candidate.
+    """
+    nodes = []
+    candidates = []
+    leaves = {}
+
+    def window_cost(entries, window, width):
+        # Expected number of candidates per child plus a penalty for the node size.
+        expected = sum(2.0 ** -bin(mask & window).count("1") for _, mask, _ in entries)
+        return expected + (1 << width) / 64.0
+
+    def select_window(entries, used):
+        best = None
+        for width in range(1, DECODER_TREE_MAX_BITS + 1):
+            for shift in range(0, 33 - width):
+                window = ((1 << width) - 1) << shift
+                if window & used:
+                    continue
+
+                cost = window_cost(entries, window, width)
+                if best is None or cost < best[0]:
+                    best = (cost, shift, width)
+
+        return best
+
+    def split(entries, shift, width):
+        children = []
+        for selector in range(1 << width):
+            bits = selector << shift
+            children.append([e for e in entries if (bits ^ e[2]) & e[1] & (((1 << width) - 1) << shift) == 0])
+
+        return children
+
+    def make_leaf(slot, entries):
+        key = tuple(i for i, _, _ in entries)
+        if key not in leaves:
+            leaves[key] = len(candidates)
+            candidates.extend(key)
+
+        nodes[slot] = (0, 0, len(key), leaves[key])
+
+    def build(slot, entries, used):
+        if len(entries) <= DECODER_TREE_LEAF_SIZE:
+            return make_leaf(slot, entries)
+
+        best = select_window(entries, used)
+        if best is None:
+            return make_leaf(slot, entries)
+
+        _, shift, width = best
+        children = split(entries, shift, width)
+
+        # The selected bits do not discriminate between the candidates.
+        if max(map(len, children)) == len(entries):
+            return make_leaf(slot, entries)
+
+        first = len(nodes)
+        nodes.extend([None] * len(children))
+        nodes[slot] = (shift, width, 0, first)
+
+        window = ((1 << width) - 1) << shift
+        for selector, child in enumerate(children):
+            build(first + selector, child, used | window)
+
+    nodes.append(None)
+    build(0, [(i, mask, value) for i, (mask, value) in enumerate(opcodes)], 0)
+    return nodes, candidates
+
+def write_decoder_tree(fd, table_name, opcodes):
+    """
+    Write the decoding tree of the table 'table_name' as two static arrays.
+    """
+    nodes, candidates = build_decoder_tree(opcodes)
+
+    fd.write("// Format: (shift, bits, count, index)\n")
+    fd.write("static const ARMDecoderNode %s_tree[] = {\n" % table_name)
+    for node in nodes:
+        fd.write("    { %2d, %d, %3d, %5d },\n" % node)
+    fd.write("};\n")
+    fd.write("\n")
+
+    fd.write("static const uint16_t %s_candidates[] = {\n" % table_name)
+    for i in range(0, len(candidates), 16):
+        fd.write("    %s,\n" % ", ".join("%3d" % c for c in candidates[i:i + 16]))
+    fd.write("};\n")
+    fd.write("\n")
+
+def write_decoder_tree_walk(fd, mode, table_name, check_name):
+    """
+    Write the decode function for 'mode' that walks the decoding tree of 'table_name'.
+    """
+    fd.write("ARMInstruction ARMDecoder::decode_%s(const ARMDecoderContext &ctx, uint32_t op_code) const {\n" % mode)
+    fd.write("    // Walk the tree down to the list of encodings that can match the opcode.\n")
+    fd.write("    const ARMDecoderNode *node = &%s_tree[0];\n" % table_name)
+    fd.write("    while (node->bits) {\n")
+    fd.write("        node = &%s_tree[node->index + ((op_code >> node->shift) & ((1 << node->bits) - 1))];\n" % table_name)
+    fd.write("    }\n")
+    fd.write("\n")
+    fd.write("    bool is_vfp_or_asimd = %s(op_code);\n" % check_name)
+    fd.write("    for (size_t i = node->index; i < node->index + node->count; ++i) {\n")
+    fd.write("        ARMOpcode *opcode = &%s[%s_candidates[i]];\n" % (table_name, table_name))
+    fd.write("        if (is_vfp_or_asimd && !((opcode->variants & AdvancedSIMDAll) || (opcode->variants & VFPAll)))\n")
+    fd.write("            continue;\n\n")
+    fd.write("        if ((opcode->mask & op_code) == opcode->value && (opcode->variants & m_arm_isa) != 0) {\n")
+    fd.write("            ARMInstruction ins = (this->*opcode->decoder)(ctx, op_code, opcode->ins_size, opcode->encoding);\n")
+    fd.write("\n")
+    fd.write("            // Skip instruction when there is a SEE command.\n")
+    fd.write("            if (!ins.m_skip) {\n")
+    fd.write("                return ins;\n")
+    fd.write("            }\n")
+    fd.write("        }\n")
+    fd.write("    }\n")
+    fd.write("\n")
+    fd.write("    return UnknownInstruction {};\n")
+    fd.write("}\n\n")
+
 def create_decoders(decoder_name_h, decoder_name_cpp, symbols_file, create_decoders):
     """
     Create the ARMDecoder.h and ARMDecoder.cpp.
@@ -211,54 +362,75 @@ def create_decoders(decoder_name_h, decoder_name_cpp, symbols_file, create_decod
         fd.write("        uint32_t variants;\n")
         fd.write("        Disassembler::ARMInstrSize ins_size;\n")
         fd.write("        ARMEncoding encoding;\n")
-        fd.write("        Disassembler::ARMInstruction (ARMDecoder::*decoder)(uint32_t, Disassembler::ARMInstrSize ins_size, ARMEncoding);\n")
+        fd.write("        Disassembler::ARMInstruction (ARMDecoder::*decoder)(const Disassembler::ARMDecoderContext &, uint32_t, Disassembler::ARMInstrSize ins_size, ARMEncoding) const;\n")
         fd.write("        const char *name;\n")
         fd.write("} ARMOpcode;\n")
         fd.write("\n")
+        fd.write("// Node of the decoding tree built over an opcode table. Inner nodes select the\n")
+        fd.write("// child at 'index' + opcode<shift + bits - 1:shift>, leaves ('bits' == 0) hold\n")
+        fd.write("// 'count' candidate table indices starting at 'index'.\n")
+        fd.write("typedef struct ARMDecoderNode {\n")
+        fd.write("        uint8_t shift;\n")
+        fd.write("        uint8_t bits;\n")
+        fd.write("        uint16_t count;\n")
+        fd.write("        uint32_t index;\n")
+        fd.write("} ARMDecoderNode;\n")
+        fd.write("\n")
         fd.write("extern ARMOpcode arm_opcodes[];\n")
         fd.write("extern ARMOpcode thumb_opcodes[];\n")
         fd.write("extern const size_t n_arm_opcodes;\n")
         fd.write("extern const size_t n_thumb_opcodes;\n")
         fd.write("\n")
+        fd.write("// Name and text formatter of each decoder, indexed by ARMInstruction::m_decoder. The\n")
+        fd.write("// first entry stands for instructions that were not produced by a decoder.\n")
+        fd.write("typedef struct ARMDecoderInfo {\n")
+        fd.write("        const char *name;\n")
+        fd.write("        Disassembler::ARMToStringFunction to_string;\n")
+        fd.write("} ARMDecoderInfo;\n")
+        fd.write("\n")
+        fd.write("extern const ARMDecoderInfo arm_decoder_info[];\n")
+        fd.write("extern const size_t n_arm_decoder_info;\n")
+        fd.write("\n")
         fd.write("class ARMDecoder {\n")
         fd.write("    public:\n")
         fd.write("        ARMDecoder(ARMVariants variant) :\n")
-        fd.write("                m_hyp_mode(false), m_opcode_mode(ARMMode_Invalid), m_arm_isa(variant) {\n")
+        fd.write("                m_arm_isa(variant) {\n")
         fd.write("            // Initialize the default FP state.\n")
         fd.write("            FPSCR.LEN = 0;\n")
         fd.write("            FPSCR.STRIDE = 0;\n")
-        fd.write("            // Initialize the default carry flag state.\n")
         fd.write("        }\n")
         fd.write("\n")
-        fd.write("        Disassembler::ARMInstruction decode(uint32_t op_code, ARMMode mode) {\n")
-        fd.write("            m_opcode_mode = mode;\n")
-        fd.write("            return (mode == ARMMode_ARM) ? decode_arm(op_code) : decode_thumb(op_code);\n")
+        fd.write("        // The decoder itself is immutable, the state that changes from one instruction to the\n")
+        fd.write("        // next lives in 'ctx' so a single decoder can be shared by any number of threads.\n")
+        fd.write("        Disassembler::ARMInstruction decode(const Disassembler::ARMDecoderContext &ctx, uint32_t op_code) const {\n")
+        fd.write("            return (ctx.mode == ARMMode_ARM) ? decode_arm(ctx, op_code) : decode_thumb(ctx, op_code);\n")
+        fd.write("        }\n")
+        fd.write("\n")
+        fd.write("        ARMVariants getVariant() const {\n")
+        fd.write("            return m_arm_isa;\n")
         fd.write("        }\n")
         fd.write("\n")
         fd.write("    private:\n")
-        fd.write("        bool IsZero(unsigned i) { return i == 0; };\n")
-        fd.write("        bool InITBlock();\n")
-        fd.write("        bool LastInITBlock();\n")
-        fd.write("        bool CurrentModeIsHyp();\n")
-        fd.write("        ARMMode CurrentInstrSet();\n")
-        fd.write("        ARMVariants ArchVersion();\n")
+        fd.write("        bool IsZero(unsigned i) const { return i == 0; };\n")
+        fd.write("        bool InITBlock(const Disassembler::ARMDecoderContext &ctx) const;\n")
+        fd.write("        bool LastInITBlock(const Disassembler::ARMDecoderContext &ctx) const;\n")
+        fd.write("        bool CurrentModeIsHyp(const Disassembler::ARMDecoderContext &ctx) const;\n")
+        fd.write("        ARMMode CurrentInstrSet(const Disassembler::ARMDecoderContext &ctx) const;\n")
+        fd.write("        ARMVariants ArchVersion() const;\n")
         fd.write("\n")
         fd.write("        // Fields:\n")
-        fd.write("        bool m_hyp_mode;\n")
-        fd.write("        ITSession m_it_session;\n")
-        fd.write("        ARMMode m_opcode_mode;\n")
         fd.write("        ARMVariants m_arm_isa;\n")
         fd.write("        fpscr_t FPSCR;\n")
         fd.write("\n")
-        fd.write("        Disassembler::ARMInstruction decode_arm(uint32_t opcode);\n")
-        fd.write("        Disassembler::ARMInstruction decode_thumb(uint32_t opcode);\n")
+        fd.write("        Disassembler::ARMInstruction decode_arm(const Disassembler::ARMDecoderContext &ctx, uint32_t opcode) const;\n")
+        fd.write("        Disassembler::ARMInstruction decode_thumb(const Disassembler::ARMDecoderContext &ctx, uint32_t opcode) const;\n")
         fd.write("\n")
         fd.write("    public:\n")
 
         for instruction in ARMv7DecodingSpec.instructions:
-            fd.write("        Disassembler::ARMInstruction %s(uint32_t opcode, Disassembler::ARMInstrSize ins_size, ARMEncoding encoding);\n" % instruction_decoder_name(instruction))
+            fd.write("        Disassembler::ARMInstruction %s(const Disassembler::ARMDecoderContext &ctx, uint32_t opcode, Disassembler::ARMInstrSize ins_size, ARMEncoding encoding) const;\n" % instruction_decoder_name(instruction))
 
-        fd.write("        Disassembler::ARMInstruction decode_unknown(uint32_t opcode, Disassembler::ARMInstrSize ins_size, ARMEncoding encoding);\n")
+        fd.write("        Disassembler::ARMInstruction decode_unknown(const Disassembler::ARMDecoderContext &ctx, uint32_t opcode, Disassembler::ARMInstrSize ins_size, ARMEncoding encoding) const;\n")
         fd.write("};\n")
 
     # Create the implementation file.
@@ -267,6 +439,7 @@ def create_decoders(decoder_name_h, decoder_name_cpp, symbols_file, create_decod
 
         fd.write("// Format: (mask, value, version, encoding, decoder_function, name)\n")
         fd.write("ARMOpcode arm_opcodes[] = {\n")
+        arm_opcodes = []
         for instruction in ARMv7DecodingSpec.instructions:
             if instruction["encoding"][0] == "T":
                 continue
@@ -279,31 +452,19 @@ def create_decoders(decoder_name_h, decoder_name_cpp, symbols_file, create_decod
             size = get_size(instruction["pattern"])
             name = instruction["name"]
             fd.write("    { 0x%.8x, 0x%.8x, %s, %s, %s, &ARMDecoder::%s, \"%s\"},\n" % (mask, value, version, size, encoding, decoder, name))
+            arm_opcodes.append((mask, value))
 
         fd.write("    { 0x00000000, 0x00000000, ARMvAll, eSize32, eEncodingA1, &ARMDecoder::decode_unknown, \"UNKNOWN\"}\n")
 
         fd.write("};\n")
         fd.write("\n")
         fd.write("const size_t n_arm_opcodes = sizeof(arm_opcodes) / sizeof(arm_opcodes[0]);\n")
-        fd.write("ARMInstruction ARMDecoder::decode_arm(uint32_t op_code) {\n")
-        fd.write("    for (size_t i = 0; i < n_arm_opcodes; ++i) {\n")
-        fd.write("        if (IS_ARM_VFP_OR_ASIMD(op_code) && !((arm_opcodes[i].variants & AdvancedSIMDAll) || (arm_opcodes[i].variants & VFPAll)))\n")
-        fd.write("            continue;\n\n")
-        fd.write("        if ((arm_opcodes[i].mask & op_code) == arm_opcodes[i].value && (arm_opcodes[i].variants & m_arm_isa) != 0) {\n")
-        fd.write("            ARMOpcode *opcode = &arm_opcodes[i];\n")
-        fd.write("            ARMInstruction ins = (this->*opcode->decoder)(op_code, opcode->ins_size, opcode->encoding);\n")
         fd.write("\n")
-        fd.write("            // Skip instruction when there is a SEE command.\n")
-        fd.write("            if (!ins.m_skip) {\n")
-        fd.write("                return ins;\n")
-        fd.write("            }\n")
-        fd.write("        }\n")
-        fd.write("    }\n")
-        fd.write("\n")
-        fd.write("    return UnknownInstruction {};\n")
-        fd.write("}\n\n")
+        write_decoder_tree(fd, "arm_opcodes", arm_opcodes)
+        write_decoder_tree_walk(fd, "arm", "arm_opcodes", "IS_ARM_VFP_OR_ASIMD")
 
         fd.write("ARMOpcode thumb_opcodes[] = {\n")
+        thumb_opcodes = []
         for instruction in ARMv7DecodingSpec.instructions:
             if instruction["encoding"][0] == "A":
                 continue
@@ -316,34 +477,21 @@ def create_decoders(decoder_name_h, decoder_name_cpp, symbols_file, create_decod
             size = get_size(instruction["pattern"])
             name = instruction["name"]
             fd.write("    { 0x%.8x, 0x%.8x, %s, %s, %s, &ARMDecoder::%s, \"%s\"},\n" % (mask, value, version, size, encoding, decoder, name))
+            thumb_opcodes.append((mask, value))
 
         fd.write("    { 0x00000000, 0x00000000, ARMvAll, eSize32, eEncodingA1, &ARMDecoder::decode_unknown, \"UNKNOWN\"}\n")
         fd.write("};\n")
         fd.write("\n")
 
-        fd.write("ARMInstruction ARMDecoder::decode_unknown(uint32_t opcode, Disassembler::ARMInstrSize ins_size, ARMEncoding encoding) {\n")
+        fd.write("ARMInstruction ARMDecoder::decode_unknown(const ARMDecoderContext &ctx, uint32_t opcode, Disassembler::ARMInstrSize ins_size, ARMEncoding encoding) const {\n")
         fd.write("    return UnknownInstruction {};\n")
         fd.write("}\n")
         fd.write("\n")
 
         fd.write("const size_t n_thumb_opcodes = sizeof(thumb_opcodes) / sizeof(thumb_opcodes[0]);\n")
-        fd.write("ARMInstruction ARMDecoder::decode_thumb(uint32_t op_code) {\n")
-        fd.write("    for (size_t i = 0; i < n_thumb_opcodes; ++i) {\n")
-        fd.write("        if (IS_THUMB_VFP_OR_ASIMD(op_code) && !((thumb_opcodes[i].variants & AdvancedSIMDAll) || (thumb_opcodes[i].variants & VFPAll)))\n")
-        fd.write("            continue;\n\n")
-        fd.write("        if ((thumb_opcodes[i].mask & op_code) == thumb_opcodes[i].value && (thumb_opcodes[i].variants & m_arm_isa) != 0) {\n")
-        fd.write("            ARMOpcode *opcode = &thumb_opcodes[i];\n")
-        fd.write("            ARMInstruction ins = (this->*opcode->decoder)(op_code, opcode->ins_size, opcode->encoding);\n")
-        fd.write("\n")
-        fd.write("            // Skip instruction when there is a SEE command.\n")
-        fd.write("            if (!ins.m_skip) {\n")
-        fd.write("                return ins;\n")
-        fd.write("            }\n")
-        fd.write("        }\n")
-        fd.write("    }\n")
         fd.write("\n")
-        fd.write("    return UnknownInstruction {};\n")
-        fd.write("}\n\n")
+        write_decoder_tree(fd, "thumb_opcodes", thumb_opcodes)
+        write_decoder_tree_walk(fd, "thumb", "thumb_opcodes", "IS_THUMB_VFP_OR_ASIMD")
 
         # Set that contains all the fields used in _all_ the instructions.
         ins_fields = set(["encoding"])
@@ -371,7 +519,7 @@ def create_decoders(decoder_name_h, decoder_name_cpp, symbols_file, create_decod
             ins_name = instruction_id_name(instruction)
 
             # Define the decoder.
-            fd.write("ARMInstruction ARMDecoder::%s(uint32_t opcode, Disassembler::ARMInstrSize ins_size, ARMEncoding encoding) {\n" % decoder_name)
+            fd.write("ARMInstruction ARMDecoder::%s(const ARMDecoderContext &ctx, uint32_t opcode, Disassembler::ARMInstrSize ins_size, ARMEncoding encoding) const {\n" % decoder_name)
 
             # Generate the local variables containing the bits decoded from the opcode.
             ret = __translate_bit_patterns__(instruction["pattern"].split())
@@ -415,15 +563,14 @@ def create_decoders(decoder_name_h, decoder_name_cpp, symbols_file, create_decod
             fd.write("\n")
 
             # Write the translated body of the decoding procedure.
-            fd.write(body)
+            fd.write(pass_decoder_context(body))
 
             # All the variables defined in the body end up in the instruction.
             fd.write("    ARMInstruction ins = ARMInstruction::create();\n")
             fd.write("    ins.opcode = opcode;\n")
             fd.write("    ins.ins_size = ins_size;\n")
             fd.write("    ins.id = %s;\n" % instruction_id_name(instruction))
-            fd.write("    ins.m_to_string = %s_to_string;\n" % instruction_decoder_name(instruction))
-            fd.write("    ins.m_decoded_by = \"ARMDecoder::%s\";\n" % instruction_decoder_name(instruction))
+            fd.write("    ins.m_decoder = %d;\n" % (i + 1))
             fd.write("    ins.encoding = encoding;\n")
 
             # Add the 'encoding' field to the instruction fields.
@@ -450,6 +597,16 @@ def create_decoders(decoder_name_h, decoder_name_cpp, symbols_file, create_decod
             fd.write("    return ins;\n")
             fd.write("}\n\n")
 
+        # Table used to format the instructions on demand, the index is the one set in 'm_decoder'.
+        fd.write("const ARMDecoderInfo arm_decoder_info[] = {\n")
+        fd.write("    { nullptr, nullptr },\n")
+        for instruction in ARMv7DecodingSpec.instructions:
+            decoder_name = instruction_decoder_name(instruction)
+            fd.write("    { \"ARMDecoder::%s\", %s_to_string },\n" % (decoder_name, decoder_name))
+        fd.write("};\n")
+        fd.write("\n")
+        fd.write("const size_t n_arm_decoder_info = sizeof(arm_decoder_info) / sizeof(arm_decoder_info[0]);\n")
+
     class SetEncoder(json.JSONEncoder):
         def default(self, obj):
            if isinstance(obj, set):
@@ -488,8 +645,15 @@ to_string_cpp = \
 using namespace Disassembler;
 using namespace std;
 
-string banked_reg(const ARMInstruction *ins) {
-    string tmp = "UNPREDICTABLE";
+// Decimal text of 'value', used to build register lists and data types.
+static ARMText decimal_str(unsigned value) {
+    ARMText text;
+    text.appendf("%u", value);
+    return text;
+}
+
+ARMText banked_reg(const ARMInstruction *ins) {
+    ARMText tmp = "UNPREDICTABLE";
     if (ins->read_spsr == 0) {
         switch(ins->SYSm) {
             case 0: // 0b0
@@ -606,7 +770,7 @@ string banked_reg(const ARMInstruction *ins) {
     return tmp;
 }
 
-string effect_str(const ARMInstruction *ins) {
+ARMText effect_str(const ARMInstruction *ins) {
     if (ins->enable)
         return "IE";
 
@@ -616,7 +780,7 @@ string effect_str(const ARMInstruction *ins) {
     return "";
 }
 
-string align_str(const ARMInstruction *ins) {
+ARMText align_str(const ARMInstruction *ins) {
     switch(ins->id) {
         case vst4_multiple_4_element_structures:
         case vst3_multiple_3_element_structures:
@@ -691,23 +855,23 @@ string align_str(const ARMInstruction *ins) {
     return "missing_id_align_str";
 }
 
-string range(unsigned i, unsigned n, const string &pre) {
+ARMText range(unsigned i, unsigned n, const char *pre) {
     if (n == 0) {
-        return pre + to_string(i);
+        return pre + decimal_str(i);
     }
 
-    string tmp = "";
+    ARMText tmp = "";
     while (i < n - 1) {
-        tmp += pre + to_string(i) + ", ";
+        tmp += pre + decimal_str(i) + ", ";
         i++;
     }
 
-    tmp += pre + to_string(i);
+    tmp += pre + decimal_str(i);
 
     return tmp;
 }
 
-string list_str(const ARMInstruction *ins) {
+ARMText list_str(const ARMInstruction *ins) {
     switch(ins->id) {
         case vldm: {
             // Get the value of imm8.
@@ -722,66 +886,66 @@ string list_str(const ARMInstruction *ins) {
         case vld3_multiple_3_element_structures:
             switch(ins->type) {
                 case 4:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
-                        ", D" + to_string(ins->d + 2) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
+                        ", D" + decimal_str(ins->d + 2) +
                         "}";
                 case 5:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 4) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 4) +
                         "}";
                 default:
-                    return "INVALID:" + to_string(ins->type);
+                    return "INVALID:" + decimal_str(ins->type);
             }
             break;
 
         case vst3_single_3_element_structure_from_one_lane:
         case vld3_single_3_element_structure_to_one_lane:
-            return "{D" + to_string(ins->d) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc * 2) + "["  + to_string(ins->index) + "]" + "}";
+            return "{D" + decimal_str(ins->d) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + "["  + decimal_str(ins->index) + "]" + "}";
 
         case vld3_single_3_element_structure_to_all_lanes:
-            return "{D" + to_string(ins->d) + "[], " +
-                    "D" + to_string(ins->d + ins->inc) + "[], " +
-                    "D" + to_string(ins->d + ins->inc * 2) + "[]" + "}";
+            return "{D" + decimal_str(ins->d) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + "[]" + "}";
 
         case vld4_multiple_4_element_structures:
-            return "{D" + to_string(ins->d) + ", " +
-                    "D" + to_string(ins->d + ins->inc) + ", " +
-                    "D" + to_string(ins->d + ins->inc * 2) + ", " +
-                    "D" + to_string(ins->d + ins->inc * 3) + "}";
+            return "{D" + decimal_str(ins->d) + ", " +
+                    "D" + decimal_str(ins->d + ins->inc) + ", " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + ", " +
+                    "D" + decimal_str(ins->d + ins->inc * 3) + "}";
 
         case vst4_single_4_element_structure_from_one_lane:
         case vld4_single_4_element_structure_to_one_lane:
-            return "{D" + to_string(ins->d) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc * 2) + "["  + to_string(ins->index) + "], " +
-                    "D" + to_string(ins->d + ins->inc * 3) + "["  + to_string(ins->index) + "]" + "}";
+            return "{D" + decimal_str(ins->d) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + "["  + decimal_str(ins->index) + "], " +
+                    "D" + decimal_str(ins->d + ins->inc * 3) + "["  + decimal_str(ins->index) + "]" + "}";
 
         case vld4_single_4_element_structure_to_all_lanes:
-            return "{D" + to_string(ins->d) + "[], " +
-                    "D" + to_string(ins->d + ins->inc) + "[], " +
-                    "D" + to_string(ins->d + ins->inc * 2) + "[], " +
-                    "D" + to_string(ins->d + ins->inc * 3) + "[]" + "}";
+            return "{D" + decimal_str(ins->d) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc * 2) + "[], " +
+                    "D" + decimal_str(ins->d + ins->inc * 3) + "[]" + "}";
 
         case vld2_single_2_element_structure_to_all_lanes:
-            return "{D" + to_string(ins->d) + "[], D" + to_string(ins->d + ins->inc) + "[]}";
+            return "{D" + decimal_str(ins->d) + "[], D" + decimal_str(ins->d + ins->inc) + "[]}";
 
         case vst2_single_2_element_structure_from_one_lane:
         case vld2_single_2_element_structure_to_one_lane:
-            return "{D" + to_string(ins->d) + "["  + to_string(ins->index) + "], D" + to_string(ins->d + ins->inc) + "["  + to_string(ins->index) + "]}";
+            return "{D" + decimal_str(ins->d) + "["  + decimal_str(ins->index) + "], D" + decimal_str(ins->d + ins->inc) + "["  + decimal_str(ins->index) + "]}";
 
         case vld1_single_element_to_all_lanes:
             if (!ins->T) {
-                return "{D" + to_string(ins->d) + "[]}";
+                return "{D" + decimal_str(ins->d) + "[]}";
             }
-            return "{D" + to_string(ins->d) + "[], D" + to_string(ins->d + 1) + "[]}";
+            return "{D" + decimal_str(ins->d) + "[], D" + decimal_str(ins->d + 1) + "[]}";
 
         case vst1_single_element_from_one_lane:
         case vld1_single_element_to_one_lane:
-            return "{D" + to_string(ins->d) + "["  + to_string(ins->index) + "]}";
+            return "{D" + decimal_str(ins->d) + "["  + decimal_str(ins->index) + "]}";
 
         case vld2_multiple_2_element_structures:
         case vld1_multiple_single_elements:
@@ -791,69 +955,69 @@ string list_str(const ARMInstruction *ins) {
         case vst3_multiple_3_element_structures:
             switch(ins->type) {
                 case 1:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 4) +
-                        ", D" + to_string(ins->d + 6) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 4) +
+                        ", D" + decimal_str(ins->d + 6) +
                         "}";
                 case 5:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 4) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 4) +
                         "}";
                 case 8:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
                         "}";
                 case 9:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 2) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 2) +
                         "}";
                 case 3:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 3) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 3) +
                         "}";
                 case 7:
-                    return "{D" + to_string(ins->d) + "}";
+                    return "{D" + decimal_str(ins->d) + "}";
                 case 10:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
                         "}";
                 case 4:
                 case 6:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
-                        ", D" + to_string(ins->d + 2) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
+                        ", D" + decimal_str(ins->d + 2) +
                         "}";
                 case 0:
                 case 2:
-                    return "{D" + to_string(ins->d) +
-                        ", D" + to_string(ins->d + 1) +
-                        ", D" + to_string(ins->d + 2) +
-                        ", D" + to_string(ins->d + 3) +
+                    return "{D" + decimal_str(ins->d) +
+                        ", D" + decimal_str(ins->d + 1) +
+                        ", D" + decimal_str(ins->d + 2) +
+                        ", D" + decimal_str(ins->d + 3) +
                         "}";
                 default:
-                    return "INVALID" + to_string(ins->type);
+                    return "INVALID" + decimal_str(ins->type);
             }
             break;
         case vtbl_vtbx:
             switch(ins->length - 1) {
                 case 0:
-                    return "{D" + to_string(ins->n) + "}";
+                    return "{D" + decimal_str(ins->n) + "}";
                 case 1:
-                    return "{D" + to_string(ins->n) +
-                        ", D" + to_string(ins->n + 1) + "}";
+                    return "{D" + decimal_str(ins->n) +
+                        ", D" + decimal_str(ins->n + 1) + "}";
                 case 2:
-                    return "{D" + to_string(ins->n) +
-                    ", D" + to_string(ins->n + 1) +
-                    ", D" + to_string(ins->n + 2) + "}";
+                    return "{D" + decimal_str(ins->n) +
+                    ", D" + decimal_str(ins->n + 1) +
+                    ", D" + decimal_str(ins->n + 2) + "}";
                 case 3:
-                    return "{D" + to_string(ins->n) +
-                    ", D" + to_string(ins->n + 1) +
-                    ", D" + to_string(ins->n + 2) +
-                    ", D" + to_string(ins->n + 3) + "}";
+                    return "{D" + decimal_str(ins->n) +
+                    ", D" + decimal_str(ins->n + 1) +
+                    ", D" + decimal_str(ins->n + 2) +
+                    ", D" + decimal_str(ins->n + 3) + "}";
                 default:
                     return "INVALID";
             }
@@ -861,16 +1025,16 @@ string list_str(const ARMInstruction *ins) {
 
     unsigned first_reg = first_reg = ins->d;
     unsigned n_regs = ins->imm32 >> 2;
-    string reg_type = "S";
+    ARMText reg_type = "S";
 
     if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
         n_regs /= 2;
         reg_type = "D";
     }
 
-    string acum;
+    ARMText acum;
     for(unsigned i = first_reg; i < first_reg + n_regs; ++i) {
-        acum += reg_type + to_string(i);
+        acum += reg_type + decimal_str(i);
         if (i != (first_reg + n_regs - 1))
             acum += ", ";
     }
@@ -878,7 +1042,7 @@ string list_str(const ARMInstruction *ins) {
     return "{" + acum + "}";
 }
 
-string amode_str(const ARMInstruction *ins) {
+ARMText amode_str(const ARMInstruction *ins) {
     if (ins->P == 0 && ins->U == 0) return "DA";
     else if (ins->P == 1 && ins->U == 0) return "DB";
     else if (ins->P == 0 && ins->U == 1) return "IA";
@@ -886,19 +1050,19 @@ string amode_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string IA_str(const ARMInstruction *ins) {
+ARMText IA_str(const ARMInstruction *ins) {
     return ins->increment ? "IA" : "DB";
 }
 
-string iflags_str(const ARMInstruction *ins) {
-    string out;
+ARMText iflags_str(const ARMInstruction *ins) {
+    ARMText out;
     if (ins->affectA) out += "A";
     if (ins->affectI) out += "I";
     if (ins->affectF) out += "F";
     return out;
 }
 
-string S_str(const ARMInstruction *ins) {
+ARMText S_str(const ARMInstruction *ins) {
     return ins->setflags ? "S" : "";
 }
 
@@ -912,42 +1076,42 @@ bool is_conditional_thumb(const ARMInstruction *ins) {
     return false;
 }
 
-string c_str(const ARMInstruction *ins) {
+ARMText c_str(const ARMInstruction *ins) {
     if (EncodingIsThumb(ins->encoding) && !is_conditional_thumb(ins))
         return "";
 
     return ins->cond != COND_AL ? ARMCondCodeToString((cond_t) ins->cond) : "";
 }
 
-string B_str(const ARMInstruction *ins) {
+ARMText B_str(const ARMInstruction *ins) {
     return ins->B ? "B" : "";
 }
 
-string N_str(const ARMInstruction *ins) {
+ARMText N_str(const ARMInstruction *ins) {
     return ins->nonzero ? "N" : "";
 }
 
-string W_str(const ARMInstruction *ins) {
+ARMText W_str(const ARMInstruction *ins) {
     return ins->is_pldw ? "W" : "";
 }
 
-string x_str(const ARMInstruction *ins) {
+ARMText x_str(const ARMInstruction *ins) {
     return ins->n_high ? "T" : "B";
 }
 
-string y_str(const ARMInstruction *ins) {
+ARMText y_str(const ARMInstruction *ins) {
     return ins->m_high ? "T" : "B";
 }
 
-string X_str(const ARMInstruction *ins) {
+ARMText X_str(const ARMInstruction *ins) {
     return ins->m_swap ? "X" : "";
 }
 
-string R_str(const ARMInstruction *ins) {
+ARMText R_str(const ARMInstruction *ins) {
     return ins->round ? "R" : "";
 }
 
-string mode_str(const ARMInstruction *ins) {
+ARMText mode_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vldm: // VLDM
         case vstm: // VSTM
@@ -965,7 +1129,7 @@ string mode_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string op_str(const ARMInstruction *ins) {
+ARMText op_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vpmax_vpmin_floating_point: // VPMAX, VPMIN (floating-point)
         case vpmax_vpmin_integer: // VPMAX, VPMIN (integer)
@@ -982,20 +1146,20 @@ string op_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string dt_str(const ARMInstruction *ins) {
+ARMText dt_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vrsqrte:
-            return ((ins->floating_point) ? "F" : "U") + to_string(ins->esize);
+            return ((ins->floating_point) ? "F" : "U") + decimal_str(ins->esize);
 
         case vrhadd:
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vrecpe:
             return (ins->floating_point) ? "F32" : "U32";
 
         case vpadal:
         case vpaddl:
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vmla_vmlal_vmls_vmlsl_integer:
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
@@ -1024,10 +1188,10 @@ string dt_str(const ARMInstruction *ins) {
             }
         case vmla_vmlal_vmls_vmlsl_by_scalar:
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->floating_point ? "F" : "I") + string(ins->size == 1 ? "16" : "32");
+                return (ins->floating_point ? "F" : "I") + ARMText(ins->size == 1 ? "16" : "32");
             }
 
-            return (ins->unsigned_ ? "U" : "S") + string(ins->size == 1 ? "16" : "32");
+            return (ins->unsigned_ ? "U" : "S") + ARMText(ins->size == 1 ? "16" : "32");
 
         case vmax_vmin_integer:
         case vhadd_vhsub:
@@ -1063,26 +1227,26 @@ string dt_str(const ARMInstruction *ins) {
                 default: return "INVALID";
             }
         case vqadd:
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vceq_immediate_0:
-            return (ins->floating_point ? "F" : "I") + to_string(ins->esize);
+            return (ins->floating_point ? "F" : "I") + decimal_str(ins->esize);
         case vcgt_immediate_0:
         case vcle_immediate_0:
         case vclt_immediate_0:
         case vcge_immediate_0:
-            return (ins->floating_point ? "F" : "S") + to_string(ins->esize);
+            return (ins->floating_point ? "F" : "S") + decimal_str(ins->esize);
 
         case vcgt_register:
         case vcge_register:
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->U ? "U" : "S") + to_string(ins->esize);
+                return (ins->U ? "U" : "S") + decimal_str(ins->esize);
             }
 
             return "F32";
 
         case vceq_register: // VCEQ (register)
-            return (ins->int_operation ? "I" : "F") + to_string(ins->esize);
+            return (ins->int_operation ? "I" : "F") + decimal_str(ins->esize);
 
         case vbic_immediate:
         case vmov_immediate:
@@ -1134,7 +1298,7 @@ string dt_str(const ARMInstruction *ins) {
         case vneg:
         case vabs: // VABS
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->floating_point ? "F" : "S") + to_string(ins->esize);
+                return (ins->floating_point ? "F" : "S") + decimal_str(ins->esize);
             }
             return ins->dp_operation ? "F64" : "F32";
         case vaddhn: // VADDHN
@@ -1164,7 +1328,7 @@ string dt_str(const ARMInstruction *ins) {
 
             break;
         case vmovl: // VMOVL
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vmovn: // VMOVN
             switch (ins->size) {
@@ -1181,17 +1345,17 @@ string dt_str(const ARMInstruction *ins) {
             break;
         case vmul_vmull_by_scalar: // VMUL, VMULL (by scalar)
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->floating_point ? "F" : "I") + to_string(ins->esize);
+                return (ins->floating_point ? "F" : "I") + decimal_str(ins->esize);
             }
 
-            return (ins->unsigned_ ? "U" : "S") + to_string(ins->esize);
+            return (ins->unsigned_ ? "U" : "S") + decimal_str(ins->esize);
 
         case vmul_vmull_integer_and_polynomial: // VMUL, VMULL (integer and polynomial)
             if (ins->encoding == eEncodingT1 || ins->encoding == eEncodingA1) {
-                return (ins->polynomial ? "P" : "I") + to_string(ins->esize);
+                return (ins->polynomial ? "P" : "I") + decimal_str(ins->esize);
             }
 
-            return (ins->polynomial ? "P" : (ins->unsigned_ ? "U" : "S")) + to_string(ins->esize);
+            return (ins->polynomial ? "P" : (ins->unsigned_ ? "U" : "S")) + decimal_str(ins->esize);
 
         case vpadd_integer: // VPADD (integer)
             switch (ins->size) {
@@ -1278,7 +1442,7 @@ string dt_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string U_str(const ARMInstruction *ins) {
+ARMText U_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vqmovn_vqmovun: // VQMOVN, VQMOVUN
             return ins->op == 1 ? "U" : "";
@@ -1293,7 +1457,7 @@ string U_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string size_str(const ARMInstruction *ins) {
+ARMText size_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vst3_single_3_element_structure_from_one_lane:
         case vst2_single_2_element_structure_from_one_lane:
@@ -1315,7 +1479,7 @@ string size_str(const ARMInstruction *ins) {
         case vrev16_vrev32_vrev64:
         case vqsub:
         case vqshl_vqshlu_immediate:
-            return to_string(ins->esize);
+            return decimal_str(ins->esize);
 
         case vld1_single_element_to_one_lane:
         case vld1_single_element_to_all_lanes:
@@ -1373,7 +1537,7 @@ string size_str(const ARMInstruction *ins) {
 
             break;
         case vshll: // VSHLL
-            return to_string(ins->esize);
+            return decimal_str(ins->esize);
         case vqrshrn_vqrshrun: // VQRSHRN, VQRSHRUN
         case vqshrn_vqshrun: // VQSHRN, VQSHRUN
         case vrshrn: // VRSHRN
@@ -1389,7 +1553,7 @@ string size_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string type_str(const ARMInstruction *ins) {
+ARMText type_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case vqshl_vqshlu_immediate:
             return ins->src_unsigned ? "U" : "S";
@@ -1445,7 +1609,7 @@ string type_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string regular_reg_str(unsigned reg) {
+ARMText regular_reg_str(unsigned reg) {
     switch (reg) {
         case 0:
             return "r0";
@@ -1486,7 +1650,7 @@ string regular_reg_str(unsigned reg) {
     return "INVALID";
 }
 
-string coproc_str(unsigned coproc) {
+ARMText coproc_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "p0";
@@ -1527,7 +1691,7 @@ string coproc_str(unsigned coproc) {
     return "INVALID";
 }
 
-string shift_type_str(unsigned shift) {
+ARMText shift_type_str(unsigned shift) {
     switch (shift) {
         case 0:
             return "LSL";
@@ -1546,7 +1710,7 @@ string shift_type_str(unsigned shift) {
     return "INVALID";
 }
 
-string coproc_reg_str(unsigned coproc) {
+ARMText coproc_reg_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "c0";
@@ -1587,7 +1751,7 @@ string coproc_reg_str(unsigned coproc) {
     return "INVALID";
 }
 
-string quad_reg_str(unsigned coproc) {
+ARMText quad_reg_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "q0";
@@ -1628,7 +1792,7 @@ string quad_reg_str(unsigned coproc) {
     return "INVALID";
 }
 
-string double_reg_str(unsigned coproc) {
+ARMText double_reg_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "d0";
@@ -1701,7 +1865,7 @@ string double_reg_str(unsigned coproc) {
     return "INVALID";
 }
 
-string simple_reg_str(unsigned coproc) {
+ARMText simple_reg_str(unsigned coproc) {
     switch (coproc) {
         case 0:
             return "s0";
@@ -1774,7 +1938,7 @@ string simple_reg_str(unsigned coproc) {
     return "INVALID";
 }
 
-string option_str(const ARMInstruction *ins) {
+ARMText option_str(const ARMInstruction *ins) {
     switch (ins->id) {
         case dbg:
             return integer_to_string(ins->option, ins->option >= 10);
@@ -1817,12 +1981,12 @@ string option_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string endian_specifier_str(unsigned endian) {
+ARMText endian_specifier_str(unsigned endian) {
     return endian ? "BE" : "LE";
 }
 
-string spec_reg_str(const ARMInstruction *ins) {
-    string t;
+ARMText spec_reg_str(const ARMInstruction *ins) {
+    ARMText t;
 
     switch(ins->id) {
         case vmrs:
@@ -1832,7 +1996,7 @@ string spec_reg_str(const ARMInstruction *ins) {
                 case 6: return "MVFR1";
                 case 7: return "MVFR0";
                 case 8: return "FPEXC";
-                default: return "VFP_CUSTOM_REG_" + to_string(ins->reg);
+                default: return "VFP_CUSTOM_REG_" + decimal_str(ins->reg);
             }
             break;
         case vmsr:
@@ -1840,7 +2004,7 @@ string spec_reg_str(const ARMInstruction *ins) {
                 case 0: return "FPSID";
                 case 1: return "FPSCR";
                 case 8: return "FPEXC";
-                default: return "VFP_CUSTOM_REG_" + to_string(ins->reg);
+                default: return "VFP_CUSTOM_REG_" + decimal_str(ins->reg);
             }
             break;
         case mrs:
@@ -1870,29 +2034,29 @@ string spec_reg_str(const ARMInstruction *ins) {
     return "INVALID";
 }
 
-string registers_str(unsigned registers) {
-    string regs;
+ARMText registers_str(unsigned registers) {
+    ARMText regs;
     bool f = false;
     for (unsigned i = 0; i < 32; i++) {
         if (get_bit(registers, i)) {
             regs += i && f ? ", " : "";
             f = true;
-            regs += string(regular_reg_str(i));
+            regs += regular_reg_str(i);
         }
     }
 
     return "{" + regs + "}";
 }
 
-string shift_str(unsigned shift_t, unsigned shift_n) {
+ARMText shift_str(unsigned shift_t, unsigned shift_n) {
     if (shift_t == SRType_RRX && shift_n == 1)
-        return string(shift_type_str(shift_t));
+        return shift_type_str(shift_t);
 
-    string shift = string(shift_type_str(shift_t)) + " #" + integer_to_string(shift_n, false);
+    ARMText shift = shift_type_str(shift_t) + " #" + integer_to_string(shift_n, false);
     return shift;
 }
 
-string rotation_str(unsigned rotation) {
+ARMText rotation_str(unsigned rotation) {
     switch(rotation) {
         case 0:
             return "";
@@ -1907,8 +2071,8 @@ string rotation_str(unsigned rotation) {
     return "INVALID";
 }
 
-string R0_R14_APSR_nzcv(const ARMInstruction *ins) {
-    return ins->t == 15 ? string("apsr_nzcv") : regular_reg_str(ins->t);
+ARMText R0_R14_APSR_nzcv(const ARMInstruction *ins) {
+    return ins->t == 15 ? ARMText("apsr_nzcv") : regular_reg_str(ins->t);
 }
 
 '''
@@ -1918,41 +2082,41 @@ to_string_h = '''// Warning! autogenerated file, do what you want.
 #include "arm/ARMDisassembler.h"
 
 bool is_conditional_thumb(const Disassembler::ARMInstruction *ins);
-std::string B_str(const Disassembler::ARMInstruction *ins);
-std::string IA_str(const Disassembler::ARMInstruction *ins);
-std::string N_str(const Disassembler::ARMInstruction *ins);
-std::string R_str(const Disassembler::ARMInstruction *ins);
-std::string S_str(const Disassembler::ARMInstruction *ins);
-std::string U_str(const Disassembler::ARMInstruction *ins);
-std::string W_str(const Disassembler::ARMInstruction *ins);
-std::string X_str(const Disassembler::ARMInstruction *ins);
-std::string align_str(const Disassembler::ARMInstruction *ins);
-std::string amode_str(const Disassembler::ARMInstruction *ins);
-std::string banked_reg(const Disassembler::ARMInstruction *ins);
-std::string c_str(const Disassembler::ARMInstruction *ins);
-std::string coproc_reg_str(unsigned coproc);
-std::string coproc_str(unsigned coproc);
-std::string double_reg_str(unsigned coproc);
-std::string dt_str(const Disassembler::ARMInstruction *ins);
-std::string effect_str(const Disassembler::ARMInstruction *ins);
-std::string endian_specifier_str(unsigned endian);
-std::string iflags_str(const Disassembler::ARMInstruction *ins);
-std::string list_str(const Disassembler::ARMInstruction *ins);
-std::string mode_str(const Disassembler::ARMInstruction *ins);
-std::string op_str(const Disassembler::ARMInstruction *ins);
-std::string option_str(const Disassembler::ARMInstruction *ins);
-std::string quad_reg_str(unsigned coproc);
-std::string registers_str(unsigned registers);
-std::string regular_reg_str(unsigned reg);
-std::string rotation_str(unsigned rotation);
-std::string shift_str(unsigned shift_t, unsigned shift_n);
-std::string shift_type_str(unsigned shift);
-std::string simple_reg_str(unsigned coproc);
-std::string size_str(const Disassembler::ARMInstruction *ins);
-std::string spec_reg_str(const Disassembler::ARMInstruction *ins);
-std::string type_str(const Disassembler::ARMInstruction *ins);
-std::string x_str(const Disassembler::ARMInstruction *ins);
-std::string y_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText B_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText IA_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText N_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText R_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText S_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText U_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText W_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText X_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText align_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText amode_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText banked_reg(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText c_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText coproc_reg_str(unsigned coproc);
+Disassembler::ARMText coproc_str(unsigned coproc);
+Disassembler::ARMText double_reg_str(unsigned coproc);
+Disassembler::ARMText dt_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText effect_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText endian_specifier_str(unsigned endian);
+Disassembler::ARMText iflags_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText list_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText mode_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText op_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText option_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText quad_reg_str(unsigned coproc);
+Disassembler::ARMText registers_str(unsigned registers);
+Disassembler::ARMText regular_reg_str(unsigned reg);
+Disassembler::ARMText rotation_str(unsigned rotation);
+Disassembler::ARMText shift_str(unsigned shift_t, unsigned shift_n);
+Disassembler::ARMText shift_type_str(unsigned shift);
+Disassembler::ARMText simple_reg_str(unsigned coproc);
+Disassembler::ARMText size_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText spec_reg_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText type_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText x_str(const Disassembler::ARMInstruction *ins);
+Disassembler::ARMText y_str(const Disassembler::ARMInstruction *ins);
 '''
 def create_to_string(to_string_name_h, to_string_name_cpp):
     parser = ARMv7Parser.InstructionFormatParser()
@@ -2014,9 +2178,9 @@ def create_to_string(to_string_name_h, to_string_name_cpp):
 
     reg2string["list"] = "list_str(ins).c_str()"
 
-    reg2string["Dd[x]"] = "(double_reg_str(ins->d) + \"[\" + to_string(ins->index) + \"]\").c_str()"
-    reg2string["Dn[x]"] = "(double_reg_str(ins->n) + \"[\" + to_string(ins->index) + \"]\").c_str()"
-    reg2string["Dm[x]"] = "(double_reg_str(ins->m) + \"[\" + to_string(ins->index) + \"]\").c_str()"
+    reg2string["Dd[x]"] = "(double_reg_str(ins->d) + \"[\" + integer_to_string(ins->index, false) + \"]\").c_str()"
+    reg2string["Dn[x]"] = "(double_reg_str(ins->n) + \"[\" + integer_to_string(ins->index, false) + \"]\").c_str()"
+    reg2string["Dm[x]"] = "(double_reg_str(ins->m) + \"[\" + integer_to_string(ins->index, false) + \"]\").c_str()"
 
     reg2string["iflags"] = "iflags_str(ins).c_str()"
     reg2string["shift_amount"] = "integer_to_string(ins->shift_amount, true).c_str()"
@@ -2054,10 +2218,10 @@ def create_to_string(to_string_name_h, to_string_name_cpp):
                 op_args = r[1]
 
             # Write the header with the common structures.
-            fd.write("string %s_to_string(const ARMInstruction *ins) {\n" % instruction_decoder_name(instruction))
+            fd.write("ARMText %s_to_string(const ARMInstruction *ins) {\n" % instruction_decoder_name(instruction))
             fd.write("    // DEBUG: %s\n" % format)
-            fd.write("    char op_name[256], op_args[256];\n")
-            fd.write("    snprintf(op_name, sizeof(op_name),\n")
+            fd.write("    ARMText text;\n")
+            fd.write("    text.appendf(\n")
             fd.write("            \"%s%s\"" % (op_name.name[0], "%s" * (len(op_name.name) - 1)))
 
             # Skip the last comma if the name has no variable pieces.
@@ -2094,11 +2258,11 @@ def create_to_string(to_string_name_h, to_string_name_cpp):
 
             # Skip the rest if there are no arguments to the instruction.
             if not len(op_args.name):
-                fd.write("    return string(op_name);\n")
+                fd.write("    return text;\n")
                 fd.write("}\n\n")
                 continue
 
-            fd.write("    snprintf(op_args, sizeof(op_args),\n")
+            fd.write("    text.appendf(\n")
 
             format_string = ""
             vars = []
@@ -2156,7 +2320,7 @@ def create_to_string(to_string_name_h, to_string_name_cpp):
                 fd.write("\n")
 
             fd.write("    );\n\n")
-            fd.write("    return string(op_name) + string(op_args);\n")
+            fd.write("    return text;\n")
             fd.write("}\n\n")
 
     # Create the header file.
@@ -2167,7 +2331,7 @@ def create_to_string(to_string_name_h, to_string_name_cpp):
             if "CUSTOM" == instruction["format"].split()[0]:
                 continue
 
-            fd.write("std::string %s_to_string(const Disassembler::ARMInstruction *ins);\n" % instruction_decoder_name(instruction))
+            fd.write("Disassembler::ARMText %s_to_string(const Disassembler::ARMInstruction *ins);\n" % instruction_decoder_name(instruction))
 
     return True
 
@@ -2198,7 +2362,7 @@ def create_to_string_custom(to_string_custom_name_h, to_string_custom_name_cpp):
         fd.write(to_string_custom_h)
 
         for instruction in filter(lambda x: x["format"] == "CUSTOM", ARMv7DecodingSpec.instructions):
-            fd.write("std::string %s_to_string(const Disassembler::ARMInstruction *ins);\n" % instruction_decoder_name(instruction))
+            fd.write("Disassembler::ARMText %s_to_string(const Disassembler::ARMInstruction *ins);\n" % instruction_decoder_name(instruction))
 
     # Create the implementation file.
     with open(to_string_custom_name_cpp, "w") as fd:
@@ -2208,11 +2372,11 @@ def create_to_string_custom(to_string_custom_name_h, to_string_custom_name_cpp):
 
         for instruction in filter(lambda x: x["format"] == "CUSTOM", ARMv7DecodingSpec.instructions):
             fd.write("// Instruction: %s\n// Encoding: %s\n" % (instruction["name"], instruction["encoding"]))
-            fd.write("std::string %s_to_string(const Disassembler::ARMInstruction *ins) {\n" % instruction_decoder_name(instruction))
+            fd.write("ARMText %s_to_string(const Disassembler::ARMInstruction *ins) {\n" % instruction_decoder_name(instruction))
             fd.write("    char buffer[64];\n")
             fd.write("    snprintf(buffer, sizeof(buffer), \"TODO_%s_%s\");\n" % (instruction_id_name(instruction), instruction["encoding"]))
             fd.write("\n")
-            fd.write("    return std::string(buffer);\n")
+            fd.write("    return ARMText(buffer);\n")
             fd.write("}\n")
             fd.write("\n")
 
@@ -7,7 +7,7 @@ import tempfile
 import argparse
 
 from parser import ARMv7Parser
-from specification import ARMv7OperationSpec, ARMv7Types, ARMv7Context
+from specification import ARMv7DecodingSpec, ARMv7OperationSpec, ARMv7Types, ARMv7Context
 from ast.passes import IdentifierRenamer, ListAssignmentRewriter, SimpleFunctionOptimization
 from ast.translators import InterpreterCPPTranslator, indent, NeedsSemiColon
 from disgen import instruction_id_name
@@ -20,6 +20,147 @@ def method_name(ins_name):
     ins_name = ins_name.rstrip("_")
     return "interpret_" + ins_name.lower()
 
+# Consecutive N, Z[, C[, V]] updates from a 32 bit result, folded into a single ARMContext call
+# that records the operands and leaves the APSR bits pending.
+FLAG_UPDATE_RE = re.compile(
+    r"^(\s*)m_ctx\.APSR\.N = get_bit\((\w+), 31\);\n"
+    r"\s*m_ctx\.APSR\.Z = IsZeroBit\(\2\);\n"
+    r"(?:\s*m_ctx\.APSR\.C = ([^;\n]+);\n"
+    r"(?:\s*m_ctx\.APSR\.V = ([^;\n]+);\n)?)?", re.MULTILINE)
+
+# Anything that touches the condition flags as part of the whole CPSR, or writes them one by one.
+FLAG_EAGER_RE = re.compile(
+    r"m_ctx\.APSR\.[NZCV]\b = |m_ctx\.(APSR|CPSR)\b(?!\.)|CPSRWriteByInstr")
+
+def flag_update(match):
+    indentation, result, carry, overflow = match.groups()
+    if overflow:
+        return "%sm_ctx.setFlagsNZCV(%s, %s, %s);\n" % (indentation, result, carry, overflow)
+
+    if carry:
+        return "%sm_ctx.setFlagsNZC(%s, %s);\n" % (indentation, result, carry)
+
+    return "%sm_ctx.setFlagsNZ(%s);\n" % (indentation, result)
+
+def lazy_flags(body):
+    """
+    Make the translated body of an instruction use the lazy condition flags of ARMContext.
+    Instructions that need the flags inside the CPSR word keep the original code and fold
+    the pending flags first.
+    """
+    lazy_body = FLAG_UPDATE_RE.sub(flag_update, body)
+    if FLAG_EAGER_RE.search(lazy_body):
+        return indent("m_ctx.syncFlags();") + body
+
+    return re.sub(r"m_ctx\.APSR\.([NZCV])\b", r"m_ctx.flag\1()", lazy_body)
+
+# Calls to the memory access functions of ARMContext.
+MEMORY_READ_RE = re.compile(r"m_ctx\.read_Mem[AU]\w*\(")
+MEMORY_ACCESS_RE = re.compile(r"m_ctx\.(read|write)_Mem[AU]\w*\(")
+
+# Statements whose only effect besides the access is on a local variable.
+LOCAL_STATEMENT_RE = re.compile(r"^(\w+ = |set_bits\(\w+, |m_ctx\.write_Mem)")
+
+def call_end(line, start):
+    """
+    Index past the parenthesis that closes the call whose name starts at 'start'.
+    """
+    depth = 0
+    for i in range(line.index("(", start), len(line)):
+        if line[i] == "(":
+            depth += 1
+        elif line[i] == ")":
+            depth -= 1
+            if depth == 0:
+                return i + 1
+
+    raise ValueError("Unbalanced call in '%s'" % line)
+
+def hoisted_expression(statement):
+    """
+    Span of the expression of 'statement' holding its memory reads: the read itself, or the
+    outermost argument holding all of them when there is more than one.
+    """
+    reads = [(match.start(), call_end(statement, match.start())) for match in MEMORY_READ_RE.finditer(statement)]
+    if len(reads) == 1:
+        return reads[0]
+
+    # Split the arguments of the outer call at the top level commas.
+    start = statement.index("(") + 1
+    depth = 0
+    for i in range(start, len(statement)):
+        if statement[i] == "(":
+            depth += 1
+        elif statement[i] in ",)" and depth == 0:
+            if start <= reads[0][0] and reads[-1][1] <= i:
+                while statement[start] == " ":
+                    start += 1
+
+                return (start, i)
+
+            start = i + 1
+
+        if statement[i] == ")":
+            depth -= 1
+
+    raise ValueError("Reads in '%s' are not in a single argument" % statement)
+
+def precise_faults(body):
+    """
+    Return from the handler at the first faulting access, before it writes any register. A read
+    nested in a register write is hoisted into 'loaded_value' so the check runs in between.
+    The base register is restored where it may have changed before the access, written back
+    earlier in the pseudocode or loaded as part of a register list. Returns the body and the
+    declarations it needs.
+    """
+    if not MEMORY_ACCESS_RE.search(body):
+        return body, []
+
+    # Written back base register, SP for the push and pop forms. A register list can include the
+    # base, except for pop where that is unpredictable.
+    declarations = []
+    base = next((n for n in ("ins.n", "13") if "m_ctx.writeRegularRegister(%s," % n in body), None)
+    register_list = base == "ins.n" and "m_ctx.writeRegularRegister(i, m_ctx.read_Mem" in body
+    written = False
+
+    lines = []
+    for line in body.splitlines():
+        statement = line.lstrip()
+        written = written or (base and statement.startswith("m_ctx.writeRegularRegister(%s," % base))
+        if not MEMORY_ACCESS_RE.search(statement):
+            lines.append(line)
+            continue
+
+        restore = base and (written or register_list)
+        saved_base = "uint32_t saved_base = m_ctx.readRegularRegister(%s);" % base
+        if restore and saved_base not in declarations:
+            declarations.insert(0, saved_base)
+
+        indentation = line[:len(line) - len(statement)]
+        hoisted = not LOCAL_STATEMENT_RE.match(statement)
+        if hoisted:
+            start, end = hoisted_expression(statement)
+            lines.append(indentation + "loaded_value = " + statement[start:end] + ";")
+            statement = statement[:start] + "loaded_value" + statement[end:]
+            if "uint64_t loaded_value = 0;" not in declarations:
+                declarations.append("uint64_t loaded_value = 0;")
+
+        check = [indentation + "if (m_ctx.hasMemoryFault()) {"]
+        if restore:
+            check.append(indentation + "    m_ctx.writeRegularRegister(%s, saved_base);" % base)
+        check.append(indentation + "    return true;")
+        check.append(indentation + "}")
+
+        # Hoisted reads are checked before the statement that consumes them.
+        if hoisted:
+            lines.extend(check)
+            lines.append(indentation + statement)
+        else:
+            lines.append(line)
+            lines.extend(check)
+
+    return "\n".join(lines) + "\n", declarations
+
 def create_interpreter(interpreter_name_h, interpreter_name_cpp, symbols_file):
     """
     Create ARMInterpreter.h and ARMInterpreter.cpp.
@@ -44,8 +185,19 @@ def create_interpreter(interpreter_name_h, interpreter_name_cpp, symbols_file):
         header += "        m_ctx(ctx) {\n"
         header += "    }\n\n"
         header += "    void execute(const ARMInstruction &ins);\n\n"
+        header += "    // Member function that interprets an instruction. It can be resolved once per decoded\n"
+        header += "    // instruction so callers skip the lookup every time the instruction is executed.\n"
+        header += "    typedef bool (ARMInterpreter::*Handler)(const ARMInstruction &ins);\n"
+        header += "    static Handler getHandler(const ARMInstruction &ins);\n\n"
+        header += "    bool execute(Handler handler, const ARMInstruction &ins) {\n"
+        header += "        return (this->*handler)(ins);\n"
+        header += "    }\n\n"
         header += "private:\n"
         header += "    ARMContext &m_ctx;\n\n"
+        header += "    // Handlers indexed by ARMInstructionId.\n"
+        header += "    static const Handler m_handlers[];\n"
+        header += "    static const size_t n_handlers;\n\n"
+        header += "    bool interpret_unknown(const ARMInstruction &ins) { return false; }\n"
         header += "    bool ConditionPassed() { return true; }\n"
         header += "    bool CurrentModeIsHyp() { return false; }\n"
         header += "    bool CurrentModeIsNotUser() { return false; }\n"
@@ -54,7 +206,7 @@ def create_interpreter(interpreter_name_h, interpreter_name_cpp, symbols_file):
         header += "    bool IsSecure() { return false; }\n"
         header += "    bool JazelleAcceptsExecution() { return false; }\n"
         header += "    void BKPTInstrDebugEvent() {}\n"
-        header += "    void BranchWritePC(uint32_t address) {}\n"
+        header += "    void BranchWritePC(uint32_t address) { m_ctx.BranchWritePC(address); }\n"
         header += "    void CheckAdvSIMDEnabled() {}\n"
         header += "    void ClearEventRegister() {}\n"
         header += "    void EncodingSpecificOperations() {}\n"
@@ -65,7 +217,7 @@ def create_interpreter(interpreter_name_h, interpreter_name_cpp, symbols_file):
         header += "    void WaitForInterrupt() {}\n"
         header += "    ARMMode CurrentInstrSet() { return ARMMode_ARM; }\n"
         header += "    void SelectInstrSet(unsigned mode) {}\n"
-        header += "    void BXWritePC(unsigned address) {}\n"
+        header += "    void BXWritePC(unsigned address) { m_ctx.BXWritePC(address); }\n"
         header += "    void WriteHSR(unsigned ec, unsigned hsr_string) {}\n"
         header += "    unsigned ThisInstr() { return 0; }\n"
         header += "    bool Coproc_Accepted(unsigned cp_num, unsigned instr) { return true; }\n"
@@ -86,7 +238,7 @@ def create_interpreter(interpreter_name_h, interpreter_name_cpp, symbols_file):
         header += "    void NullCheckIfThumbEE(unsigned n) {}\n"
         header += "    void Coproc_SendLoadedWord(unsigned word, unsigned cp_num, unsigned instr) {}\n"
         header += "    bool Coproc_DoneLoading(unsigned cp_num, unsigned instr) { return true; }\n"
-        header += "    void LoadWritePC(unsigned address) {}\n"
+        header += "    void LoadWritePC(unsigned address) { m_ctx.LoadWritePC(address); }\n"
         header += "    bool UnalignedSupport() { return false; }\n"
         header += "    bool HaveLPAE() { return true; }\n"
         header += "    bool BigEndian() {return false;}\n"
@@ -186,14 +338,27 @@ def create_interpreter(interpreter_name_h, interpreter_name_cpp, symbols_file):
 
         fd.write(header)
 
-        # Create the execution dispatcher.
+        # Create the handler table, in the same order as the ARMInstructionId enum.
+        handlers = {}
+        for instruction in ARMv7OperationSpec.instructions:
+            handlers[instruction_id_name(instruction)] = method_name(instruction["name"])
+
         body = ""
+        body += "const ARMInterpreter::Handler ARMInterpreter::m_handlers[] = {\n"
+        for instruction_id in sorted(set(map(instruction_id_name, ARMv7DecodingSpec.instructions))):
+            body += "    &ARMInterpreter::%s,\n" % handlers.get(instruction_id, "interpret_unknown")
+        body += "};\n\n"
+        body += "const size_t ARMInterpreter::n_handlers = sizeof(ARMInterpreter::m_handlers) / sizeof(ARMInterpreter::m_handlers[0]);\n\n"
+
+        # Create the execution dispatcher.
+        body += "ARMInterpreter::Handler ARMInterpreter::getHandler(const ARMInstruction &ins) {\n"
+        body += "    if (ins.m_status != eStatusValid || ins.id >= n_handlers) {\n"
+        body += "        return &ARMInterpreter::interpret_unknown;\n"
+        body += "    }\n\n"
+        body += "    return m_handlers[ins.id];\n"
+        body += "}\n\n"
         body += "void ARMInterpreter::execute(const ARMInstruction &ins) {\n"
-        body += "    switch (ins.id) {\n"
-        for i, instruction in enumerate(ARMv7OperationSpec.instructions):
-            body += "        case ARMInstructionId::%s: %s(ins); break;\n" % (instruction_id_name(instruction), method_name(instruction["name"]))
-        body += "        default: break;\n"
-        body += "    }\n"
+        body += "    execute(getHandler(ins), ins);\n"
         body += "}\n\n"
         fd.write(body)
 
@@ -250,6 +415,12 @@ def create_interpreter(interpreter_name_h, interpreter_name_cpp, symbols_file):
 
                 body += indent(code)
 
+            # Defer the computation of the condition flags until they are read.
+            body = lazy_flags(body)
+
+            # Leave at the first faulting access with the registers untouched.
+            body, declarations = precise_faults(body)
+
             # TODO: Do the proper thing.
             for var in translator.define_me:
                 type_ = "int"
@@ -258,7 +429,10 @@ def create_interpreter(interpreter_name_h, interpreter_name_cpp, symbols_file):
 
                 fd.write("    %s %s = 0;\n" % (type_, var))
 
-            if len(translator.define_me):
+            for declaration in declarations:
+                fd.write("    %s\n" % declaration)
+
+            if len(translator.define_me) or len(declarations):
                 fd.write("\n")
 
             # Write the translated body.
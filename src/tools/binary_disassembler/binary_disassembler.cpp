@@ -0,0 +1,77 @@
+/*
+ * binary_disassembler.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#include <chrono>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <iostream>
+
+#include "AbstractBinary.h"
+#include "macho/MachoBinary.h"
+#include "arm/ARMDisassembler.h"
+#include "arm/ARMParallelDisassembler.h"
+
+using namespace std;
+using namespace Disassembler;
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        cerr << "Usage: ./" << argv[0] << " <file_path> [thumb|arm] [n_threads] [cache_entries]" << endl;
+        return -1;
+    }
+
+    string filename { argv[1] };
+    ARMMode mode = (argc > 2 && string(argv[2]) == "arm") ? ARMMode_ARM : ARMMode_Thumb;
+    unsigned n_threads = argc > 3 ? std::stoul(argv[3]) : 0;
+    size_t cache_entries = argc > 4 ? std::stoul(argv[4]) : 0;
+
+    // Get an instance for the correct binary type.
+    AbstractBinary *binary = AbstractBinary::create(filename);
+    if (!binary) {
+        cerr << "Could not open binary" << endl;
+        return -1;
+    }
+
+    // Load the contents of the file.
+    if (!binary->load(filename)) {
+        cerr << "Could not load mach-o binary" << endl;
+        return -1;
+    }
+
+    // Load the binary.
+    if (!binary->init()) {
+        cerr << "Could not initialize mach-o binary" << endl;
+        binary->unload();
+        return -1;
+    }
+
+    ARMParallelDisassembler dis { ARMv7All, n_threads, cache_entries };
+
+    for (AbstractBinary *cur : binary->binaries()) {
+        auto macho = dynamic_cast<MachoBinary *>(cur);
+        if (!macho || macho->getBinaryArch() != BinaryArch::ARM)
+            continue;
+
+        // The workers format the listing too, repeated encodings take their text from the cache.
+        auto start = chrono::steady_clock::now();
+        string listing;
+        size_t count = dis.list(ARMParallelDisassembler::split(*macho, mode), listing);
+        auto elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        fwrite(listing.data(), 1, listing.size(), stdout);
+
+        cerr << "Disassembled " << count << " instructions in " << elapsed << " seconds" << endl;
+        if (cache_entries) {
+            cerr << "Decode cache: " << dis.cacheHits() << " hits, " << dis.cacheMisses() << " misses, "
+                << dis.cacheTextHits() << " text hits, " << dis.cacheTextMisses() << " text misses" << endl;
+        }
+    }
+
+    binary->unload();
+    return 0;
+}
@@ -15,7 +15,7 @@ using namespace std;
 using namespace Disassembler;
 
 int main(int argc, char **argv) {
-    if (argc < 2) {
+    if (argc < 3) {
         cerr << "Usage: ./%s [thumb|arm] <hex_opcode>" << endl;
         return -1;
     }
@@ -29,15 +29,25 @@ int main(int argc, char **argv) {
     if (arg_mode == "thumb") {
         mode = ARMMode_Thumb;
         cout << "Using mode THUMB" << endl;
-
-        if (opcode > 0xffff) {
-            opcode = (opcode >> 16) | ((opcode << 16) & 0xffffffff);
-        }
     }
 
+    // The opcode is given as it would be read from memory, let the disassembler deal with the
+    // Thumb instruction width and halfword order.
+    uint8_t buffer[4] = {
+        static_cast<uint8_t>(opcode), static_cast<uint8_t>(opcode >> 8),
+        static_cast<uint8_t>(opcode >> 16), static_cast<uint8_t>(opcode >> 24)
+    };
+
+    size_t size = (mode == ARMMode_Thumb && !IsThumb32(opcode & 0xffff)) ? 2 : 4;
+
     ARMDisassembler dis { ARMv7All };
-    ARMInstruction ins = dis.disassemble(opcode, mode);
-    cout << "Disassembled instruction: " << (void *) opcode << " -> " << ins.toString() << endl;
+    ARMInstruction ins;
+    if (!dis.disassemble(buffer, size, 0, mode, &ins, 1)) {
+        cerr << "Incomplete instruction: " << (void *) opcode << endl;
+        return -1;
+    }
+
+    cout << "Disassembled instruction: " << (void *) ins.opcode << " -> " << ins.toString() << endl;
 
     return 0;
 }
@@ -7,6 +7,7 @@
 
 #include "arm/ARMArch.h"
 #include "arm/ARMEmulator.h"
+#include "arm/ARMTraceWriter.h"
 #include "arm/ARMDisassembler.h"
 #include "memory/Memory.h"
 
@@ -22,7 +23,7 @@ using namespace Disassembler;
 
 int main(int argc, char **argv) {
 	if (argc < 2) {
-		cerr << "Usage: ./%s [thumb|arm] <hex_opcode>" << endl;
+		cerr << "Usage: ./%s [thumb|arm] <hex_opcode> [<trace_file>]" << endl;
 		return -1;
 	}
 
@@ -35,7 +36,7 @@ int main(int argc, char **argv) {
 
 	// Create a concrete memory map.
 	ConcreteMemory memory { };
-	if (!memory.map(0xcafe0000, 0x1000, 0)) {
+	if (!memory.map(0xcafe0000, 0x1000, PROT_READ | PROT_WRITE | PROT_EXEC)) {
 		cerr << "Failed mapping address." << endl;
 		return -1;
 	}
@@ -56,7 +57,19 @@ int main(int argc, char **argv) {
 
 	// Create an emulator and link the memory and context
 	ARMEmulator emu { &context, &memory, mode };
+
+	// Optionally record a binary trace of the execution.
+	ARMTraceWriter trace;
+	if (argc > 3) {
+		if (!trace.open(argv[3])) {
+			return -1;
+		}
+
+		emu.addObserver(&trace);
+	}
+
 	emu.start(5);
+	context.dump();
 
 	return 0;
 }
@@ -0,0 +1,133 @@
+/*
+ * FixedString.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_UTILITIES_FIXEDSTRING_H_
+#define SRC_UTILITIES_FIXEDSTRING_H_
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// String with a fixed capacity that lives wherever the object lives, usually the stack.
+// Anything that does not fit in the capacity is truncated so building text with it never
+// touches the heap.
+template <size_t N> class FixedString {
+public:
+    static_assert(N > 1, "FixedString needs room for at least one character");
+
+    FixedString() :
+        m_size(0) {
+        m_data[0] = '\0';
+    }
+
+    FixedString(const char *str) :
+        FixedString() {
+        append(str);
+    }
+
+    FixedString(const char *str, size_t length) :
+        FixedString() {
+        append(str, length);
+    }
+
+    template <size_t M> FixedString(const FixedString<M> &other) :
+        FixedString() {
+        append(other.c_str(), other.size());
+    }
+
+    FixedString &operator=(const char *str) {
+        clear();
+        return append(str);
+    }
+
+    FixedString &append(const char *str, size_t length) {
+        length = std::min(length, N - 1 - m_size);
+        memcpy(m_data + m_size, str, length);
+        m_size += length;
+        m_data[m_size] = '\0';
+        return *this;
+    }
+
+    FixedString &append(const char *str) {
+        return append(str, strlen(str));
+    }
+
+    FixedString &appendf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(m_data + m_size, N - m_size, format, args);
+        va_end(args);
+
+        if (written > 0)
+            m_size = std::min(m_size + written, N - 1);
+
+        return *this;
+    }
+
+    FixedString &operator+=(const char *str) {
+        return append(str);
+    }
+
+    FixedString &operator+=(char c) {
+        return append(&c, 1);
+    }
+
+    template <size_t M> FixedString &operator+=(const FixedString<M> &other) {
+        return append(other.c_str(), other.size());
+    }
+
+    void clear() {
+        m_size = 0;
+        m_data[0] = '\0';
+    }
+
+    const char *c_str() const {
+        return m_data;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    std::string str() const {
+        return std::string(m_data, m_size);
+    }
+
+    bool operator==(const char *str) const {
+        return strcmp(m_data, str) == 0;
+    }
+
+    bool operator!=(const char *str) const {
+        return strcmp(m_data, str) != 0;
+    }
+
+private:
+    char m_data[N];
+    size_t m_size;
+};
+
+template <size_t N> FixedString<N> operator+(FixedString<N> lhs, const char *rhs) {
+    return lhs += rhs;
+}
+
+template <size_t N, size_t M> FixedString<N> operator+(FixedString<N> lhs, const FixedString<M> &rhs) {
+    return lhs += rhs;
+}
+
+template <size_t N> FixedString<N> operator+(const char *lhs, const FixedString<N> &rhs) {
+    FixedString<N> result(lhs);
+    return result += rhs;
+}
+
+#endif /* SRC_UTILITIES_FIXEDSTRING_H_ */
@@ -9,6 +9,7 @@
 #define SRC_UTILITIES_MEMORYMAP_H_
 
 #include <cstdint>
+#include <limits>
 
 class MemoryMap {
 private:
@@ -0,0 +1,147 @@
+/*
+ * ThreadPool.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: anon
+ */
+
+#ifndef SRC_UTILITIES_THREADPOOL_H_
+#define SRC_UTILITIES_THREADPOOL_H_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed size pool of worker threads with one task queue per worker. Workers take tasks
+// from the front of their own queue and, once it is empty, steal from the back of the
+// queues of the other workers so uneven batches still keep every core busy.
+class ThreadPool {
+public:
+    // Task body, receives the task index and the index of the worker running it.
+    using Task = std::function<void(size_t task, unsigned worker)>;
+
+    explicit ThreadPool(unsigned n_workers = 0) {
+        if (!n_workers)
+            n_workers = std::max(1u, std::thread::hardware_concurrency());
+
+        for (unsigned i = 0; i < n_workers; i++)
+            m_queues.emplace_back(new Queue());
+
+        for (unsigned i = 0; i < n_workers; i++)
+            m_workers.emplace_back(&ThreadPool::worker, this, i);
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+
+        m_work_available.notify_all();
+        for (auto &worker : m_workers)
+            worker.join();
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    unsigned size() const {
+        return static_cast<unsigned>(m_workers.size());
+    }
+
+    // Run 'body' for every task in [0, n_tasks) and wait for all of them to finish.
+    void run(size_t n_tasks, const Task &body) {
+        if (!n_tasks)
+            return;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_body = &body;
+        m_pending = n_tasks;
+
+        // Deal the tasks in contiguous blocks so neighbouring tasks start on the same worker.
+        size_t per_worker = (n_tasks + m_queues.size() - 1) / m_queues.size();
+        for (size_t i = 0; i < n_tasks; i++) {
+            Queue &queue = *m_queues[i / per_worker];
+            std::lock_guard<std::mutex> queue_lock(queue.mutex);
+            queue.tasks.push_back(i);
+        }
+
+        m_generation++;
+        m_work_available.notify_all();
+        m_work_done.wait(lock, [this] { return m_pending == 0; });
+        m_body = nullptr;
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    bool pop(unsigned worker, size_t &task) {
+        Queue &own = *m_queues[worker];
+        {
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = own.tasks.front();
+                own.tasks.pop_front();
+                return true;
+            }
+        }
+
+        for (size_t i = 1; i < m_queues.size(); i++) {
+            Queue &victim = *m_queues[(worker + i) % m_queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = victim.tasks.back();
+                victim.tasks.pop_back();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void worker(unsigned index) {
+        size_t seen_generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_work_available.wait(lock, [&] { return m_stop || m_generation != seen_generation; });
+                if (m_stop)
+                    return;
+
+                seen_generation = m_generation;
+            }
+
+            // A popped task keeps its batch alive, so 'm_body' is the one it was queued with.
+            size_t task;
+            while (pop(index, task)) {
+                (*m_body)(task, index);
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_pending == 0)
+                    m_work_done.notify_all();
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_work_available;
+    std::condition_variable m_work_done;
+    const Task *m_body = nullptr;
+    size_t m_pending = 0;
+    size_t m_generation = 0;
+    bool m_stop = false;
+};
+
+#endif /* SRC_UTILITIES_THREADPOOL_H_ */
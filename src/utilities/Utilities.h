@@ -17,6 +17,8 @@
 #include <cmath>
 #include <algorithm>
 
+#include "FixedString.h"
+
 #define likely(x)      __builtin_expect(!!(x), 1)
 #define unlikely(x)    __builtin_expect(!!(x), 0)
 
@@ -55,30 +57,42 @@ inline std::string exec_get_output(std::string cmd) {
     return result;
 }
 
-inline std::string integer_to_string(unsigned long long val, bool hexa = true) {
-	std::stringstream ss;
+inline FixedString<32> integer_to_string(unsigned long long val, bool hexa = true) {
+	FixedString<32> str;
 	if (hexa) {
-		ss << std::hex << "0x";
+		str.appendf("0x%llx", val);
 	} else {
-		ss << std::dec;
+		str.appendf("%llu", val);
 	}
 
-	ss << val;
-	return ss.str();
+	return str;
 }
 
-inline uint32_t NOT(uint32_t val, uint32_t bits) {
+constexpr uint32_t NOT(uint32_t val, uint32_t bits) {
 	return (~val) & ((1 << bits) - 1);
 }
 
-inline uint32_t get_bits(uint32_t val, uint32_t msb, uint32_t lsb) {
+constexpr uint32_t get_bits(uint32_t val, uint32_t msb, uint32_t lsb) {
 	return (val >> lsb) & ((1 << (msb - lsb + 1)) - 1);
 }
 
-inline uint32_t get_bit(uint32_t val, uint32_t lsb) {
+constexpr uint32_t get_bit(uint32_t val, uint32_t lsb) {
 	return (val >> lsb) & 1;
 }
 
+// Bit field <hi:lo> of an opcode with the shift and mask fixed at compile time, so the
+// extraction folds into a single shift and mask (or less) at every use.
+template <unsigned hi, unsigned lo> struct Field {
+	static_assert(hi < 32 && lo <= hi, "Invalid bit field");
+
+	static constexpr unsigned shift = lo;
+	static constexpr uint32_t mask = (hi - lo == 31) ? 0xffffffff : ((1u << (hi - lo + 1)) - 1);
+
+	static constexpr uint32_t get(uint32_t opcode) {
+		return (opcode >> shift) & mask;
+	}
+};
+
 inline void set_bits(uint32_t &out, uint32_t msb, uint32_t lsb, uint64_t val) {
 	uint32_t lo_val = ((1 << lsb) - 1) & out;
 	uint32_t hi_val = (out >> (msb + 1)) << (msb + 1);
@@ -99,7 +113,7 @@ inline void set_bit(int &number, uint32_t n, uint32_t x) {
 	number ^= (-x ^ number) & (1 << n);
 }
 
-inline uint32_t UInt(uint32_t val) {
+constexpr uint32_t UInt(uint32_t val) {
 	return val;
 }
 
@@ -188,7 +202,7 @@ inline uint32_t Rotl32(uint32_t bits, uint32_t amt) {
 	return (bits << amt) | (bits >> ((32 - amt) & 31));
 }
 
-inline uint32_t Concatenate(uint32_t val_1, uint32_t val_2, uint32_t val_2_size) {
+constexpr uint32_t Concatenate(uint32_t val_1, uint32_t val_2, uint32_t val_2_size) {
 	return (val_1 << val_2_size) | val_2;
 }
 
@@ -0,0 +1,184 @@
+#include <arm/ARMDisassembler.h>
+#include <arm/ARMParallelDisassembler.h>
+#include <arm/gen/ARMDecodingTable.h>
+#include <macho/MachoBinary.h>
+#include <AbstractBinary.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Utilities.h"
+#include "test_utils.h"
+
+using namespace std;
+using namespace Disassembler;
+
+// Every measurement is repeated this many times and the fastest run is kept.
+static const unsigned ROUNDS = 5;
+
+struct Timing {
+	double decode_ns;
+	double format_ns;
+};
+
+// Time decoding (and decoding plus formatting) of 'opcodes', in nanoseconds per instruction.
+static Timing time_stream(const ARMDisassembler &dis, const vector<uint32_t> &opcodes, ARMMode mode) {
+	Timing timing { 1e100, 1e100 };
+	ARMDecoderContext ctx(mode);
+	char buffer[256];
+	size_t sink = 0;
+
+	for (unsigned round = 0; round < ROUNDS; ++round) {
+		auto start = chrono::steady_clock::now();
+		for (auto opcode : opcodes) {
+			sink += dis.disassemble(ctx, opcode).id;
+		}
+
+		auto middle = chrono::steady_clock::now();
+		for (auto opcode : opcodes) {
+			sink += dis.disassemble(ctx, opcode).format(buffer, sizeof(buffer));
+		}
+
+		auto end = chrono::steady_clock::now();
+		timing.decode_ns = min(timing.decode_ns, chrono::duration<double, nano>(middle - start).count() / opcodes.size());
+		timing.format_ns = min(timing.format_ns, chrono::duration<double, nano>(end - middle).count() / opcodes.size());
+	}
+
+	// Keep the loops from being optimized away.
+	if (sink == 1)
+		printf(" ");
+
+	return timing;
+}
+
+static void print_summary(const char *name, size_t count, const Timing &timing) {
+	printf("%-8s %10zu instructions  decode: %8.1f ns/ins %8.2f Mins/s  decode+format: %8.1f ns/ins %8.2f Mins/s\n",
+		name, count,
+		timing.decode_ns, 1e3 / timing.decode_ns,
+		timing.format_ns, 1e3 / timing.format_ns);
+}
+
+// Synthetic streams: 'n' random instances of every table entry, timed per encoding.
+static void benchmark_table(const ARMDisassembler &dis, ARMOpcode *table, size_t n_entries, ARMMode mode, unsigned n) {
+	const char *mode_name = mode == ARMMode_ARM ? "ARM" : "THUMB";
+	printf("# Per encoding throughput, %s, %u instructions per encoding\n", mode_name, n);
+	printf("# %-5s %-48s %-4s %12s %12s %s\n", "index", "name", "enc", "decode_ns", "format_ns", "histogram (decode)");
+
+	vector<uint32_t> all;
+	vector<pair<double, size_t>> slowest;
+
+	// The last entry is the catch all 'decode_unknown'.
+	for (size_t i = 0; i + 1 < n_entries; ++i) {
+		uint32_t size = table[i].ins_size == eSize16 ? 16 : 32;
+
+		vector<uint32_t> opcodes;
+		for (unsigned j = 0; j < n; ++j) {
+			uint32_t opcode = get_masked_random(table[i].mask, table[i].value, size);
+
+			// We avoid generating condition codes of 0b1111.
+			if (mode == ARMMode_ARM && get_bit(table[i].mask, 28) == 0) {
+				opcode &= 0xefffffff;
+			}
+
+			opcodes.push_back(opcode);
+		}
+
+		Timing timing = time_stream(dis, opcodes, mode);
+		all.insert(all.end(), opcodes.begin(), opcodes.end());
+		slowest.emplace_back(timing.decode_ns, i);
+
+		string bar(min<size_t>(60, static_cast<size_t>(timing.decode_ns / 5)), '#');
+		printf("  %-5zu %-48s %-4s %12.1f %12.1f %s\n", i, table[i].name, ARMEncodingToString(table[i].encoding),
+			timing.decode_ns, timing.format_ns, bar.c_str());
+	}
+
+	sort(slowest.rbegin(), slowest.rend());
+	printf("# Slowest %s encodings\n", mode_name);
+	for (size_t i = 0; i < min<size_t>(10, slowest.size()); ++i) {
+		printf("  %-5zu %-48s %12.1f\n", slowest[i].second, table[slowest[i].second].name, slowest[i].first);
+	}
+
+	// Mix all the encodings in a single stream so the dispatch sees no locality.
+	shuffle(all.begin(), all.end(), mt19937());
+	print_summary(mode_name, all.size(), time_stream(dis, all, mode));
+	printf("\n");
+}
+
+// Real code: every executable segment of the binary, decoded as a whole.
+static void benchmark_binary(const ARMDisassembler &dis, const string &path, ARMMode mode) {
+	AbstractBinary *binary = AbstractBinary::create(path);
+	if (!binary || !binary->load(path) || !binary->init()) {
+		printf("Could not load binary '%s'\n", path.c_str());
+		return;
+	}
+
+	for (AbstractBinary *cur : binary->binaries()) {
+		auto macho = dynamic_cast<MachoBinary *>(cur);
+		if (!macho || macho->getBinaryArch() != BinaryArch::ARM)
+			continue;
+
+		vector<ARMCodeChunk> chunks = ARMParallelDisassembler::split(*macho, mode);
+		vector<ARMInstruction> instructions;
+		for (const auto &chunk : chunks) {
+			size_t offset = instructions.size();
+			instructions.resize(offset + chunk.size / 2);
+			instructions.resize(offset + dis.disassemble(chunk.data, chunk.size, chunk.address, chunk.mode,
+				instructions.data() + offset, chunk.size / 2));
+		}
+
+		// Replay the decoded opcodes so the measurement only covers the decoder.
+		vector<uint32_t> opcodes;
+		vector<size_t> histogram(n_arm_decoder_info);
+		for (const auto &ins : instructions) {
+			opcodes.push_back(ins.opcode);
+			histogram[ins.m_decoder]++;
+		}
+
+		printf("# Real code from '%s' (%s)\n", path.c_str(), mode == ARMMode_ARM ? "ARM" : "THUMB");
+		print_summary(mode == ARMMode_ARM ? "ARM" : "THUMB", opcodes.size(), time_stream(dis, opcodes, mode));
+
+		vector<pair<size_t, size_t>> frequent;
+		for (size_t i = 0; i < histogram.size(); ++i) {
+			if (histogram[i])
+				frequent.emplace_back(histogram[i], i);
+		}
+
+		sort(frequent.rbegin(), frequent.rend());
+		printf("# Most frequent decoders\n");
+		for (size_t i = 0; i < min<size_t>(20, frequent.size()); ++i) {
+			const char *name = arm_decoder_info[frequent[i].second].name;
+			double share = 100.0 * frequent[i].first / opcodes.size();
+			string bar(static_cast<size_t>(share / 2), '#');
+			printf("  %-48s %10zu %6.2f%% %s\n", name ? name : "(invalid)", frequent[i].first, share, bar.c_str());
+		}
+
+		printf("\n");
+	}
+
+	binary->unload();
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		printf("Usage: %s <iterations> [<binary> [thumb|arm]]\n", argv[0]);
+		printf("  <iterations>: Number of random instances generated for every encoding.\n");
+		printf("  <binary>:     Optional Mach-O file whose code is also measured.\n");
+		return -1;
+	}
+
+	unsigned n = std::stoi(argv[1]);
+	ARMDisassembler dis(ARMvAll);
+
+	benchmark_table(dis, arm_opcodes, n_arm_opcodes, ARMMode_ARM, n);
+	benchmark_table(dis, thumb_opcodes, n_thumb_opcodes, ARMMode_Thumb, n);
+
+	if (argc > 2) {
+		ARMMode mode = (argc > 3 && string(argv[3]) == "arm") ? ARMMode_ARM : ARMMode_Thumb;
+		benchmark_binary(dis, argv[2], mode);
+	}
+
+	return 0;
+}
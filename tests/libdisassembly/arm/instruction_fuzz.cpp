@@ -73,7 +73,7 @@ string darm_disassemble(uint32_t opcode, unsigned mode) {
 string retools_disassemble(uint32_t opcode, unsigned mode, string &decoder) {
 	ARMDisassembler dis(ARMvAll);
 	ARMInstruction ins = dis.disassemble(opcode, mode == 0 ? ARMMode_ARM : ARMMode_Thumb);
-	decoder = ins.m_decoded_by;
+	decoder = ins.decoderName() ? ins.decoderName() : "";
 	return ins.toString();
 }
 
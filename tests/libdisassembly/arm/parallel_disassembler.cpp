@@ -0,0 +1,287 @@
+#include <arm/ARMDisassembler.h>
+#include <arm/ARMParallelDisassembler.h>
+#include <macho/MachoBinary.h>
+#include <mach/machine.h>
+#include <abstract/Segment.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace Disassembler;
+
+static const uint32_t PAGE = 0x1000;
+static const uint32_t TEXT_ADDRESS = 0x4000;
+
+template<typename T> static void append(vector<uint8_t> &data, const T &value) {
+	const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+	data.insert(data.end(), bytes, bytes + sizeof(value));
+}
+
+static void append_uleb(vector<uint8_t> &data, uint64_t value) {
+	do {
+		uint8_t byte = value & 0x7f;
+		value >>= 7;
+		data.push_back(value ? byte | 0x80 : byte);
+	} while (value);
+}
+
+// Thumb code with a mix of 16 and 32 bit instructions and IT blocks, so decoding from a wrong
+// halfword gets out of sync with the real instruction boundaries.
+static vector<uint8_t> make_thumb_function(mt19937 &rng, unsigned length) {
+	static const uint16_t narrow[] = { 0x4608, 0x1c48, 0x3001, 0x2800, 0x6808, 0x6048 };
+
+	vector<uint16_t> code { 0xb5f0, 0xaf03 };
+	for (unsigned i = 0; i < length; ++i) {
+		code.push_back(narrow[rng() % 6]);
+		if (i % 7 == 0)
+			code.insert(code.end(), { 0xf140, 0x0000 });
+
+		if (i % 11 == 0)
+			code.insert(code.end(), { 0xbf08, 0x1c08, 0x1c08 });
+	}
+
+	code.push_back(0xbdf0);
+
+	// Keep the next function word aligned.
+	if (code.size() % 2)
+		code.push_back(0xbf00);
+
+	vector<uint8_t> data;
+	for (auto halfword : code)
+		append(data, halfword);
+
+	return data;
+}
+
+static vector<uint8_t> make_arm_function(mt19937 &rng, unsigned length) {
+	static const uint32_t opcodes[] = { 0xe1a00001, 0xe2800001, 0xe3500000, 0xe5910000, 0x0a000000 };
+
+	vector<uint32_t> code { 0xe92d4070 };
+	for (unsigned i = 0; i < length; ++i)
+		code.push_back(opcodes[rng() % 5]);
+
+	code.push_back(0xe8bd8070);
+
+	vector<uint8_t> data;
+	for (auto word : code)
+		append(data, word);
+
+	return data;
+}
+
+// A 32 bit ARM Mach-O with a single __TEXT segment of alternating Thumb and ARM functions, one of
+// them a long Thumb one, and an LC_FUNCTION_STARTS list where the starts of the Thumb functions
+// have the low bit set, like ld64 emits them.
+static vector<uint8_t> make_binary(unsigned n_functions, vector<uint32_t> &starts) {
+	mt19937 rng;
+	vector<uint8_t> code;
+	for (unsigned i = 0; i < n_functions; ++i) {
+		bool thumb = i % 2 == 0;
+		starts.push_back((TEXT_ADDRESS + PAGE + code.size()) | thumb);
+
+		unsigned length = i == n_functions / 2 ? 2000 : 40;
+		vector<uint8_t> function = thumb ? make_thumb_function(rng, length) : make_arm_function(rng, length);
+		code.insert(code.end(), function.begin(), function.end());
+	}
+
+	uint32_t text_size = (PAGE + code.size() + PAGE - 1) & ~(PAGE - 1);
+
+	vector<uint8_t> function_starts;
+	uint64_t previous = 0;
+	for (auto start : starts) {
+		uint64_t offset = start - TEXT_ADDRESS;
+		append_uleb(function_starts, offset - previous);
+		previous = offset;
+	}
+
+	function_starts.resize((function_starts.size() + 4) & ~3, 0);
+
+	segment_command text {};
+	text.cmd = LC_SEGMENT;
+	text.cmdsize = sizeof(segment_command) + sizeof(section);
+	strncpy(text.segname, "__TEXT", sizeof(text.segname));
+	text.vmaddr = TEXT_ADDRESS;
+	text.vmsize = text_size;
+	text.filesize = text_size;
+	text.maxprot = text.initprot = VM_PROT_READ | VM_PROT_EXECUTE;
+	text.nsects = 1;
+
+	section text_section {};
+	strncpy(text_section.sectname, "__text", sizeof(text_section.sectname));
+	strncpy(text_section.segname, "__TEXT", sizeof(text_section.segname));
+	text_section.addr = TEXT_ADDRESS + PAGE;
+	text_section.size = code.size();
+	text_section.offset = PAGE;
+	text_section.align = 1;
+	text_section.flags = S_ATTR_PURE_INSTRUCTIONS | S_ATTR_SOME_INSTRUCTIONS;
+
+	segment_command linkedit {};
+	linkedit.cmd = LC_SEGMENT;
+	linkedit.cmdsize = sizeof(segment_command);
+	strncpy(linkedit.segname, "__LINKEDIT", sizeof(linkedit.segname));
+	linkedit.vmaddr = TEXT_ADDRESS + text_size;
+	linkedit.vmsize = PAGE;
+	linkedit.fileoff = text_size;
+	linkedit.filesize = function_starts.size();
+	linkedit.maxprot = linkedit.initprot = VM_PROT_READ;
+
+	linkedit_data_command starts_command {};
+	starts_command.cmd = LC_FUNCTION_STARTS;
+	starts_command.cmdsize = sizeof(linkedit_data_command);
+	starts_command.dataoff = text_size;
+	starts_command.datasize = function_starts.size();
+
+	mach_header header {};
+	header.magic = MH_MAGIC;
+	header.cputype = CPU_TYPE_ARM;
+	header.cpusubtype = CPU_SUBTYPE_ARM_V7;
+	header.filetype = MH_EXECUTE;
+	header.ncmds = 3;
+	header.sizeofcmds = text.cmdsize + linkedit.cmdsize + starts_command.cmdsize;
+
+	vector<uint8_t> data;
+	append(data, header);
+	append(data, text);
+	append(data, text_section);
+	append(data, linkedit);
+	append(data, starts_command);
+	data.resize(PAGE, 0);
+	data.insert(data.end(), code.begin(), code.end());
+	data.resize(text_size, 0);
+	data.insert(data.end(), function_starts.begin(), function_starts.end());
+	return data;
+}
+
+static bool same(const vector<ARMInstruction> &a, const vector<ARMInstruction> &b) {
+	if (a.size() != b.size())
+		return false;
+
+	for (size_t i = 0; i < a.size(); ++i) {
+		if (a[i].address != b[i].address || a[i].opcode != b[i].opcode || a[i].id != b[i].id)
+			return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char **argv) {
+	unsigned n_functions = argc > 1 ? std::stoi(argv[1]) : 500;
+
+	vector<uint32_t> starts;
+	vector<uint8_t> data = make_binary(n_functions, starts);
+
+	MachoBinary binary;
+	if (!binary.load(data.data(), data.size()) || !binary.init()) {
+		printf("FAIL: could not load the generated binary\n");
+		return 1;
+	}
+
+	unsigned failures = 0;
+
+	vector<uint64_t> parsed = binary.getFunctionStarts();
+	if (parsed != vector<uint64_t>(starts.begin(), starts.end())) {
+		printf("FAIL: function starts keep the Thumb bit\n");
+		failures++;
+	}
+
+	// Chunks small enough for the long Thumb function to be cut in many places.
+	const size_t max_chunk_size = 0x100;
+	vector<ARMCodeChunk> chunks = ARMParallelDisassembler::split(binary, ARMMode_Thumb, max_chunk_size);
+
+	auto function_at = [&starts] (uint32_t address) {
+		auto it = upper_bound(starts.begin(), starts.end(), address | 1);
+		return it == starts.begin() ? 0 : *(it - 1);
+	};
+
+	size_t thumb_cuts = 0;
+	for (const auto &chunk : chunks) {
+		uint32_t function = function_at(chunk.address);
+		ARMMode mode = !function || (function & 1) ? ARMMode_Thumb : ARMMode_ARM;
+		if (chunk.mode != mode || chunk.address & (mode == ARMMode_ARM ? 3 : 1)) {
+			printf("FAIL: chunk at 0x%.8x decoded in the wrong mode\n", chunk.address);
+			failures++;
+			break;
+		}
+
+		if (chunk.size > max_chunk_size + 2) {
+			printf("FAIL: chunk at 0x%.8x is 0x%zx bytes long\n", chunk.address, chunk.size);
+			failures++;
+			break;
+		}
+
+		thumb_cuts += mode == ARMMode_Thumb && chunk.address != (function & ~1);
+	}
+
+	if (thumb_cuts < 10) {
+		printf("FAIL: the long Thumb function was not split\n");
+		failures++;
+	}
+
+	// Every function decoded on its own in the mode of its start is the reference, the code
+	// before the first one is decoded in the default mode.
+	vector<ARMInstruction> expected;
+	ARMDisassembler dis(ARMvAll);
+	for (const auto &segment : binary.getSegments()) {
+		if (!segment.isExecutable())
+			continue;
+
+		uint32_t segment_end = segment.getAddress() + min<uint64_t>(segment.getSize(), segment.getInFileSize());
+		vector<uint32_t> bounds { static_cast<uint32_t>(segment.getAddress()) | 1 };
+		bounds.insert(bounds.end(), starts.begin(), starts.end());
+		bounds.push_back(segment_end);
+
+		for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+			uint32_t start = bounds[i] & ~1, end = bounds[i + 1] & ~1;
+			vector<ARMInstruction> function((end - start) / 2);
+			function.resize(dis.disassemble(segment.getData() + (start - segment.getAddress()), end - start, start,
+				bounds[i] & 1 ? ARMMode_Thumb : ARMMode_ARM, function.data(), function.size()));
+			expected.insert(expected.end(), function.begin(), function.end());
+		}
+	}
+
+	for (unsigned n_threads : { 1, 4 }) {
+		ARMParallelDisassembler parallel(ARMvAll, n_threads);
+		if (!same(parallel.disassemble(chunks), expected)) {
+			printf("FAIL: %u worker(s) do not match the sequential decoding\n", n_threads);
+			failures++;
+		}
+
+		if (!same(parallel.disassemble(binary, ARMMode_Thumb), expected)) {
+			printf("FAIL: %u worker(s) with the default chunks do not match the sequential decoding\n", n_threads);
+			failures++;
+		}
+	}
+
+	// The listing formatted by the workers, with and without taking the text from the cache.
+	string expected_listing;
+	char line[300];
+	for (const auto &ins : expected) {
+		char text[256];
+		ins.format(text, sizeof(text));
+		snprintf(line, sizeof(line), "0x%.8x: %s\n", ins.address, text);
+		expected_listing += line;
+	}
+
+	for (size_t cache_entries : { 0, 1024 }) {
+		ARMParallelDisassembler parallel(ARMvAll, 4, cache_entries);
+		string listing;
+		if (parallel.list(chunks, listing) != expected.size() || listing != expected_listing) {
+			printf("FAIL: listing with a %zu entry cache does not match the formatted instructions\n", cache_entries);
+			failures++;
+		}
+
+		if (cache_entries && (!parallel.cacheTextHits() || parallel.cacheTextHits() + parallel.cacheTextMisses() != expected.size())) {
+			printf("FAIL: %zu text hits, %zu text misses\n", parallel.cacheTextHits(), parallel.cacheTextMisses());
+			failures++;
+		}
+	}
+
+	printf("%u functions, %zu chunks, %zu instructions, %u failure(s)\n", n_functions, chunks.size(),
+		expected.size(), failures);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+#include <arm/ARMEmulator.h>
+#include <memory/Memory.h>
+#include <array>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+using namespace Memory;
+using namespace Register;
+using namespace Emulator;
+
+static const uintptr_t CODE_ADDRESS = 0x10000;
+static const uintptr_t DATA_ADDRESS = 0x20000;
+static const uint32_t DATA_VALUE = 0x12345678;
+
+// Flags setting encodings that do not set them inside an IT block:
+//
+//   cmp r0, r0        Z = 1
+//   ittt eq
+//   add(s) r0, #1     inside the IT block, Z stays set
+//   <second>
+//   add(s) r2, #1     last in the IT block, Z stays set
+//   movs r3, #0       end
+static const uint16_t CMP = 0x4280;
+static const uint16_t ITTT_EQ = 0xbf02;
+static const uint16_t ADD_R0 = 0x3001;
+static const uint16_t LDR_R1_R1 = 0x6809;
+static const uint16_t STR_R5_R4 = 0x6025;
+static const uint16_t ADD_R2 = 0x3201;
+static const uint16_t MOVS_R3 = 0x2300;
+
+enum Exit {
+	Exit_None,
+	Exit_Count,
+	Exit_Stop,
+	Exit_Fault,
+	Exit_CodeWrite,
+	Exit_PageEnd
+};
+
+struct Case {
+	const char *name;
+	Exit exit;
+};
+
+static const Case cases[] = {
+	{ "straight", Exit_None },
+	{ "instruction count", Exit_Count },
+	{ "stop address", Exit_Stop },
+	{ "fault", Exit_Fault },
+	{ "store to the block", Exit_CodeWrite },
+	{ "page end", Exit_PageEnd },
+};
+
+static bool run_case(const Case &test) {
+	ConcreteMemory memory;
+	memory.map(CODE_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC);
+
+	// The IT block runs into a page that is only mapped once the first one faults on it.
+	uintptr_t code = test.exit == Exit_PageEnd ? CODE_ADDRESS + PAGE_SIZE - 6 : CODE_ADDRESS;
+	vector<uint16_t> program { CMP, ITTT_EQ, ADD_R0, test.exit == Exit_CodeWrite ? STR_R5_R4 : LDR_R1_R1,
+		ADD_R2, MOVS_R3 };
+
+	uintptr_t end = code + 2 * (program.size() - 1);
+	auto write_code = [&] () {
+		for (size_t i = 0; i < program.size(); ++i) {
+			memory.write_value(code + 2 * i, program[i]);
+		}
+	};
+
+	if (test.exit == Exit_PageEnd) {
+		for (size_t i = 0; i < 3; ++i) {
+			memory.write_value(code + 2 * i, program[i]);
+		}
+	} else {
+		write_code();
+	}
+
+	if (test.exit != Exit_Fault) {
+		memory.map(DATA_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE);
+		memory.write_value(DATA_ADDRESS, DATA_VALUE);
+	}
+
+	ARMContext context(&memory);
+	ARMEmulator emulator(&context, &memory, ARMMode_Thumb, ARMvAll);
+
+	array<uint32_t, ARM_REG_CORE_MAX> registers {};
+	registers[1] = DATA_ADDRESS;
+	registers[2] = 5;
+	registers[4] = code + 8;
+	registers[5] = ADD_R2 | (MOVS_R3 << 16);
+	registers[15] = code;
+	context.setCoreRegisters(registers);
+	*context.getCPSRWord() = 0x10;
+
+	bool ok = true;
+	auto check = [&ok, &test] (bool condition, const char *what) {
+		if (!condition) {
+			printf("FAIL: %s: %s\n", test.name, what);
+			ok = false;
+		}
+	};
+
+	// Leave the emulator in the middle of the IT block, right before the second instruction.
+	switch (test.exit) {
+		case Exit_Count:
+			check(emulator.runFor(3) == StopReason_Count, "did not stop after three instructions");
+			break;
+
+		case Exit_Stop:
+			check(emulator.runUntil({ static_cast<uint32_t>(code + 6) }) == StopReason_Address, "did not stop");
+			break;
+
+		case Exit_Fault:
+			check(emulator.runUntil({ static_cast<uint32_t>(end) }) == StopReason_Fault, "did not fault");
+			memory.map(DATA_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE);
+			memory.write_value(DATA_ADDRESS, DATA_VALUE);
+			break;
+
+		case Exit_PageEnd:
+			check(emulator.runUntil({ static_cast<uint32_t>(end) }) == StopReason_Fault, "did not fault");
+			memory.map(CODE_ADDRESS + PAGE_SIZE, PAGE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC);
+			write_code();
+			break;
+
+		default:
+			break;
+	}
+
+	if (test.exit != Exit_None && test.exit != Exit_CodeWrite) {
+		check(context.getCurrentInstructionAddress() == code + 6, "stopped at the wrong instruction");
+	}
+
+	// The store rewrites the rest of the block with the same bytes, which drops it while running.
+	check(emulator.runUntil({ static_cast<uint32_t>(end) }) == StopReason_Address, "did not reach the end");
+
+	auto after = context.getCoreRegisters();
+	check(after[0] == 1, "wrong r0");
+	check(after[1] == (test.exit == Exit_CodeWrite ? DATA_ADDRESS : DATA_VALUE), "wrong r1");
+	check(after[2] == 6, "wrong r2");
+	check((*context.getCPSRWord() >> 30) & 1, "an instruction inside the IT block set the flags");
+	check(context.ITSTATE.IT == 0, "ITSTATE left set after the IT block");
+	return ok;
+}
+
+int main(int argc, char **argv) {
+	unsigned failures = 0;
+	for (const auto &test : cases) {
+		failures += !run_case(test);
+	}
+
+	printf("%zu cases, %u failure(s)\n", sizeof(cases) / sizeof(cases[0]), failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,168 @@
+#include <arm/ARMDisassembler.h>
+#include <arm/ARMEmulator.h>
+#include <arm/gen/ARMDecodingTable.h>
+#include <memory/Memory.h>
+#include <array>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace Memory;
+using namespace Register;
+using namespace Emulator;
+using namespace Disassembler;
+
+static const uintptr_t CODE_ADDRESS = 0x10000;
+static const uintptr_t DATA_ADDRESS = 0x20000;
+static const size_t DATA_SIZE = 0x1000;
+
+// The instructions the JIT compiles, a branch may only end a block.
+static bool compiled(const ARMInstruction &ins) {
+	switch (ins.id) {
+		case ARMInstructionId::and_immediate:
+		case ARMInstructionId::eor_immediate:
+		case ARMInstructionId::sub_immediate_arm:
+		case ARMInstructionId::rsb_immediate:
+		case ARMInstructionId::add_immediate_arm:
+		case ARMInstructionId::tst_immediate:
+		case ARMInstructionId::teq_immediate:
+		case ARMInstructionId::cmp_immediate:
+		case ARMInstructionId::cmn_immediate:
+		case ARMInstructionId::orr_immediate:
+		case ARMInstructionId::mov_immediate:
+		case ARMInstructionId::bic_immediate:
+		case ARMInstructionId::mvn_immediate:
+		case ARMInstructionId::and_register:
+		case ARMInstructionId::eor_register:
+		case ARMInstructionId::sub_register:
+		case ARMInstructionId::rsb_register:
+		case ARMInstructionId::add_register_arm:
+		case ARMInstructionId::tst_register:
+		case ARMInstructionId::teq_register:
+		case ARMInstructionId::cmp_register:
+		case ARMInstructionId::cmn_register:
+		case ARMInstructionId::orr_register:
+		case ARMInstructionId::bic_register:
+		case ARMInstructionId::mvn_register:
+		case ARMInstructionId::mov_register_arm:
+		case ARMInstructionId::lsl_immediate:
+		case ARMInstructionId::lsr_immediate:
+		case ARMInstructionId::asr_immediate:
+		case ARMInstructionId::ror_immediate:
+		case ARMInstructionId::ldr_immediate_arm:
+		case ARMInstructionId::ldrb_immediate_arm:
+			return ins.d != 15 && ins.t != 15 && ins.n != 15 && ins.m != 15;
+
+		default:
+			return false;
+	}
+}
+
+static bool branch(const ARMInstruction &ins) {
+	return ins.id == ARMInstructionId::b || ins.id == ARMInstructionId::bl_blx_immediate;
+}
+
+// An interpreter and a JIT emulator over identical memories.
+struct Machine {
+	ConcreteMemory memory;
+	ARMContext context;
+	ARMEmulator emulator;
+
+	explicit Machine(bool jit) :
+		context(&memory), emulator(&context, &memory, ARMMode_ARM) {
+		memory.map(CODE_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC);
+		memory.map(DATA_ADDRESS, DATA_SIZE, PROT_READ | PROT_WRITE);
+		if (jit) {
+			emulator.enableJIT(0);
+		}
+	}
+};
+
+int main(int argc, char **argv) {
+	unsigned trials = argc > 1 ? std::stoi(argv[1]) : 20000;
+	unsigned seed = argc > 2 ? std::stoi(argv[2]) : 1;
+
+	mt19937 rng(seed);
+	Machine interpreter(false);
+	Machine jit(true);
+
+	for (size_t i = 0; i < DATA_SIZE; i += 4) {
+		uint32_t value = rng();
+		interpreter.memory.write_value(DATA_ADDRESS + i, value);
+		jit.memory.write_value(DATA_ADDRESS + i, value);
+	}
+
+	ARMDisassembler dis(ARMv7);
+	ARMDecoderContext decoder_context(ARMMode_ARM);
+	set<int> covered;
+	unsigned failures = 0;
+
+	for (unsigned trial = 0; trial < trials; ++trial) {
+		// A random block of always executed instructions, sometimes ended by a branch.
+		unsigned n = 1 + rng() % 16;
+		vector<uint32_t> opcodes;
+		while (opcodes.size() < n) {
+			uint32_t opcode = 0xe0000000 | (rng() & 0x0fffffff);
+			ARMInstruction ins = dis.disassemble(decoder_context, opcode);
+			if (ins.m_status != eStatusValid || !(compiled(ins) || (branch(ins) && opcodes.size() + 1 == n))) {
+				continue;
+			}
+
+			covered.insert(ins.id);
+			opcodes.push_back(opcode);
+		}
+
+		// Registers mostly point into the data page so loads succeed.
+		array<uint32_t, ARM_REG_CORE_MAX> registers {};
+		for (unsigned r = 0; r < 15; ++r) {
+			registers[r] = rng() % 3 ? DATA_ADDRESS + rng() % DATA_SIZE : rng();
+		}
+
+		registers[15] = CODE_ADDRESS;
+		uint32_t cpsr = (rng() & 0xf0000000) | 0x10;
+
+		// Stopping in the middle of a block has to leave the same state too.
+		unsigned budget = rng() % 2 ? n : 1 + rng() % n;
+
+		for (Machine *machine : { &interpreter, &jit }) {
+			for (unsigned i = 0; i < n; ++i) {
+				machine->memory.write_value(CODE_ADDRESS + i * 4, opcodes[i]);
+			}
+
+			machine->context.setCoreRegisters(registers);
+			*machine->context.getCPSRWord() = cpsr;
+			machine->emulator.start(budget);
+		}
+
+		auto expected = interpreter.context.getCoreRegisters();
+		auto actual = jit.context.getCoreRegisters();
+		uint32_t expected_cpsr = *interpreter.context.getCPSRWord();
+		uint32_t actual_cpsr = *jit.context.getCPSRWord();
+		if (expected == actual && expected_cpsr == actual_cpsr) {
+			continue;
+		}
+
+		if (failures++ < 10) {
+			printf("FAIL: trial %u, %u of %u instructions executed:\n", trial, budget, n);
+			for (auto opcode : opcodes) {
+				printf("  0x%.8x %s\n", opcode, dis.disassemble(decoder_context, opcode).toString().c_str());
+			}
+
+			for (unsigned r = 0; r < 16; ++r) {
+				if (expected[r] != actual[r]) {
+					printf("  r%u: interpreter 0x%.8x jit 0x%.8x\n", r, expected[r], actual[r]);
+				}
+			}
+
+			if (expected_cpsr != actual_cpsr) {
+				printf("  cpsr: interpreter 0x%.8x jit 0x%.8x\n", expected_cpsr, actual_cpsr);
+			}
+		}
+	}
+
+	printf("%u trials, %zu instruction kinds, %u failure(s)\n", trials, covered.size(), failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,158 @@
+#include <memory/Memory.h>
+#include <memory/SparseMemory.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace Memory;
+
+// Every measurement is repeated this many times and the fastest run is kept.
+static const unsigned ROUNDS = 5;
+
+// Time 'body' over 'n' operations, in nanoseconds per operation.
+template<typename Body> static double time_ns(size_t n, Body body) {
+	double best = 1e100;
+	for (unsigned round = 0; round < ROUNDS; ++round) {
+		auto start = chrono::steady_clock::now();
+		body();
+		auto end = chrono::steady_clock::now();
+		best = min(best, chrono::duration<double, nano>(end - start).count() / n);
+	}
+
+	return best;
+}
+
+// Lookup cost with 'n_segments' single page mappings, placed with a one page hole between them
+// so they are never merged.
+static void benchmark_lookups(unsigned n_segments, unsigned n) {
+	SegmentManager segments;
+	for (unsigned i = 0; i < n_segments; ++i) {
+		segments.addSegment(0x10000 + i * 2 * PAGE_SIZE, PAGE_SIZE, PROT_READ | PROT_WRITE);
+	}
+
+	// Random addresses over every segment, and over only a few pages so they stay in the TLB.
+	mt19937 rng;
+	vector<uintptr_t> spread, local;
+	for (unsigned i = 0; i < n; ++i) {
+		spread.push_back(0x10000 + (rng() % n_segments) * 2 * PAGE_SIZE + (rng() & PAGE_MASK));
+		local.push_back(0x10000 + (rng() % min(n_segments, 8u)) * 2 * PAGE_SIZE + (rng() & PAGE_MASK));
+	}
+
+	size_t sink = 0;
+	double find_ns = time_ns(n, [&] {
+		for (auto address : spread) {
+			sink += reinterpret_cast<uintptr_t>(segments.find(address));
+		}
+	});
+
+	double hit_ns = time_ns(n, [&] {
+		for (auto address : local) {
+			sink += reinterpret_cast<uintptr_t>(segments.translate(address, Access_Read));
+		}
+	});
+
+	double spread_ns = time_ns(n, [&] {
+		for (auto address : spread) {
+			sink += reinterpret_cast<uintptr_t>(segments.translate(address, Access_Read));
+		}
+	});
+
+	// Keep the loops from being optimized away.
+	if (sink == 1)
+		printf(" ");
+
+	string bar(min<size_t>(60, static_cast<size_t>(find_ns)), '#');
+	printf("  %8u %10.1f %10.1f %10.1f %s\n", n_segments, find_ns, hit_ns, spread_ns, bar.c_str());
+}
+
+// Cost of punching single page holes with protect and unmap into one large mapping, which
+// splits it, and of protecting them back, which merges the pieces again.
+static void benchmark_split(unsigned n_pages) {
+	ConcreteMemory memory;
+	memory.map(0x10000, n_pages * PAGE_SIZE, PROT_READ | PROT_WRITE);
+
+	double protect_ns = time_ns(n_pages / 2, [&] {
+		for (unsigned i = 0; i < n_pages; i += 2) {
+			memory.protect(0x10000 + i * PAGE_SIZE, PAGE_SIZE, PROT_READ);
+		}
+
+		for (unsigned i = 0; i < n_pages; i += 2) {
+			memory.protect(0x10000 + i * PAGE_SIZE, PAGE_SIZE, PROT_READ | PROT_WRITE);
+		}
+	});
+
+	double unmap_ns = time_ns(n_pages / 2, [&] {
+		for (unsigned i = 0; i < n_pages; i += 2) {
+			memory.unmap(0x10000 + i * PAGE_SIZE, PAGE_SIZE);
+		}
+
+		for (unsigned i = 0; i < n_pages; i += 2) {
+			memory.map(0x10000 + i * PAGE_SIZE, PAGE_SIZE, PROT_READ | PROT_WRITE);
+		}
+	});
+
+	printf("  %8u %10.1f %10.1f\n", n_pages, protect_ns, unmap_ns);
+}
+
+// Sized reads and writes over 'n_pages' pages, where SparseMemory needs no lookup at all.
+template<typename T> static double time_access(T &memory, unsigned n_pages) {
+	memory.map(0x10000, n_pages * PAGE_SIZE, PROT_READ | PROT_WRITE);
+
+	size_t n = n_pages * PAGE_SIZE / 4;
+	uint64_t value, sink = 0;
+	double ns = time_ns(2 * n, [&] {
+		for (uintptr_t address = 0x10000; address < 0x10000 + n_pages * PAGE_SIZE; address += 4) {
+			memory.readSized(address, 4, value);
+			memory.writeSized(address, 4, value + 1);
+			sink += value;
+		}
+	});
+
+	// Keep the loops from being optimized away.
+	if (sink == 1)
+		printf(" ");
+
+	return ns;
+}
+
+static void benchmark_access(unsigned n_pages) {
+	ConcreteMemory concrete;
+	SparseMemory sparse;
+	double concrete_ns = time_access(concrete, n_pages);
+	double sparse_ns = time_access(sparse, n_pages);
+	printf("  %8u %10.2f %10.2f\n", n_pages, concrete_ns, sparse_ns);
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		printf("Usage: %s <lookups>\n", argv[0]);
+		printf("  <lookups>: Number of random addresses looked up for every mapping count.\n");
+		return -1;
+	}
+
+	unsigned n = std::stoi(argv[1]);
+
+	printf("# Lookup cost in ns as the number of mappings grows\n");
+	printf("# %8s %10s %10s %10s %s\n", "mappings", "find", "tlb_hit", "tlb_spread", "histogram (find)");
+	for (unsigned n_segments = 1; n_segments <= 16384; n_segments *= 4) {
+		benchmark_lookups(n_segments, n);
+	}
+
+	printf("\n# Split and merge cost in ns per page, holes punched every other page\n");
+	printf("# %8s %10s %10s\n", "pages", "protect", "unmap+map");
+	for (unsigned n_pages = 16; n_pages <= 4096; n_pages *= 4) {
+		benchmark_split(n_pages);
+	}
+
+	printf("\n# Sized access cost in ns, ConcreteMemory against SparseMemory\n");
+	printf("# %8s %10s %10s\n", "pages", "concrete", "sparse");
+	for (unsigned n_pages = 16; n_pages <= 4096; n_pages *= 4) {
+		benchmark_access(n_pages);
+	}
+
+	return 0;
+}
@@ -0,0 +1,168 @@
+#include <arm/ARMEmulator.h>
+#include <memory/Memory.h>
+#include <array>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+using namespace Memory;
+using namespace Register;
+using namespace Emulator;
+using namespace Disassembler;
+
+static const uintptr_t CODE_ADDRESS = 0x10000;
+
+// Read write page followed by an unmapped one, a read only page and an unmapped address.
+static const uintptr_t DATA_ADDRESS = 0x20000;
+static const uintptr_t READ_ONLY_ADDRESS = 0x30000;
+static const uintptr_t UNMAPPED_ADDRESS = 0x50000;
+
+// Contents of every mapped data word.
+static uint32_t value_at(uintptr_t address) {
+	return address ^ 0xa5a5a5a5;
+}
+
+static void fill(ConcreteMemory &memory, uintptr_t page) {
+	for (uintptr_t address = page; address < page + PAGE_SIZE; address += 4) {
+		memory.write_value(address, value_at(address));
+	}
+}
+
+struct Case {
+	const char *name;
+	ARMMode mode;
+	uint32_t opcode;
+	uint32_t r0, r1;
+
+	// The fault the instruction has to stop with.
+	uintptr_t fault_address;
+	Access access;
+	FaultReason reason;
+
+	// Registers a load multiple may load before the faulting word.
+	unsigned loaded;
+
+	// r0, r1 and r2 once the fault is handled and the instruction runs again.
+	bool resume;
+	array<uint32_t, 3> resumed;
+};
+
+static const uint32_t R2 = 0x22222222;
+
+static const Case cases[] = {
+	{ "ldr r0, [r0]", ARMMode_ARM, 0xe5900000, UNMAPPED_ADDRESS, 0x11111111,
+		UNMAPPED_ADDRESS, Access_Read, FaultReason_Unmapped, 0,
+		true, { value_at(UNMAPPED_ADDRESS), 0x11111111, R2 } },
+	{ "ldr r1, [r0], #4", ARMMode_ARM, 0xe4901004, UNMAPPED_ADDRESS, 0x11111111,
+		UNMAPPED_ADDRESS, Access_Read, FaultReason_Unmapped, 0,
+		true, { UNMAPPED_ADDRESS + 4, value_at(UNMAPPED_ADDRESS), R2 } },
+	{ "ldr pc, [r0]", ARMMode_ARM, 0xe590f000, UNMAPPED_ADDRESS, 0x11111111,
+		UNMAPPED_ADDRESS, Access_Read, FaultReason_Unmapped, 0,
+		false, {} },
+	{ "ldmia r0!, {r1, r2}", ARMMode_ARM, 0xe8b00006, DATA_ADDRESS + PAGE_SIZE - 4, 0x11111111,
+		DATA_ADDRESS + PAGE_SIZE, Access_Read, FaultReason_Unmapped, 1 << 1,
+		true, { DATA_ADDRESS + PAGE_SIZE + 4, value_at(DATA_ADDRESS + PAGE_SIZE - 4), value_at(DATA_ADDRESS + PAGE_SIZE) } },
+	{ "ldm r1, {r1, r2}", ARMMode_ARM, 0xe8910006, 0, DATA_ADDRESS + PAGE_SIZE - 4,
+		DATA_ADDRESS + PAGE_SIZE, Access_Read, FaultReason_Unmapped, 0,
+		true, { 0, value_at(DATA_ADDRESS + PAGE_SIZE - 4), value_at(DATA_ADDRESS + PAGE_SIZE) } },
+	{ "vldmia r0!, {s0, s1, s2}", ARMMode_ARM, 0xecb00a03, DATA_ADDRESS + PAGE_SIZE - 4, 0x11111111,
+		DATA_ADDRESS + PAGE_SIZE, Access_Read, FaultReason_Unmapped, 0,
+		true, { DATA_ADDRESS + PAGE_SIZE + 8, 0x11111111, R2 } },
+	{ "str r1, [r0, #4]!", ARMMode_ARM, 0xe5a01004, READ_ONLY_ADDRESS - 4, 0x11111111,
+		READ_ONLY_ADDRESS, Access_Write, FaultReason_Protection, 0,
+		true, { READ_ONLY_ADDRESS, 0x11111111, R2 } },
+	{ "ldmia r0!, {r1, r2} (thumb)", ARMMode_Thumb, 0xc806, DATA_ADDRESS + PAGE_SIZE - 4, 0x11111111,
+		DATA_ADDRESS + PAGE_SIZE, Access_Read, FaultReason_Unmapped, 1 << 1,
+		true, { DATA_ADDRESS + PAGE_SIZE + 4, value_at(DATA_ADDRESS + PAGE_SIZE - 4), value_at(DATA_ADDRESS + PAGE_SIZE) } },
+};
+
+static bool run_case(const Case &test) {
+	ConcreteMemory memory;
+	memory.map(CODE_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC);
+	memory.map(DATA_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE);
+	memory.map(READ_ONLY_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE);
+	fill(memory, DATA_ADDRESS);
+	fill(memory, READ_ONLY_ADDRESS);
+	memory.protect(READ_ONLY_ADDRESS, PAGE_SIZE, PROT_READ);
+
+	if (test.mode == ARMMode_ARM) {
+		memory.write_value(CODE_ADDRESS, test.opcode);
+	} else {
+		memory.write_value(CODE_ADDRESS, static_cast<uint16_t>(test.opcode));
+	}
+
+	ARMContext context(&memory);
+	ARMEmulator emulator(&context, &memory, test.mode, ARMvAll);
+
+	array<uint32_t, ARM_REG_CORE_MAX> registers {};
+	for (unsigned r = 0; r < 15; ++r) {
+		registers[r] = 0x01010101 * r;
+	}
+
+	registers[0] = test.r0;
+	registers[1] = test.r1;
+	registers[2] = R2;
+	registers[13] = DATA_ADDRESS + PAGE_SIZE / 2;
+	registers[15] = CODE_ADDRESS;
+	context.setCoreRegisters(registers);
+
+	bool ok = true;
+	auto check = [&ok, &test] (bool condition, const char *what) {
+		if (!condition) {
+			printf("FAIL: %s: %s\n", test.name, what);
+			ok = false;
+		}
+	};
+
+	// The instruction stops without effects on the registers.
+	check(emulator.runFor(1) == StopReason_Fault, "no fault");
+	check(emulator.getExecutedCount() == 0, "faulting instruction counted");
+
+	const Fault &fault = emulator.getFault();
+	check(fault.reason == test.reason, "wrong fault reason");
+	check(fault.access == test.access, "wrong fault access");
+	check(fault.address == test.fault_address, "wrong fault address");
+
+	check(context.getCurrentInstructionAddress() == CODE_ADDRESS, "PC moved");
+	auto after = context.getCoreRegisters();
+	for (unsigned r = 0; r < 15; ++r) {
+		if (!(test.loaded & (1 << r)) && after[r] != registers[r]) {
+			printf("  r%u: 0x%.8x -> 0x%.8x\n", r, registers[r], after[r]);
+			check(false, "register changed");
+		}
+	}
+
+	if (!test.resume) {
+		return ok;
+	}
+
+	// Handle the fault and run the instruction again.
+	if (test.reason == FaultReason_Unmapped) {
+		uintptr_t page = test.fault_address & ~PAGE_MASK;
+		memory.map(page, PAGE_SIZE, PROT_READ | PROT_WRITE);
+		fill(memory, page);
+	} else {
+		memory.protect(READ_ONLY_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE);
+	}
+
+	check(emulator.runFor(1) == StopReason_Count, "fault after it was handled");
+	after = context.getCoreRegisters();
+	for (unsigned r = 0; r < 3; ++r) {
+		if (after[r] != test.resumed[r]) {
+			printf("  r%u: expected 0x%.8x, got 0x%.8x\n", r, test.resumed[r], after[r]);
+			check(false, "wrong result after resuming");
+		}
+	}
+
+	return ok;
+}
+
+int main(int argc, char **argv) {
+	unsigned failures = 0;
+	for (const auto &test : cases) {
+		failures += !run_case(test);
+	}
+
+	printf("%zu cases, %u failure(s)\n", sizeof(cases) / sizeof(cases[0]), failures);
+	return failures ? 1 : 0;
+}
@@ -455,14 +455,18 @@ class REToolsInstructionInspector: public InstructionInspector, public RegInitPo
 	using RegInitPolicy::initialize_registers;
 
 public:
-	REToolsInstructionInspector() {
+	// With 'jit' set every block is compiled the first time it runs.
+	REToolsInstructionInspector(bool jit = false) {
 		m_memory = std::make_unique<ConcreteMemory>();
 		m_context = std::make_unique<ARMContext>(m_memory.get());
 		m_emulator = std::make_unique<ARMEmulator>(m_context.get(), m_memory.get(), ARMMode_ARM);
+		if (jit) {
+			m_emulator->enableJIT(0);
+		}
 
 		// Create a scratch area for code and a stack.
-		m_memory->map(m_base, m_base_size, 0);
-		m_memory->map(m_stack_base, m_stack_size, 0);
+		m_memory->map(m_base, m_base_size, PROT_READ | PROT_WRITE | PROT_EXEC);
+		m_memory->map(m_stack_base, m_stack_size, PROT_READ | PROT_WRITE);
 
 		// Generate special values for registers.
 		std::array<u32_t, 16> u32_values;
@@ -624,7 +628,7 @@ private:
 
 int main(int argc, char **argv) {
 	if (argc <= 5) {
-		LOG_INFO("Usage: %s <iterations> <start> <finish> <mode> <outfile>", argv[0]);
+		LOG_INFO("Usage: %s <iterations> <start> <finish> <mode> <outfile> [jit]", argv[0]);
 		LOG_INFO("  <iterations>: Number of times we will randomly generate the same instruction.");
 		LOG_INFO("  <start>:      Index to the first instruction to be tested.");
 		LOG_INFO("                  From 0 to %u for THUMB instructions.", n_thumb_opcodes - 1);
@@ -633,6 +637,7 @@ int main(int argc, char **argv) {
 		LOG_INFO("                  If <start> == <finish> then all instructions are tested.");
 		LOG_INFO("  <mode>:       0 for ARM , 1 for THUMB.");
 		LOG_INFO("  <outfile>:    File name to save results.");
+		LOG_INFO("  [jit]:        Also run every instruction through the JIT and compare it with the interpreter.");
 		return -1;
 	}
 
@@ -641,11 +646,18 @@ int main(int argc, char **argv) {
 	unsigned finish = std::stoi(argv[3]);
 	unsigned mode = std::stoi(argv[4]);
 	char *path = argv[5];
+	bool jit = argc > 6 && std::string(argv[6]) == "jit";
 
 	// Create 'N' instruction inspectors.
 	UnicornInstructionInspector<RegisterInitPolicy::Inc<0xcafe0000>> unicorn_inspector;
 	REToolsInstructionInspector<RegisterInitPolicy::Inc<0xcafe0000>> retools_inspector;
 
+	// The JIT inspector maps its own scratch memory, only pay for it when asked to.
+	std::unique_ptr<REToolsInstructionInspector<RegisterInitPolicy::Inc<0xcafe0000>>> jit_inspector;
+	if (jit) {
+		jit_inspector = std::make_unique<REToolsInstructionInspector<RegisterInitPolicy::Inc<0xcafe0000>>>(true);
+	}
+
 	// Get the initial context values.
 	auto unicorn_base_context = unicorn_inspector.effects();
 	auto retools_base_context = retools_inspector.effects();
@@ -696,6 +708,16 @@ int main(int argc, char **argv) {
 		if (r0 != r1) {
 			instruction_effects::print_diff("unicorn", "retools", unicorn_base_context, r0, r1);
 		}
+
+		// The JIT has to leave exactly the same state as the interpreter.
+		if (jit_inspector && jit_inspector->run(ARMMode_ARM, op_code)) {
+			auto r2 = jit_inspector->effects();
+			jit_inspector->reset();
+
+			if (r1 != r2) {
+				instruction_effects::print_diff("interpreter", "jit", retools_base_context, r1, r2);
+			}
+		}
 	}
 
 	return 0;
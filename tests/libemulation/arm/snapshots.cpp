@@ -0,0 +1,148 @@
+#include <arm/ARMEmulator.h>
+#include <memory/Memory.h>
+#include <array>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+using namespace Memory;
+using namespace Register;
+using namespace Emulator;
+
+static const uintptr_t CODE_ADDRESS = 0x10000;
+static const uintptr_t DATA_ADDRESS = 0x20000;
+static const size_t DATA_PAGES = 64;
+
+// Increments the counter at r4 and stores it to the next page after r5, forever:
+//
+//   ldr r1, [r4]
+//   add r1, r1, #1
+//   str r1, [r4]
+//   add r5, r5, #0x1000
+//   str r1, [r5]
+//   b <start>
+static const uint32_t program[] = { 0xe5941000, 0xe2811001, 0xe5841000, 0xe2855a01, 0xe5851000, 0xeafffff9 };
+static const unsigned LOOP_LENGTH = sizeof(program) / sizeof(program[0]);
+
+// Unused word of the code page, writing it makes the page dirty without changing the program.
+static const uintptr_t CODE_SPARE = CODE_ADDRESS + 0x800;
+
+static uint32_t value_at(uintptr_t address) {
+	return address ^ 0x5a5a5a5a;
+}
+
+struct Machine {
+	ConcreteMemory memory;
+	ARMContext context;
+	ARMEmulator emulator;
+	unsigned failures = 0;
+	const char *name;
+
+	Machine(const char *name, bool jit) :
+		context(&memory), emulator(&context, &memory, ARMMode_ARM), name(name) {
+		memory.map(CODE_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC);
+		memory.map(DATA_ADDRESS, DATA_PAGES * PAGE_SIZE, PROT_READ | PROT_WRITE);
+		memory.write(CODE_ADDRESS, program, sizeof(program));
+		if (jit) {
+			emulator.enableJIT(0);
+		}
+	}
+
+	void check(bool condition, unsigned cycle, const char *what) {
+		if (!condition) {
+			printf("FAIL: %s: cycle %u: %s\n", name, cycle, what);
+			failures++;
+		}
+	}
+
+	vector<uint32_t> data() {
+		vector<uint32_t> words(DATA_PAGES * PAGE_SIZE / 4);
+		memory.read(DATA_ADDRESS, words.data(), words.size() * 4);
+		return words;
+	}
+};
+
+static unsigned run(const char *name, bool jit) {
+	Machine machine(name, jit);
+	ConcreteMemory &memory = machine.memory;
+	ARMEmulator &emulator = machine.emulator;
+
+	// Every page is written before the snapshot so the TLB holds writable entries for them.
+	for (uintptr_t address = DATA_ADDRESS; address < DATA_ADDRESS + DATA_PAGES * PAGE_SIZE; address += 4) {
+		memory.writeSized(address, 4, value_at(address));
+	}
+
+	array<uint32_t, ARM_REG_CORE_MAX> registers {};
+	for (unsigned r = 0; r < 15; ++r) {
+		registers[r] = 0x01010101 * r;
+	}
+
+	registers[4] = DATA_ADDRESS;
+	registers[5] = DATA_ADDRESS;
+	registers[15] = CODE_ADDRESS;
+	machine.context.setCoreRegisters(registers);
+	*machine.context.getCPSRWord() = 0x10;
+
+	if (!emulator.snapshot()) {
+		printf("FAIL: %s: snapshot\n", name);
+		return 1;
+	}
+
+	vector<uint32_t> expected = machine.data();
+	uint32_t counter = value_at(DATA_ADDRESS);
+
+	for (unsigned cycle = 0; cycle < 6; ++cycle) {
+		// Later cycles go further and write the pages written before the last restore again.
+		unsigned iterations = 3 + cycle * 4;
+		emulator.runFor(iterations * LOOP_LENGTH);
+
+		auto after = machine.context.getCoreRegisters();
+		machine.check(after[1] == counter + iterations, cycle, "wrong counter register");
+		machine.check(after[5] == DATA_ADDRESS + iterations * PAGE_SIZE, cycle, "wrong pointer register");
+		machine.check(after[15] == CODE_ADDRESS, cycle, "wrong pc");
+
+		uint32_t value;
+		memory.read_value(DATA_ADDRESS + iterations * PAGE_SIZE, value);
+		machine.check(value == counter + iterations, cycle, "store not done");
+
+		// The first cycle writes the code page too, the restore has to copy it back only then.
+		if (cycle == 0) {
+			memory.write_value(CODE_SPARE, 0xe1a00000u);
+		}
+
+		// A page unmapped after the snapshot starts from zeros when mapped again, and keeps
+		// them across restores.
+		if (cycle == 2) {
+			uintptr_t page = DATA_ADDRESS + PAGE_SIZE;
+			memory.unmap(page, PAGE_SIZE);
+			memory.map(page, PAGE_SIZE, PROT_READ | PROT_WRITE);
+			fill(expected.begin() + PAGE_SIZE / 4, expected.begin() + 2 * PAGE_SIZE / 4, 0);
+		}
+
+		size_t generation = emulator.getBlockCache().generation();
+
+		// Restoring twice is the same as restoring once.
+		for (unsigned restore = 0; restore < 2; ++restore) {
+			machine.check(emulator.restore(), cycle, "restore failed");
+			machine.check(machine.context.getCoreRegisters() == registers, cycle, "registers not restored");
+			machine.check(*machine.context.getCPSRWord() == 0x10, cycle, "cpsr not restored");
+			machine.check(machine.data() == expected, cycle, "memory not restored");
+
+			uint32_t spare;
+			memory.read_value(CODE_SPARE, spare);
+			machine.check(spare == 0, cycle, "code page not restored");
+		}
+
+		// Only the dirty pages are copied back, and the code page only was the first time.
+		bool dropped = emulator.getBlockCache().generation() != generation;
+		machine.check(dropped == (cycle == 0), cycle, cycle ? "clean code page restored" : "code page not restored");
+	}
+
+	return machine.failures;
+}
+
+int main(int argc, char **argv) {
+	unsigned failures = run("interpreter", false) + run("jit", true);
+	printf("%u failure(s)\n", failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+#include <memory/Memory.h>
+#include <memory/SparseMemory.h>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace Memory;
+
+static const uintptr_t DATA_ADDRESS = 0x10000;
+static const uintptr_t UNMAPPED_ADDRESS = 0x80000;
+
+static unsigned failures = 0;
+
+static void check(bool condition, const char *what) {
+	if (!condition) {
+		printf("FAIL: %s\n", what);
+		failures++;
+	}
+}
+
+static void check_fault(AbstractMemory &memory, FaultReason reason, Access access, uintptr_t address, size_t size,
+		const char *what) {
+	const Fault &fault = memory.getFault();
+	if (fault.reason != reason || fault.access != access || fault.address != address || fault.size != size) {
+		printf("FAIL: %s: reason %d access %d address 0x%.8lx size %zu\n", what, fault.reason, fault.access,
+			fault.address, fault.size);
+		failures++;
+	}
+
+	memory.clearFault();
+}
+
+// Handler installed before the first SparseMemory, it has to keep getting the faults that are
+// not in any guest address space.
+static volatile sig_atomic_t s_chained = 0;
+static uint8_t *s_guard_page = nullptr;
+
+static void previous_handler(int signal, siginfo_t *info, void *context) {
+	if (static_cast<uint8_t *>(info->si_addr) != s_guard_page) {
+		_exit(2);
+	}
+
+	s_chained = s_chained + 1;
+	mprotect(s_guard_page, getpagesize(), PROT_READ | PROT_WRITE);
+}
+
+static void test_commit_on_touch(SparseMemory &memory) {
+	check(memory.map(DATA_ADDRESS, 4 * PAGE_SIZE, PROT_READ | PROT_WRITE), "map");
+	for (unsigned i = 0; i < 4; ++i) {
+		check(!memory.isCommitted(DATA_ADDRESS + i * PAGE_SIZE), "page committed by map");
+	}
+
+	// Reading an untouched page commits it and reads zeros, the others stay untouched.
+	uint64_t value = 1;
+	check(memory.readSized(DATA_ADDRESS + PAGE_SIZE + 8, 8, value) && value == 0, "untouched page not zero");
+	check(memory.isCommitted(DATA_ADDRESS + PAGE_SIZE), "read did not commit the page");
+	check(!memory.isCommitted(DATA_ADDRESS) && !memory.isCommitted(DATA_ADDRESS + 2 * PAGE_SIZE),
+		"read committed other pages");
+
+	// An access across two pages commits both.
+	check(memory.writeSized(DATA_ADDRESS + 3 * PAGE_SIZE - 2, 4, 0xdeadbeef), "write across pages");
+	check(memory.isCommitted(DATA_ADDRESS + 2 * PAGE_SIZE) && memory.isCommitted(DATA_ADDRESS + 3 * PAGE_SIZE),
+		"write across pages did not commit both");
+	check(memory.readSized(DATA_ADDRESS + 3 * PAGE_SIZE - 2, 4, value) && value == 0xdeadbeef, "write across pages lost");
+	check(memory.getFault().reason == FaultReason_None, "fault on mapped pages");
+}
+
+static void test_faults(SparseMemory &memory) {
+	uint64_t value = 0;
+	check(!memory.readSized(UNMAPPED_ADDRESS + 4, 4, value), "read of an unmapped page");
+	check_fault(memory, FaultReason_Unmapped, Access_Read, UNMAPPED_ADDRESS + 4, 4, "unmapped read");
+
+	// The first byte that cannot be accessed is reported, not the start of the access.
+	check(!memory.writeSized(DATA_ADDRESS + 4 * PAGE_SIZE - 2, 4, 0), "write past the mapping");
+	check_fault(memory, FaultReason_Unmapped, Access_Write, DATA_ADDRESS + 4 * PAGE_SIZE, 4, "write past the mapping");
+
+	check(memory.protect(DATA_ADDRESS, PAGE_SIZE, PROT_READ), "protect");
+	check(!memory.writeSized(DATA_ADDRESS, 4, 0), "write to a read only page");
+	check_fault(memory, FaultReason_Protection, Access_Write, DATA_ADDRESS, 4, "write to a read only page");
+	check(memory.readSized(DATA_ADDRESS, 4, value), "read of a read only page");
+
+	uint32_t opcode;
+	check(memory.fetch(DATA_ADDRESS, &opcode, sizeof(opcode)) == 0, "fetch from a page without execute");
+	check_fault(memory, FaultReason_Protection, Access_Execute, DATA_ADDRESS, 4, "fetch without execute");
+	check(memory.protect(DATA_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE), "protect back");
+}
+
+static void test_host_accesses(SparseMemory &memory) {
+	// Host accesses stop at the unmapped page, what they did to it lands on a scratch page.
+	vector<uint8_t> pattern(2 * PAGE_SIZE, 0xaa);
+	check(memory.write(DATA_ADDRESS + 3 * PAGE_SIZE, pattern.data(), pattern.size()) == PAGE_SIZE,
+		"write into an unmapped page not cut at the page end");
+
+	vector<uint8_t> buffer(2 * PAGE_SIZE, 0x55);
+	check(memory.read(DATA_ADDRESS + 3 * PAGE_SIZE, buffer.data(), buffer.size()) == PAGE_SIZE,
+		"read from an unmapped page not cut at the page end");
+	check(buffer[0] == 0xaa, "read returned the wrong bytes");
+	check(buffer[PAGE_SIZE] != 0xaa, "bytes written to a scratch page were kept");
+
+	check(memory.write(UNMAPPED_ADDRESS, pattern.data(), 16) == 0, "write to an unmapped page");
+	check(memory.read(UNMAPPED_ADDRESS, buffer.data(), 16) == 0, "read from an unmapped page");
+
+	// The scratch pages are discarded, the guest still sees them unmapped and a later mapping
+	// starts from zeros.
+	uint64_t value = 0;
+	check(!memory.readSized(DATA_ADDRESS + 4 * PAGE_SIZE, 1, value), "scratch page left accessible");
+	check_fault(memory, FaultReason_Unmapped, Access_Read, DATA_ADDRESS + 4 * PAGE_SIZE, 1, "scratch page");
+
+	check(memory.map(UNMAPPED_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE), "map the scratch page");
+	check(memory.readSized(UNMAPPED_ADDRESS, 8, value) && value == 0, "scratch page contents kept");
+	check(memory.unmap(UNMAPPED_ADDRESS, PAGE_SIZE), "unmap the scratch page");
+}
+
+static void test_unmap(SparseMemory &memory) {
+	check(memory.writeSized(DATA_ADDRESS + 8, 8, 0x0123456789abcdefULL), "write before unmap");
+	check(memory.unmap(DATA_ADDRESS, PAGE_SIZE), "unmap");
+	check(!memory.isCommitted(DATA_ADDRESS), "unmapped page still committed");
+
+	uint64_t value = 0;
+	check(!memory.readSized(DATA_ADDRESS + 8, 8, value), "read after unmap");
+	check_fault(memory, FaultReason_Unmapped, Access_Read, DATA_ADDRESS + 8, 8, "read after unmap");
+
+	check(memory.map(DATA_ADDRESS, PAGE_SIZE, PROT_READ | PROT_WRITE), "map again");
+	check(memory.readSized(DATA_ADDRESS + 8, 8, value) && value == 0, "old contents after unmap and map");
+}
+
+static void test_chaining() {
+	s_guard_page = static_cast<uint8_t *>(mmap(nullptr, getpagesize(), PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0));
+	*reinterpret_cast<volatile uint8_t *>(s_guard_page) = 1;
+	check(s_chained == 1, "fault outside the guest memory not passed to the previous handler");
+	munmap(s_guard_page, getpagesize());
+}
+
+int main(int argc, char **argv) {
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_sigaction = previous_handler;
+	action.sa_flags = SA_SIGINFO;
+	sigemptyset(&action.sa_mask);
+	sigaction(SIGSEGV, &action, nullptr);
+
+	SparseMemory memory;
+	if (!memory.valid()) {
+		printf("FAIL: could not reserve the guest address space\n");
+		return 1;
+	}
+
+	test_commit_on_touch(memory);
+	test_faults(memory);
+	test_host_accesses(memory);
+	test_unmap(memory);
+	test_chaining();
+
+	printf("%u failure(s)\n", failures);
+	return failures ? 1 : 0;
+}